@@ -5,51 +5,63 @@
 *   @Purpose  - This file defines the adjascency list class, which defines a vertex and all of the edges
 *               that are incident to this vertex (for directed graphs, only outgoing edges). This is done
 *               by storing two main pieces of data, the VertexData associated with the vertex for this
-*               adjacenecy list, and a std::list object that contains a series of Edge pointers (Edge is
-*               a self defined type, see Edge/Edge.h). I also recently added a hash_map over the adjacent
-*               vertices for each adjacency list. This allows us to have constant look-up time to see if a
-*               given edge exists, instead of having to perform a linear scan through the edges. We still
-*               have to perform a linear scan to actually get the Edge from the list, because we can't map
-*               to iterators. The graph classes (uGraph and dGraph) will all have a std::vector of AdjList
-*               objects, representing the actual graph.
+*               adjacenecy list, and a SmallVector that contains a series of Edge pointers (Edge is
+*               a self defined type, see Edge/Edge.h). The first few edge pointers are stored inside the
+*               AdjList itself, so a vertex with a low degree needs no allocations beyond its edges. Once a
+*               vertex has more than index_threshold edges, a hash_map from every adjacent vertex to the slot
+*               of its edge is built, so finding, reweighting or deleting the edge to a given vertex is O(1)
+*               instead of a linear scan through the edges. Below the threshold a scan of a few contiguous
+*               pointers is cheaper than hashing, and the vertex doesn't pay for an empty map. An edge is
+*               deleted by moving the last edge into its slot, so the order of the edges changes when one is
+*               deleted. The graph classes (uGraph and dGraph) will all have a std::vector of AdjList objects,
+*               representing the actual graph.
 **/
 
 #include "AdjList.h"
 
+template <class VertexType>
+const unsigned int AdjList<VertexType>::index_threshold;
+
 // @func - Constructor#1
 // @args - None
 // @info - Initializes everything to empty
 template <class VertexType>
-AdjList<VertexType>::AdjList() : vertex(), edge_list(), num_edges(0){
+AdjList<VertexType>::AdjList() : vertex(), edge_list(), edge_map(nullptr), edge_pool(nullptr), num_edges(0){
 }
 
 // @func - Constructor#2
 // @args - #1 Vertex data
 template <class VertexType>
-AdjList<VertexType>::AdjList(const VertexType & newData) : vertex(newData), edge_list(), num_edges(0) {
+AdjList<VertexType>::AdjList(const VertexType & newData) : vertex(newData), edge_list(), edge_map(nullptr), edge_pool(nullptr), num_edges(0) {
 
 }
 
 // @func - Constructor#3
 // @args - #1 A vertex object to set as our vertex
 template <class VertexType>
-AdjList<VertexType>::AdjList(const Vertex<VertexType> & newV) :edge_list(), num_edges(0){
+AdjList<VertexType>::AdjList(const Vertex<VertexType> & newV) :edge_list(), edge_map(nullptr), edge_pool(nullptr), num_edges(0){
     this->vertex = newV;
 }
 
+// @func - Constructor#4
+// @args - #1 A vertex object to set as our vertex, #2 the pool that our edges should be allocated from
+template <class VertexType>
+AdjList<VertexType>::AdjList(const Vertex<VertexType> & newV, ObjectPool<Edge<VertexType> > * pool) : vertex(newV), edge_list(), edge_map(nullptr), edge_pool(pool), num_edges(0) {
+}
+
 
 // @func - Destructor
 // @args - None
-// @info - Cleans up the edges allocated with new() in insertEdge function
+// @info - Cleans up the edges allocated in the addEdge function
 template <class VertexType>
 AdjList<VertexType>::~AdjList() {
 
     for(auto edge : edge_list) {
-        delete(edge);
+        freeEdge(edge);
     }
 
     edge_list.clear();
-    edge_map.clear();
+    dropIndex();
 }
 
 
@@ -76,22 +88,23 @@ Vertex<VertexType> * AdjList<VertexType>::getVertex() {
 template <class VertexType>
 bool AdjList<VertexType>::addEdge(Vertex<VertexType> * vert, double wt){
 
-    Edge<VertexType> * newEdge = new Edge<VertexType>(&this->vertex, vert, wt);
-
     // no self loops
-    if(this->vertex.getData() == vert->getData()) {
-        delete(newEdge);
+    if(this->vertex.getData() == vert->getData())
         return false;
-    }
 
-    // no parallel edges
-    if(edge_map.find(vert->getData()) != edge_map.end()) {
-        delete(newEdge);
-        return false;
+    // no parallel edges, if the edges are indexed insert into the map first so we only hash the target once
+    if(edge_map != nullptr) {
+        if(!edge_map->insert(std::pair<VertexType, unsigned int>(vert->getData(), edge_list.size())).second)
+            return false;
     }
+    else if(findEdge(vert->getData()) != -1)
+        return false;
 
-    edge_map.insert(std::pair<VertexType, bool>(vert->getData(), true));
-    edge_list.push_back(newEdge);
+    // only allocate the edge once we know we are keeping it
+    edge_list.push_back(newEdge(vert, wt));
+
+    if(edge_map == nullptr && edge_list.size() > index_threshold)
+        buildIndex();
 
     return true;
 
@@ -99,34 +112,53 @@ bool AdjList<VertexType>::addEdge(Vertex<VertexType> * vert, double wt){
 
 
 
+// @func - appendEdge
+// @args - #1 Vertex that the edge points to, #2 weighting of the edge
+// @info - Like addEdge, but the caller promises the edge is neither a self loop nor a duplicate.
+template <class VertexType>
+void AdjList<VertexType>::appendEdge(Vertex<VertexType> * vert, double wt){
+
+    edge_list.push_back(newEdge(vert, wt));
+
+    if(edge_map != nullptr)
+        edge_map->emplace(vert->getData(), edge_list.size()-1);
+    else if(edge_list.size() > index_threshold)
+        buildIndex();
+}
+
+
 // @func - deleteEdge
 // @args - #1 the data contained by the vertex that you wish to delete the edge from
-// @info - finds the vertex containing the data passed in as an argument, and deletes it from the chain.
+// @info - O(1) once the edges are indexed, the last edge in the list takes over the slot of the deleted edge.
 template <class VertexType>
 bool AdjList<VertexType>::deleteEdge(const VertexType & data){
 
-    if(!edge_list.size())
-        return false;
+    int position = findEdge(data);
 
-    if(edge_map.find(data) == edge_map.end()) {
+    if(position == -1) {
         return false;
     }
 
-    edge_map.erase(data);
+    freeEdge(edge_list[position]);
 
-    auto edge_iterator = edge_list.begin();
+    if(edge_map != nullptr)
+        edge_map->erase(data);
 
-    for(; edge_iterator != edge_list.end(); ++edge_iterator) {
+    // move the last edge into the hole, it's the only edge whose slot changes
+    if(position != (int)edge_list.size()-1) {
+        edge_list[position] = edge_list.back();
 
-        if((*edge_iterator)->getTarget()->getData() == data) {
-            delete(*edge_iterator);
-            edge_list.erase(edge_iterator);
-            num_edges--;
-            return true;
-        }
+        if(edge_map != nullptr)
+            (*edge_map)[edge_list[position]->getTarget()->getData()] = position;
     }
 
-    return false;
+    edge_list.pop_back();
+    num_edges--;
+
+    if(edge_map != nullptr && edge_list.size() <= index_threshold/2)
+        dropIndex();
+
+    return true;
 }
 
 
@@ -151,44 +183,54 @@ bool AdjList<VertexType>::deleteAllEdges() {
     auto edge_iterator = edge_list.begin();
 
     for(; edge_iterator != edge_list.end(); ++edge_iterator) {
-        delete(*edge_iterator);
+        freeEdge(*edge_iterator);
     }
 
     edge_list.clear();
-    edge_map.clear();
+    dropIndex();
 
     return true;
 }
 
+// @func - releaseEdges
+// @args - None
+// @info - Forgets all of the edges adjacent to this vertex without freeing them, the owning graph frees them in bulk.
+template <class VertexType>
+void AdjList<VertexType>::releaseEdges() {
+    edge_list.clear();
+    dropIndex();
+}
+
 // @func - containsEdge
 // @args - #1 Vertex data associated with the other side of the edge
 // @info - true if an edge exists to the given vertex
 template <class VertexType>
 bool AdjList<VertexType>::containsEdge(const VertexType & data) {
-    if(!edge_list.size() || edge_map.find(data) == edge_map.end()) {
-        return false;
-    }
-    return true;
+    return findEdge(data) != -1;
 }
 
 
 // @func - getEdge
-// @args - #1 Pointer to the edge to be returned.
+// @args - #1 The vertex on the other side of the edge
 // @info - finds and returns the given edge if it exists
 template <class VertexType>
 Edge<VertexType> * AdjList<VertexType>::getEdge(const Vertex<VertexType> & vert) {
+    return getEdge(vert.getData());
+}
 
-    if(!edge_list.size() || edge_map.find(vert.getData()) == edge_map.end()) {
-        return nullptr;
-    }
+// @func - getEdge
+// @args - #1 Vertex data associated with the other side of the edge
+// @info - finds and returns the given edge if it exists, O(1) once the edges are indexed
+template <class VertexType>
+Edge<VertexType> * AdjList<VertexType>::getEdge(const VertexType & data) {
 
-    for(auto edge : edge_list) {
-        if(edge->getTarget()->getData() == vert.getData())
-            return edge;
-    }
+    int position = findEdge(data);
 
-    return nullptr;
+    if(position == -1) {
+        return nullptr;
+    }
 
+    return edge_list[position];
 }
 
 
@@ -197,14 +239,14 @@ Edge<VertexType> * AdjList<VertexType>::getEdge(const Vertex<VertexType> & vert)
 // @return - Vector of pointers to all the edge objects in the class
 template <class VertexType>
 std::vector<Edge<VertexType> *> AdjList<VertexType>::getAllEdges() {
-    return std::vector<Edge<VertexType> *> {std::begin(edge_list), std::end(edge_list)};
+    return std::vector<Edge<VertexType> *>(edge_list.begin(), edge_list.end());
 }
 
 // @func   - getEdgeList
 // @args   - None
 // @return - The list of edges contained in this class
 template <class VertexType>
-std::list<Edge<VertexType> * > * AdjList<VertexType>::getEdgeList() {
+typename AdjList<VertexType>::EdgeContainer * AdjList<VertexType>::getEdgeList() {
     return &edge_list;
 }
 
@@ -236,6 +278,14 @@ bool AdjList<VertexType>::get_is_multi_graph() {
     return is_multi_graph;
 }
 
+// @func   - isIndexed
+// @args   - None
+// @return - True if the edges are currently indexed by a hash_map, see index_threshold
+template<class VertexType>
+bool AdjList<VertexType>::isIndexed() const {
+    return edge_map != nullptr;
+}
+
 
 // @func   - cleanSelfLoops()
 // @args   - none
@@ -250,3 +300,67 @@ bool AdjList<VertexType>::removeSelfLoops() {
     return ret;
 
 }
+
+// @func   - newEdge
+// @args   - #1 Vertex that the edge points to, #2 weighting of the edge
+// @return - A new edge from our vertex to the given vertex, allocated from our edge pool if we have one
+template<class VertexType>
+Edge<VertexType> * AdjList<VertexType>::newEdge(Vertex<VertexType> * vert, double wt) {
+
+    if(edge_pool != nullptr)
+        return edge_pool->create(&this->vertex, vert, wt);
+
+    return new Edge<VertexType>(&this->vertex, vert, wt);
+}
+
+// @func   - freeEdge
+// @args   - #1 An edge that was allocated by newEdge
+// @info   - Hands the edge back to our edge pool, or deletes it if we don't have one
+template<class VertexType>
+void AdjList<VertexType>::freeEdge(Edge<VertexType> * edge) {
+
+    if(edge_pool != nullptr)
+        edge_pool->destroy(edge);
+    else
+        delete(edge);
+}
+
+// @func   - findEdge
+// @args   - #1 Vertex data associated with the other side of the edge
+// @return - The slot of the edge in edge_list, or -1 if there is no edge to the vertex
+template<class VertexType>
+int AdjList<VertexType>::findEdge(const VertexType & data) const {
+
+    if(edge_map != nullptr) {
+        auto slot = edge_map->find(data);
+        return (slot == edge_map->end())? -1 : slot->second;
+    }
+
+    for(unsigned int i = 0; i < edge_list.size(); i++) {
+        if(edge_list[i]->getTarget()->getData() == data)
+            return i;
+    }
+
+    return -1;
+}
+
+// @func   - buildIndex
+// @info   - Builds edge_map over the edges currently in edge_list
+template<class VertexType>
+void AdjList<VertexType>::buildIndex() {
+
+    edge_map = new std::unordered_map<VertexType, unsigned int>();
+    edge_map->reserve(2*edge_list.size());
+
+    for(unsigned int i = 0; i < edge_list.size(); i++)
+        edge_map->emplace(edge_list[i]->getTarget()->getData(), i);
+}
+
+// @func   - dropIndex
+// @info   - Frees edge_map, from then on edges are found by scanning edge_list
+template<class VertexType>
+void AdjList<VertexType>::dropIndex() {
+
+    delete edge_map;
+    edge_map = nullptr;
+}
@@ -5,13 +5,16 @@
 *   @Purpose  - This file declares the adjascency list class, which defines a vertex and all of the edges
 *               that are incident to this vertex (for directed graphs, only outgoing edges). This is done
 *               by storing two main pieces of data, the VertexData associated with the vertex for this
-*               adjacenecy list, and a std::list object that contains a series of Edge pointers (Edge is
-*               a self defined type, see Edge/Edge.h). I also recently added a hash_map over the adjacent
-*               vertices for each adjacency list. This allows us to have constant look-up time to see if a
-*               given edge exists, instead of having to perform a linear scan through the edges. We still
-*               have to perform a linear scan to actually get the Edge from the list, because we can't map
-*               to iterators. The graph classes (uGraph and dGraph) will all have a std::vector of AdjList
-*               objects, representing the actual graph.
+*               adjacenecy list, and a SmallVector that contains a series of Edge pointers (Edge is
+*               a self defined type, see Edge/Edge.h). The first few edge pointers are stored inside the
+*               AdjList itself, so a vertex with a low degree needs no allocations beyond its edges. Once a
+*               vertex has more than index_threshold edges, a hash_map from every adjacent vertex to the slot
+*               of its edge is built, so finding, reweighting or deleting the edge to a given vertex is O(1)
+*               instead of a linear scan through the edges. Below the threshold a scan of a few contiguous
+*               pointers is cheaper than hashing, and the vertex doesn't pay for an empty map. An edge is
+*               deleted by moving the last edge into its slot, so the order of the edges changes when one is
+*               deleted. The graph classes (uGraph and dGraph) will all have a std::vector of AdjList objects,
+*               representing the actual graph.
 **/
 
 
@@ -21,10 +24,12 @@
 #include <stdexcept>
 #include <vector>
 #include <string>
-#include <list>
+#include <unordered_map>
 
 #include "../Vertex/Vertex.h"
 #include "../Edge/Edge.h"
+#include "../Allocator/ObjectPool.h"
+#include "../SmallVector/SmallVector.h"
 
 
 template <class VertexType>
@@ -33,6 +38,17 @@ class AdjList
 
 public:
 
+    // @member - EdgeContainer
+    // @info   - The container the edges live in, the graph views (GraphView/GraphView.h) iterate it in place. Up to four
+    //           edge pointers fit inside the AdjList itself.
+    typedef SmallVector<Edge<VertexType> *, 4> EdgeContainer;
+
+    // @member - index_threshold
+    // @info   - The degree past which the adj list builds its hash_map over its edges. It's dropped again once the degree
+    //           falls back to half of this, so a vertex whose degree hovers around the threshold doesn't rebuild it over
+    //           and over.
+    static const unsigned int index_threshold = 8;
+
     // @func - Constructor#1
     // @args - None
     // @info - Initializes everything to empty
@@ -46,6 +62,11 @@ public:
     // @args - #1 A vertex object to set as our vertex
     AdjList(const Vertex<VertexType> &);
 
+    // @func - Constructor#4
+    // @args - #1 A vertex object to set as our vertex, #2 the pool that our edges should be allocated from
+    // @info - The graph classes use this so that all of the edges in a graph live in one pool owned by the graph.
+    AdjList(const Vertex<VertexType> &, ObjectPool<Edge<VertexType> > *);
+
     // @func - Destructor
     // @args - Cleans up the edges allocated with new()
     ~AdjList();
@@ -65,10 +86,15 @@ public:
     // @info - pushes this edge onto the back of the edge list.
     bool addEdge(Vertex<VertexType> * , double = 1.0);// std::numeric_limits<double>::infinity());
 
+    // @func - appendEdge
+    // @args - #1 Vertex that the edge points to, #2 weighting of the edge
+    // @info - Like addEdge, but doesn't check for self loops or parallel edges. Only for bulk loading input that is known to be clean.
+    void appendEdge(Vertex<VertexType> *, double = 1.0);
+
 
     // @func - deleteEdge
     // @args - #1 the data contained by the vertex that you wish to delete the edge from
-    // @info - finds the vertex containing the data passed in as an argument, and deletes it from the chain.
+    // @info - O(1) once the edges are indexed, the last edge in the list takes over the slot of the deleted edge.
     bool deleteEdge(const VertexType &);
 
     // @func - deleteEdge
@@ -81,16 +107,27 @@ public:
     // @info - deletes all edges ajascent to the this vertex
     bool deleteAllEdges();
 
+    // @func - releaseEdges
+    // @args - None
+    // @info - Forgets all of the edges adjacent to this vertex without freeing them. This is only for the graph classes, which
+    //         call it right before they release their entire edge pool in one shot.
+    void releaseEdges();
+
     // @func - containsEdge
     // @args - #1 Vertex data associated with the other side of the edge
     // @info - true if an edge exists to the given vertex
     bool containsEdge(const VertexType &);
 
     // @func - getEdge
-    // @args - #1 Pointer to the edge object
+    // @args - #1 The vertex on the other side of the edge
     // @info - finds and returns the given edge if it exists, returns null otherwise
     Edge<VertexType> * getEdge(const Vertex<VertexType> &);
 
+    // @func - getEdge
+    // @args - #1 Vertex data associated with the other side of the edge
+    // @info - finds and returns the given edge if it exists, returns null otherwise. O(1) once the edges are indexed.
+    Edge<VertexType> * getEdge(const VertexType &);
+
     // @func   - getAllEdges
     // @args   - None
     // @return - Vector of pointers to all the edge objects in the class
@@ -99,7 +136,7 @@ public:
     // @func   - getEdgeList
     // @args   - None
     // @return - The list of edges in the adjlist
-    std::list<Edge<VertexType> * > * getEdgeList();
+    EdgeContainer * getEdgeList();
 
     // @func   - get_num_edges
     // @args   - None
@@ -116,11 +153,20 @@ public:
     // @return - Bool value of is_multi_graph
     bool get_is_multi_graph();
 
+    // @func   - isIndexed
+    // @args   - None
+    // @return - True if the edges are currently indexed by a hash_map, see index_threshold
+    bool isIndexed() const;
+
 
 
 
 private:
 
+    // We never copy an adj list, the copy would free the same edges and the same edge_map as the original
+    AdjList(const AdjList &);
+    AdjList & operator=(const AdjList &);
+
     // @func   - removeSelfLoops()
     // @args   - none
     // @return - bool indicating if any were found
@@ -130,20 +176,50 @@ private:
     //           in the graph (they are created and destroyed inside a function).
     bool removeSelfLoops();
 
+    // @func   - newEdge
+    // @args   - #1 Vertex that the edge points to, #2 weighting of the edge
+    // @return - A new edge from our vertex to the given vertex, allocated from our edge pool if we have one
+    Edge<VertexType> * newEdge(Vertex<VertexType> *, double);
+
+    // @func   - freeEdge
+    // @args   - #1 An edge that was allocated by newEdge
+    // @info   - Hands the edge back to our edge pool, or deletes it if we don't have one
+    void freeEdge(Edge<VertexType> *);
+
+    // @func   - findEdge
+    // @args   - #1 Vertex data associated with the other side of the edge
+    // @return - The slot of the edge in edge_list, or -1 if there is no edge to the vertex
+    // @info   - A hash lookup if the edges are indexed, a scan of edge_list otherwise.
+    int findEdge(const VertexType &) const;
+
+    // @func   - buildIndex
+    // @info   - Builds edge_map over the edges currently in edge_list
+    void buildIndex();
+
+    // @func   - dropIndex
+    // @info   - Frees edge_map, from then on edges are found by scanning edge_list
+    void dropIndex();
+
     // @member  - vertex
     // @info    - The vertex object for this adj list.
     Vertex<VertexType> vertex;
 
     // @member - edge_list
-    // @info   - Simple list object, containing all of the edges that are adjacent to this vertex. For directed
-    //           graphs, this means all edges leaving the vertex for this adj list, for undirected graphs it
-    //           contains all edges leaving and entering this vertex.
-    std::list<Edge<VertexType> * > edge_list;
+    // @info   - Contiguous array of all of the edges that are adjacent to this vertex. For directed graphs, this
+    //           means all edges leaving the vertex for this adj list, for undirected graphs it contains all edges
+    //           leaving and entering this vertex.
+    EdgeContainer edge_list;
 
     // @member - edge_map
-    // @info   - A map that is used to determine is an edge exists in the edge_list member in O(1) time as apposed
-    //           to O(n) time if we needed to traverse the list.
-    std::unordered_map<VertexType, bool> edge_map;
+    // @info   - Maps the vertex on the other side of every edge to the slot of that edge in edge_list, so an edge can
+    //           be found in O(1) time as apposed to O(n) time if we needed to traverse the list. It's null while the
+    //           adj list has index_threshold edges or fewer.
+    std::unordered_map<VertexType, unsigned int> * edge_map;
+
+    // @member - edge_pool
+    // @info   - The pool that our edges are allocated from, owned by the graph that owns this adj list. If this is null
+    //           (for an adj list that isn't part of a graph) the edges are allocated with new and delete.
+    ObjectPool<Edge<VertexType> > * edge_pool;
 
     unsigned int num_edges;
 
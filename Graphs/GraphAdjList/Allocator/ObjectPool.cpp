@@ -0,0 +1,119 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - ObjectPool.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the ObjectPool class, see ObjectPool.h for the details of the layout.
+**/
+
+#include "ObjectPool.h"
+
+// @func - Constructor
+// @args - #1 The number of slots in the first slab, #2 The largest number of slots a single slab can have
+template <class ObjectType>
+ObjectPool<ObjectType>::ObjectPool(unsigned int first_slab, unsigned int max_slab) :
+    free_list(nullptr), slab_used(0), next_slab_size(first_slab ? first_slab : 1),
+    max_slab_size(max_slab < first_slab ? first_slab : max_slab), allocations(0), deallocations(0) {
+}
+
+// @func - Destructor
+// @info - Releases every slab, see release() for the caveats about live objects.
+template <class ObjectType>
+ObjectPool<ObjectType>::~ObjectPool() {
+    release();
+}
+
+// @func   - create
+// @args   - The arguments to forward to the constructor of the new object
+// @return - Pointer to a newly constructed object that lives inside of the pool
+template <class ObjectType>
+template <class... Args>
+ObjectType * ObjectPool<ObjectType>::create(Args &&... args) {
+
+    Slot * slot;
+
+    // reuse a slot that was given back before carving a new one off of the newest slab
+    if(free_list != nullptr) {
+        slot = free_list;
+        free_list = free_list->next;
+    }
+    else {
+        if(!slabs.size() || slab_used == slabs.back().second)
+            newSlab();
+
+        slot = slabs.back().first + slab_used++;
+    }
+
+    allocations++;
+
+    return new (&slot->storage) ObjectType(std::forward<Args>(args)...);
+}
+
+// @func   - destroy
+// @args   - #1 Pointer to an object that was returned by create() on this pool
+// @info   - Calls the destructor of the object and puts its slot on the free list.
+template <class ObjectType>
+void ObjectPool<ObjectType>::destroy(ObjectType * object) {
+
+    if(object == nullptr)
+        return;
+
+    object->~ObjectType();
+
+    Slot * slot = reinterpret_cast<Slot *>(object);
+    slot->next = free_list;
+    free_list = slot;
+
+    deallocations++;
+}
+
+// @func   - release
+// @args   - none
+// @info   - Gives every slab back to the system in one shot. The destructors of objects that are still alive are not called.
+template <class ObjectType>
+void ObjectPool<ObjectType>::release() {
+
+    for(auto & slab : slabs)
+        delete[] slab.first;
+
+    slabs.clear();
+    free_list = nullptr;
+    slab_used = 0;
+
+    // everything that was alive is gone now
+    deallocations = allocations;
+}
+
+// @func   - getStats
+// @args   - none
+// @return - The allocation statistics for this pool
+template <class ObjectType>
+PoolStats ObjectPool<ObjectType>::getStats() const {
+
+    PoolStats stats;
+
+    stats.allocations = allocations;
+    stats.deallocations = deallocations;
+    stats.live = allocations - deallocations;
+    stats.slabs = slabs.size();
+    stats.capacity = 0;
+
+    for(auto & slab : slabs)
+        stats.capacity += slab.second;
+
+    stats.bytes = stats.capacity * sizeof(Slot);
+
+    return stats;
+}
+
+// @func - newSlab
+// @info - Allocates the next slab, doubling the slab size until it hits the maximum
+template <class ObjectType>
+void ObjectPool<ObjectType>::newSlab() {
+
+    slabs.push_back(std::make_pair(new Slot[next_slab_size], next_slab_size));
+    slab_used = 0;
+
+    if(next_slab_size < max_slab_size)
+        next_slab_size = next_slab_size*2 < max_slab_size ? next_slab_size*2 : max_slab_size;
+}
@@ -0,0 +1,118 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - ObjectPool.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the declaration of the ObjectPool class, a slab allocator that the graph classes use to allocate their
+*               Edge and AdjList objects. Building a dense graph used to mean one call to new for every single edge, and
+*               tearing it down meant one call to delete for every edge, so both were dominated by malloc/free.
+*
+*   @Details  - The pool hands out objects from large slabs of raw memory. Each slab holds a fixed number of slots, and the
+*               slab size doubles every time the pool runs out of room (up to a maximum), so a graph with E edges only ever
+*               performs O(log E) real allocations for its edges. A slot that is given back through destroy() is pushed onto
+*               an intrusive free list (the pointer to the next free slot is stored inside the dead object itself) and is
+*               reused by the next call to create().
+*
+*               release() hands every slab back to the system at once without visiting the objects in them. This is what
+*               makes tearing down a graph cheap, but it means the destructors of the live objects are NOT called, so it
+*               should only be used on objects that are trivially destructible (like Edge) or that have already been
+*               destroyed by the caller.
+**/
+
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#include <vector>
+#include <new>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+
+// @struct - PoolStats
+// @info   - A snapshot of the bookkeeping of an ObjectPool, returned by ObjectPool::getStats()
+struct PoolStats
+{
+    unsigned long allocations;   // number of objects that have been created over the lifetime of the pool
+    unsigned long deallocations; // number of objects that have been given back through destroy()
+    unsigned long live;          // number of objects currently in use
+    unsigned long slabs;         // number of slabs currently allocated from the system
+    unsigned long capacity;      // total number of slots across all of the slabs
+    unsigned long bytes;         // total number of bytes held by the slabs
+};
+
+template <class ObjectType>
+class ObjectPool
+{
+public:
+
+    // @func - Constructor
+    // @args - #1 The number of slots in the first slab, #2 The largest number of slots a single slab can have
+    ObjectPool(unsigned int = 64, unsigned int = 65536);
+
+    // @func - Destructor
+    // @info - Releases every slab, see release() for the caveats about live objects.
+    ~ObjectPool();
+
+    // @func   - create
+    // @args   - The arguments to forward to the constructor of the new object
+    // @return - Pointer to a newly constructed object that lives inside of the pool
+    template <class... Args>
+    ObjectType * create(Args &&...);
+
+    // @func   - destroy
+    // @args   - #1 Pointer to an object that was returned by create() on this pool
+    // @info   - Calls the destructor of the object and puts its slot on the free list.
+    void destroy(ObjectType *);
+
+    // @func   - release
+    // @args   - none
+    // @info   - Gives every slab back to the system in one shot. The destructors of objects that are still alive are not called.
+    void release();
+
+    // @func   - getStats
+    // @args   - none
+    // @return - The allocation statistics for this pool
+    PoolStats getStats() const;
+
+private:
+
+    // We never copy a pool, the objects inside of it are pointed to by other objects that would be left behind
+    ObjectPool(const ObjectPool &);
+    ObjectPool & operator=(const ObjectPool &);
+
+    // @union - Slot
+    // @info  - A single slot in a slab, either holds a live object or the link to the next free slot
+    union Slot
+    {
+        Slot * next;
+        typename std::aligned_storage<sizeof(ObjectType), alignof(ObjectType)>::type storage;
+    };
+
+    // @func - newSlab
+    // @info - Allocates the next slab, doubling the slab size until it hits the maximum
+    void newSlab();
+
+    // @member - slabs
+    // @info   - Every slab that we have allocated, paired with the number of slots in it
+    std::vector<std::pair<Slot *, unsigned int> > slabs;
+
+    // @member - free_list
+    // @info   - Head of the list of slots that were handed back through destroy()
+    Slot * free_list;
+
+    // @member - slab_used
+    // @info   - How many slots of the newest slab have been handed out, slots are carved off of it in order
+    unsigned int slab_used;
+
+    // @member - next_slab_size, max_slab_size
+    // @info   - The number of slots the next slab will have, and the most slots a slab can have
+    unsigned int next_slab_size, max_slab_size;
+
+    // @member - allocations, deallocations
+    // @info   - Running counts used for the statistics
+    unsigned long allocations, deallocations;
+
+};
+
+#include "ObjectPool.cpp"
+#endif
@@ -0,0 +1,215 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - BreadthFirst.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the shared breadth first searches. They aren't templates, so everything in here
+*               is marked inline to keep the header-only layout the rest of the project uses.
+**/
+
+#include "BreadthFirst.h"
+
+// @func - directionOptimizingSearch
+// @args - #1 The number of vertices, #2 out-arcs, #3 in-arcs, #4 the root, #5 the thresholds, #6 parent output, #7 parent
+//         weight output, #8 discovery order output
+inline void directionOptimizingSearch(unsigned int num_vertices, const AdjacencyView & out, const AdjacencyView & in,
+                                      unsigned int root, const BreadthFirstOptions & options, std::vector<int> & parent,
+                                      std::vector<double> & parent_weight, std::vector<unsigned int> & order) {
+
+    parent.assign(num_vertices, -1);
+    parent_weight.assign(num_vertices, 0);
+    order.clear();
+
+    std::vector<uint64_t> visited((num_vertices + 63) / 64, 0), frontier_bits(visited.size(), 0);
+
+    auto test = [](const std::vector<uint64_t> & bits, unsigned int v) { return (bits[v >> 6] >> (v & 63)) & 1; };
+    auto mark = [](std::vector<uint64_t> & bits, unsigned int v) { bits[v >> 6] |= uint64_t(1) << (v & 63); };
+
+    std::vector<unsigned int> frontier(1, root), next;
+
+    parent[root] = root;
+    mark(visited, root);
+    order.push_back(root);
+
+    // frontier_arcs is what a top-down step will cost, unseen_arcs bounds what a bottom-up step will cost
+    unsigned long long frontier_arcs = out.offsets[root+1] - out.offsets[root];
+    unsigned long long unseen_arcs = in.offsets[num_vertices] - (in.offsets[root+1] - in.offsets[root]);
+    bool bottom_up = false;
+
+    while(frontier.size()) {
+
+        if(!bottom_up && frontier_arcs * options.alpha > unseen_arcs)
+            bottom_up = true;
+        else if(bottom_up && (unsigned long long) frontier.size() * options.beta < num_vertices)
+            bottom_up = false;
+
+        next.clear();
+
+        if(bottom_up) {
+
+            std::fill(frontier_bits.begin(), frontier_bits.end(), 0);
+            for(auto v : frontier)
+                mark(frontier_bits, v);
+
+            // every unseen vertex takes the first parent it finds in the frontier
+            for(unsigned int v = 0; v < num_vertices; v++) {
+
+                if(test(visited, v))
+                    continue;
+
+                for(unsigned int k = in.offsets[v]; k < in.offsets[v+1]; k++) {
+                    if(test(frontier_bits, in.targets[k])) {
+                        mark(visited, v);
+                        parent[v] = in.targets[k];
+                        parent_weight[v] = in.weights[k];
+                        next.push_back(v);
+                        break;
+                    }
+                }
+            }
+        }
+        else {
+
+            for(auto u : frontier) {
+                for(unsigned int j = out.offsets[u]; j < out.offsets[u+1]; j++) {
+                    unsigned int v = out.targets[j];
+                    if(!test(visited, v)) {
+                        mark(visited, v);
+                        parent[v] = u;
+                        parent_weight[v] = out.weights[j];
+                        next.push_back(v);
+                    }
+                }
+            }
+        }
+
+        frontier_arcs = 0;
+        for(auto v : next) {
+            frontier_arcs += out.offsets[v+1] - out.offsets[v];
+            unseen_arcs -= in.offsets[v+1] - in.offsets[v];
+        }
+
+        order.insert(order.end(), next.begin(), next.end());
+        frontier.swap(next);
+    }
+}
+
+// @func - parallelBreadthFirstSearch
+// @args - #1 The number of vertices, #2 out-arcs, #3 the root, #4 the number of threads, #5 distance output, #6 parent output
+inline void parallelBreadthFirstSearch(unsigned int num_vertices, const AdjacencyView & out, unsigned int root, unsigned int threads,
+                                       std::vector<int> & distance, std::vector<int> & parent) {
+
+    distance.assign(num_vertices, -1);
+    parent.assign(num_vertices, -1);
+
+    if(!threads)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    unsigned int words = (num_vertices + 63) / 64;
+    std::unique_ptr<std::atomic<uint64_t>[]> visited(new std::atomic<uint64_t>[words]);
+    for(unsigned int i = 0; i < words; i++)
+        visited[i].store(0);
+
+    // no level can hold more than every vertex, so the frontiers are allocated once and each thread's slice is written in place
+    std::vector<unsigned int> frontier(num_vertices), next(num_vertices);
+    std::vector<unsigned int> claimed(threads, 0);
+    unsigned int frontier_size = 1;
+    int level = 0;
+
+    std::atomic<unsigned int> cursor(0);
+    LevelBarrier barrier(threads);
+
+    visited[root >> 6].store(uint64_t(1) << (root & 63));
+    distance[root] = 0;
+    parent[root] = root;
+    frontier[0] = root;
+
+    auto worker = [&](unsigned int id) {
+
+        const unsigned int chunk = 64;
+        std::vector<unsigned int> local;
+
+        while(true) {
+
+            local.clear();
+
+            for(unsigned int begin = cursor.fetch_add(chunk); begin < frontier_size; begin = cursor.fetch_add(chunk)) {
+
+                unsigned int end = std::min(begin + chunk, frontier_size);
+
+                for(unsigned int i = begin; i < end; i++) {
+
+                    unsigned int u = frontier[i];
+
+                    for(unsigned int j = out.offsets[u]; j < out.offsets[u+1]; j++) {
+
+                        unsigned int v = out.targets[j];
+                        uint64_t bit = uint64_t(1) << (v & 63);
+
+                        // a plain load filters out most of the seen vertices before paying for the atomic claim
+                        if((visited[v >> 6].load(std::memory_order_relaxed) & bit) || (visited[v >> 6].fetch_or(bit) & bit))
+                            continue;
+
+                        distance[v] = level + 1;
+                        parent[v] = u;
+                        local.push_back(v);
+                    }
+                }
+            }
+
+            claimed[id] = local.size();
+            barrier.wait();
+
+            unsigned int offset = 0;
+            for(unsigned int t = 0; t < id; t++)
+                offset += claimed[t];
+
+            std::copy(local.begin(), local.end(), next.begin() + offset);
+            barrier.wait();
+
+            if(id == 0) {
+                frontier.swap(next);
+                frontier_size = 0;
+                for(auto count : claimed)
+                    frontier_size += count;
+                cursor.store(0);
+                level++;
+            }
+
+            barrier.wait();
+
+            if(!frontier_size)
+                return;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for(unsigned int id = 1; id < threads; id++)
+        workers.push_back(std::thread(worker, id));
+
+    worker(0);
+
+    for(auto & thread : workers)
+        thread.join();
+}
+
+// @func - Constructor
+// @args - #1 The number of threads that take part
+inline LevelBarrier::LevelBarrier(unsigned int threads) : num_threads(threads), waiting(0), generation(0) {
+}
+
+// @func - wait
+// @info - The last thread to arrive starts a new generation, everyone else waits for it to change
+inline void LevelBarrier::wait() {
+
+    unsigned int arrived_in = generation.load();
+
+    if(waiting.fetch_add(1) + 1 == num_threads) {
+        waiting.store(0);
+        generation.fetch_add(1);
+    }
+    else {
+        while(generation.load() == arrived_in)
+            std::this_thread::yield();
+    }
+}
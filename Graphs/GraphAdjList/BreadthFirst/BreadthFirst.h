@@ -0,0 +1,100 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - BreadthFirst.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This file declares the options that select how the graph classes run a breadth first search, along with the
+*               direction-optimizing and the multi-threaded searches that they share.
+*
+*   @Details  - A top-down step looks at every edge leaving the frontier, which is wasteful once the frontier holds a large
+*               part of a low diameter graph and most of those edges lead to vertices that have already been seen. A bottom-up
+*               step turns this around, every vertex that hasn't been seen yet looks through the edges entering it for a parent
+*               in the frontier and stops at the first one it finds. The search switches to bottom-up when the edges leaving
+*               the frontier outnumber the edges entering the unseen vertices by a factor of alpha, and back to top-down when
+*               the frontier shrinks below V/beta vertices (Beamer, Asanovic and Patterson). The frontier and the set of seen
+*               vertices are kept as bitmaps so that a bottom-up step can test a parent with a single bit.
+*
+*               The multi-threaded search is level synchronous. One set of worker threads lives for the whole search, each level
+*               they pull chunks of the frontier off a shared cursor, claim the vertices they reach with an atomic fetch_or on the
+*               visited bitmap, and keep the vertices they claimed in a buffer of their own. At the end of the level every thread
+*               copies its buffer into its slice of the next frontier, so the threads never contend on a shared queue.
+**/
+
+#ifndef BREADTH_FIRST_H
+#define BREADTH_FIRST_H
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+// @enum - BreadthFirstStrategy
+// @info - TopDown             - The classic queue based search, every edge leaving a vertex is examined in order.
+//         DirectionOptimizing - Switches between top-down and bottom-up steps, see above. It only reports the edges of the
+//                               search tree, not the edges that were examined along the way.
+enum class BreadthFirstStrategy { TopDown, DirectionOptimizing };
+
+// @struct - BreadthFirstOptions
+// @info   - The third argument to breadthFirst. alpha and beta are the switching thresholds of the direction-optimizing
+//           search, the defaults are the ones Beamer et al. found to work well across graphs.
+struct BreadthFirstOptions
+{
+    BreadthFirstOptions(BreadthFirstStrategy strat = BreadthFirstStrategy::TopDown, unsigned int a = 14, unsigned int b = 24) :
+        strategy(strat), alpha(a), beta(b) {}
+
+    BreadthFirstStrategy strategy;
+    unsigned int alpha;
+    unsigned int beta;
+};
+
+// @struct - AdjacencyView
+// @info   - A compressed sparse row view of a graph, the arcs of vertex i are [offsets[i], offsets[i+1]) of targets and
+//           weights. For the in-arcs of a graph targets holds the source of each arc.
+struct AdjacencyView
+{
+    const unsigned int * offsets;
+    const unsigned int * targets;
+    const double * weights;
+};
+
+// @func - directionOptimizingSearch
+// @args - #1 The number of vertices, #2 the arcs leaving every vertex, #3 the arcs entering every vertex (the same view as #2
+//         for undirected graphs), #4 the id of the root, #5 the thresholds to use, #6 output, the vertex each vertex was
+//         reached from (-1 if it wasn't reached, the root is its own parent), #7 output, the weight of the arc it was reached
+//         along, #8 output, the vertices in the order they were reached, one level after another
+void directionOptimizingSearch(unsigned int, const AdjacencyView &, const AdjacencyView &, unsigned int, const BreadthFirstOptions &,
+                               std::vector<int> &, std::vector<double> &, std::vector<unsigned int> &);
+
+// @func - parallelBreadthFirstSearch
+// @args - #1 The number of vertices, #2 the arcs leaving every vertex, #3 the id of the root, #4 the number of worker threads
+//         (0 for one per hardware thread), #5 output, the number of edges on a shortest path from the root to each vertex
+//         (-1 if it wasn't reached), #6 output, the vertex each vertex was reached from (-1 if it wasn't reached, the root
+//         is its own parent)
+void parallelBreadthFirstSearch(unsigned int, const AdjacencyView &, unsigned int, unsigned int, std::vector<int> &, std::vector<int> &);
+
+// @class - LevelBarrier
+// @info  - Holds the threads that call wait until all of them have, then lets them all through and resets itself. The levels
+//          of a search are short, so the waiting threads yield in a loop rather than sleep on a condition variable.
+class LevelBarrier
+{
+public:
+
+    // @func - Constructor
+    // @args - #1 The number of threads that take part
+    LevelBarrier(unsigned int);
+
+    // @func - wait
+    // @info - Returns once every thread has called wait
+    void wait();
+
+private:
+
+    unsigned int num_threads;
+    std::atomic<unsigned int> waiting;
+    std::atomic<unsigned int> generation;
+};
+
+#include "BreadthFirst.cpp"
+#endif
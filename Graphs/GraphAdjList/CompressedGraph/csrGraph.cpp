@@ -0,0 +1,1546 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - csrGraph.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is my definition of the csrGraph (compressed sparse row graph) class. This class represents a templated,
+*               read-optimized graph that can be either directed or undirected. See csrGraph.h for a description of the
+*               internal representation.
+**/
+
+
+#include "csrGraph.h"
+
+
+//////////////////////////////////////////////////////
+//////////        PUBLIC FUNCTIONS     ///////////////
+//////////////////////////////////////////////////////
+
+// @func - Constructor#1
+// @args - #1 Bool indicating if the graph is directed (true) or undirected (false)
+// @info - Initializes everything to empty
+template<class VertexType>
+csrGraph<VertexType>::csrGraph(bool directed) : is_directed(directed), num_edges(0), offsets(1, 0) {
+
+}
+
+// @func - Constructor#2
+// @args - #1 The directed graph to freeze into this compressed representation
+// @info - Copies every vertex and edge out of the dGraph, the dGraph is not modified.
+template<class VertexType>
+csrGraph<VertexType>::csrGraph(const dGraph<VertexType> & graph) : is_directed(true), num_edges(0), offsets(1, 0) {
+    freeze(graph);
+}
+
+// @func - Constructor#3
+// @args - #1 The undirected graph to freeze into this compressed representation
+// @info - Copies every vertex and edge out of the uGraph, the uGraph is not modified.
+template<class VertexType>
+csrGraph<VertexType>::csrGraph(const uGraph<VertexType> & graph) : is_directed(false), num_edges(0), offsets(1, 0) {
+    freeze(graph);
+}
+
+// @func  - Destructor
+// @info  - Nothing is dynamically allocated by this class, everything lives in std::vectors.
+template<class VertexType>
+csrGraph<VertexType>::~csrGraph() {
+
+}
+
+// @func - destoryGraph
+// @info - deletes all internal vertices and edges
+template<class VertexType>
+bool csrGraph<VertexType>::destroyGraph() {
+
+    vertices.clear();
+    offsets.assign(1, 0);
+    targets.clear();
+    weights.clear();
+    lookup_map.clear();
+    num_edges = 0;
+
+    return true;
+}
+
+// @func   - insertVertex
+// @args   - #1 The value of the node to be inserted
+// @return - Boolean indicating succes
+template<class VertexType>
+bool csrGraph<VertexType>::insertVertex(const VertexType & data) {
+
+    // if true then a vertex with the same data is already in our graph, so return false
+    if(lookup_map.find(data) != lookup_map.end())
+        return false;
+
+    lookup_map.insert(std::make_pair(data, (unsigned int) vertices.size()));
+    vertices.push_back(Vertex<VertexType>(data));
+
+    // the new vertex has no edges, so its edge range is empty and starts where the last one ended
+    offsets.push_back(offsets.back());
+
+    return true;
+}
+
+// @func   - deleteVertex
+// @args   - #1 The value of the node to be deleted
+// @return - Boolean indicating success
+// @info   - Every vertex with a larger id gets shifted down by one, so we have to rebuild all of the arrays.
+template<class VertexType>
+bool csrGraph<VertexType>::deleteVertex(const VertexType & data) {
+
+    int id = findVertex(data);
+
+    if(id == -1)
+        return false;
+
+    std::vector<std::pair<std::pair<unsigned int, unsigned int>, double> > arcs;
+    arcs.reserve(targets.size());
+
+    auto new_id = [id](unsigned int old_id) -> unsigned int { return (old_id > (unsigned int) id)? old_id-1 : old_id; };
+
+    for(unsigned int i = 0; i < vertices.size(); i++) {
+        if(i == (unsigned int) id)
+            continue;
+
+        for(unsigned int j = offsets[i]; j < offsets[i+1]; j++) {
+            if(targets[j] != (unsigned int) id)
+                arcs.push_back(std::make_pair(std::make_pair(new_id(i), new_id(targets[j])), weights[j]));
+        }
+    }
+
+    vertices.erase(vertices.begin() + id);
+    offsets.pop_back();
+    lookup_map.erase(data);
+
+    for(auto & pair : lookup_map) {
+        pair.second = new_id(pair.second);
+    }
+
+    rebuild(arcs);
+
+    return true;
+}
+
+// @func   - getAllVertices
+// @args   - none
+// @return - Vector of the data contained inside all vertices, in order of their ids.
+template<class VertexType>
+std::vector<VertexType> csrGraph<VertexType>::getAllVertices() const {
+
+    std::vector<VertexType> ret;
+    ret.reserve(vertices.size());
+
+    for(auto & vertex : vertices)
+        ret.push_back(vertex.getData());
+
+    return ret;
+}
+
+// @func   - getAllEdges
+// @args   - none
+// @return - Vector of all of the edges in the graph
+template<class VertexType>
+std::vector<Edge<VertexType> > csrGraph<VertexType>::getAllEdges() const {
+
+    std::vector<Edge<VertexType> > edge_list;
+    edge_list.reserve(targets.size());
+
+    for(unsigned int i = 0; i < vertices.size(); i++) {
+        for(unsigned int j = offsets[i]; j < offsets[i+1]; j++) {
+            edge_list.push_back(makeEdge(i, j));
+        }
+    }
+
+    return edge_list;
+}
+
+// @func   - insertVertices
+// @args   - #1 Vector of Vertex data corresponding to the vertices to be added.
+// @return - Boolean indicating success, is false if any of the individual insertions fail
+template<class VertexType>
+bool csrGraph<VertexType>::insertVertices(std::vector<VertexType> new_vertices) {
+
+    bool ret = true;
+
+    for(auto & i : new_vertices) {
+        if(!insertVertex(i))
+            ret = false;
+    }
+
+    return ret;
+}
+
+// @func   - deleteVertices
+// @args   - #1 Vector of Vertex data corresponding to the vertices to be deleted.
+// @return - Boolean indicating success, is false if any of the individual deletions fail
+template<class VertexType>
+bool csrGraph<VertexType>::deleteVertices(std::vector<VertexType> old_vertices) {
+
+    bool ret = true;
+
+    for(auto & i : old_vertices) {
+        if(!deleteVertex(i))
+            ret = false;
+    }
+
+    return ret;
+}
+
+// @func   - insertEdge
+// @args   - #1 The "From" Node, #2 the "To" Node, #3 The weight for this new edge
+// @return - Boolean indicating succes
+template<class VertexType>
+bool csrGraph<VertexType>::insertEdge(const VertexType & v1, const VertexType & v2, double weight) {
+
+    // This assumes we don't want edges between the same vertex
+    if(v1 == v2)
+        return false;
+
+    int id1 = findVertex(v1);
+    int id2 = findVertex(v2);
+
+    if(id1 == -1 || id2 == -1)
+        return false;
+
+    if(!insertArc(id1, id2, weight))
+        return false;
+
+    if(!is_directed)
+        insertArc(id2, id1, weight);
+
+    num_edges++;
+    return true;
+}
+
+// @func   - deleteEdge
+// @args   - #1 The "From" Node, the "To" Node.
+// @return - Boolean indicating succes
+template<class VertexType>
+bool csrGraph<VertexType>::deleteEdge(const VertexType & v1, const VertexType & v2) {
+
+    int id1 = findVertex(v1);
+    int id2 = findVertex(v2);
+
+    if(id1 == -1 || id2 == -1)
+        return false;
+
+    if(!deleteArc(id1, id2))
+        return false;
+
+    if(!is_directed)
+        deleteArc(id2, id1);
+
+    num_edges--;
+    return true;
+}
+
+// @func   - getNumVertices
+// @args   - None
+// @return - The number of vertices currently in the graph.
+template<class VertexType>
+int csrGraph<VertexType>::getNumVertices() const {
+
+    return vertices.size();
+}
+
+// @func   - getNumEdges
+// @args   - None
+// @return - The number of edges currently in the graph.
+template<class VertexType>
+int csrGraph<VertexType>::getNumEdges() const {
+
+    return num_edges;
+}
+
+// @func   - containsVerex
+// @args   - #1 data associated with the vertex that you wish to query for existence
+// @return - Bool corresponding to the existence of a vertex with the given data in this graph
+template<class VertexType>
+bool csrGraph<VertexType>::containsVertex(const VertexType & v) {
+
+    return findVertex(v) != -1;
+}
+
+// @func   - containsEdge
+// @args   - #1 data associated with the 'from' vertex, #2 data associated with the 'to' vertex.
+// @return - Bool corresponding to the existence of an edge in the graph between the two vertices
+template<class VertexType>
+bool csrGraph<VertexType>::containsEdge(const VertexType & src_vert, const VertexType & dest_vert) {
+
+    int id1 = findVertex(src_vert);
+    int id2 = findVertex(dest_vert);
+
+    if(id1 == -1 || id2 == -1)
+        return false;
+
+    return findEdge(id1, id2) != -1;
+}
+
+// @func   - getEdgeWeight
+// @args   - #1 data associated with vetex #1, data associated with vertex #2
+// @return - returns the weight of the edge, throws error if edge not found
+template<class VertexType>
+double csrGraph<VertexType>::getEdgeWeight(const VertexType & v1, const VertexType & v2) {
+
+    int id1 = findVertex(v1);
+    int id2 = findVertex(v2);
+
+    if(id1 == -1 || id2 == -1)
+        throw std::logic_error("Can't find Vertices in Graph");
+
+    int edge = findEdge(id1, id2);
+
+    if(edge == -1)
+        throw std::logic_error("No Edge Exists Between Given Vertices");
+
+    return weights[edge];
+}
+
+// @func   - setEdgeWeight
+// @args   - #1 data associated with source vetex, #2 data associated with destination vertex, #3 new weight to be set
+// @return - returns true if we succeed in changing the value (for both arcs of undirected graphs)
+template<class VertexType>
+bool csrGraph<VertexType>::setEdgeWeight(const VertexType & src_vert, const VertexType & dest_vert, double weight) {
+
+    int id1 = findVertex(src_vert);
+    int id2 = findVertex(dest_vert);
+
+    if(id1 == -1 || id2 == -1)
+        return false;
+
+    int edge1 = findEdge(id1, id2);
+
+    if(edge1 == -1)
+        return false;
+
+    weights[edge1] = weight;
+
+    if(!is_directed) {
+        int edge2 = findEdge(id2, id1);
+        if(edge2 == -1)
+            return false;
+        weights[edge2] = weight;
+    }
+
+    return true;
+}
+
+// @func   - getIncidentEdges
+// @args   - Data contained in vertex that you wish to recieve a list of adjacent vertices of.
+// @return - Vector of the edges that eminate from the given vertex.
+template<class VertexType>
+std::vector<Edge<VertexType> > csrGraph<VertexType>::getIncidentEdges(const VertexType & v1) const {
+
+    int id = findVertex(v1);
+
+    if(id == -1)
+        throw std::logic_error("getIncidentEdges() | Error : Vertex not found in graph\n");
+
+    std::vector<Edge<VertexType> > ret;
+    ret.reserve(offsets[id+1] - offsets[id]);
+
+    for(unsigned int j = offsets[id]; j < offsets[id+1]; j++)
+        ret.push_back(makeEdge(id, j));
+
+    return ret;
+}
+
+// @func   - processVertex
+// @args   - #1 Data contained in vertex that you wish to process, #2 GraphTraveler object that will process the vertex and it's edges
+// @return - Bool indicating if the vertex could be found or not.
+// @info   - This function will look at the source vertex and then examine all of it's edges (by calling the traveler functions)
+template<class VertexType>
+bool csrGraph<VertexType>::processVertex(const VertexType & source, GraphTraveler<VertexType> * traveler) const {
+
+    int id = findVertex(source);
+
+    if(id == -1 || !traveler)
+        return false;
+
+    traveler->starting_vertex(source);
+
+    for(unsigned int j = offsets[id]; j < offsets[id+1]; j++)
+        traveler->examine_edge(makeEdge(id, j));
+
+    traveler->finished_traversal();
+    return true;
+}
+
+// @func   - processVertices
+// @args   - #1 Data contained in vertices that you wish to process, #2 GraphTraveler object that will process the vertex and it's edges
+// @return - Bool indicating if the vertex could be found or not.
+// @info   - This function will look at the all of the vertices in the vector and then examine all of the edges of each vertex
+//           (by calling the appropraite traveler functions)
+template<class VertexType>
+bool csrGraph<VertexType>::processVertices(const std::vector<VertexType> & to_process, GraphTraveler<VertexType> * traveler) const {
+
+    if(!traveler || !to_process.size())
+        return false;
+
+    traveler->starting_vertex(to_process[0]);
+
+    for(auto & vertex : to_process) {
+
+        int id = findVertex(vertex);
+
+        if(id == -1)
+            return false;
+
+        traveler->discover_vertex(vertex);
+
+        for(unsigned int j = offsets[id]; j < offsets[id+1]; j++)
+            traveler->examine_edge(makeEdge(id, j));
+    }
+
+    traveler->finished_traversal();
+    return true;
+}
+
+// @func   - makeGraphDense
+// @args   - #1 A function that takes two vertices and assigns a weight to their edge
+// @return - Bool indicating success
+// @info   - This function removes all current edes from the graph, and instead makes a dense graph out of the current vertices with
+//           edge weighting specified by the argument to the function.
+template<class VertexType>
+bool csrGraph<VertexType>::makeGraphDense(double setWeight(VertexType&, VertexType&)) {
+
+    std::vector<std::pair<std::pair<unsigned int, unsigned int>, double> > arcs;
+    arcs.reserve(vertices.size() * vertices.size());
+
+    for(unsigned int i = 0; i < vertices.size(); i++) {
+        VertexType data1 = vertices[i].getData();
+
+        for(unsigned int j = (is_directed)? 0 : i+1; j < vertices.size(); j++) {
+            if(i == j)
+                continue;
+
+            VertexType data2 = vertices[j].getData();
+            double weight = (setWeight == nullptr)? std::numeric_limits<double>::infinity() : setWeight(data1, data2);
+
+            arcs.push_back(std::make_pair(std::make_pair(i, j), weight));
+            if(!is_directed)
+                arcs.push_back(std::make_pair(std::make_pair(j, i), weight));
+        }
+    }
+
+    rebuild(arcs);
+    return true;
+}
+
+// @func   - reverse
+// @args   - none
+// @return - Bool indicating success
+// @info   - This function switches the direction of all edges, does nothing for undirected graphs.
+template<class VertexType>
+bool csrGraph<VertexType>::reverse() {
+
+    if(!is_directed)
+        return true;
+
+    std::vector<std::pair<std::pair<unsigned int, unsigned int>, double> > arcs;
+    arcs.reserve(targets.size());
+
+    for(unsigned int i = 0; i < vertices.size(); i++) {
+        for(unsigned int j = offsets[i]; j < offsets[i+1]; j++)
+            arcs.push_back(std::make_pair(std::make_pair(targets[j], i), weights[j]));
+    }
+
+    rebuild(arcs);
+    return true;
+}
+
+// @func   - invert
+// @args   - #1 Weighing function that takes in two vertices and assigns a weight to an edge between them
+// @return - Bool indicating success
+// @info   - This function inverts the current graph, which means it removes all existing edges and emplaces all possible edges
+//           that didn't already exist.
+template<class VertexType>
+bool csrGraph<VertexType>::invert(double setWeight(VertexType&, VertexType&)) {
+
+    std::vector<std::pair<std::pair<unsigned int, unsigned int>, double> > arcs;
+
+    for(unsigned int i = 0; i < vertices.size(); i++) {
+        VertexType data1 = vertices[i].getData();
+
+        for(unsigned int j = (is_directed)? 0 : i+1; j < vertices.size(); j++) {
+            if(i == j || findEdge(i, j) != -1)
+                continue;
+
+            VertexType data2 = vertices[j].getData();
+            double weight = (setWeight == nullptr)? std::numeric_limits<double>::infinity() : setWeight(data1, data2);
+
+            arcs.push_back(std::make_pair(std::make_pair(i, j), weight));
+            if(!is_directed)
+                arcs.push_back(std::make_pair(std::make_pair(j, i), weight));
+        }
+    }
+
+    rebuild(arcs);
+    return true;
+}
+
+// @func   - printGraph
+// @args   - none
+// @return - none
+// @info   - prints the adjecency list representation of the graph.
+template<class VertexType>
+void csrGraph<VertexType>::printGraph() const {
+
+    for(unsigned int i = 0; i < vertices.size(); i++) {
+        std::cout << "Vertex : " << vertices[i].getData() << " -> ";
+
+        for(unsigned int j = offsets[i]; j < offsets[i+1]; j++)
+            std::cout << vertices[targets[j]].getData() << ", ";
+
+        std::cout << "\n";
+    }
+    std::cout << "\n\n\n";
+}
+
+// @func   - isConnected
+// @args   - None
+// @return - Bool indicating whether or not the graph is connected
+// @info   - For undirected graphs a single search from vertex 0 has to reach everything. For directed graphs every vertex
+//           must also be able to reach vertex 0, which we check by searching again along the edges backwards.
+template<class VertexType>
+bool csrGraph<VertexType>::isConnected() {
+
+    if(vertices.size() <= 1)
+        return true;
+
+    if(reachable(0, false) != vertices.size())
+        return false;
+
+    return (!is_directed) || reachable(0, true) == vertices.size();
+}
+
+// @func   - isBipartite
+// @args   - None
+// @return - Bool indicating whether or not the graph is bipartite
+template<class VertexType>
+bool csrGraph<VertexType>::isBipartite() {
+
+    if(!vertices.size())
+        return true;
+
+    BipartiteTraveler<VertexType> traveler;
+
+    depthFirst(vertices[0].getData(), &traveler);
+
+    return traveler.is_bipartite;
+}
+
+// @func   - getBipartition
+// @args   - std::pair pointer that will be filled with two vectors of vertices, consisting of one bipartition of the graph
+// @return - Bool indicating whether or not the graph is bipartite and able to be bipartitioned
+template<class VertexType>
+bool csrGraph<VertexType>::getBipartition(std::pair<std::vector<VertexType>, std::vector<VertexType> > * ret) {
+
+    if(!vertices.size())
+        return false;
+
+    BipartiteTraveler<VertexType> traveler;
+
+    depthFirst(vertices[0].getData(), &traveler);
+
+    if(!traveler.is_bipartite)
+        return false;
+
+    std::vector<VertexType> u_vertices, v_vertices;
+
+    for(auto vertex : traveler.vertex_colors) {
+        if(vertex.second)
+            u_vertices.push_back(vertex.first);
+        else
+            v_vertices.push_back(vertex.first);
+    }
+
+    ret->first = u_vertices;
+    ret->second = v_vertices;
+
+    return true;
+}
+
+// @func   - depthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components
+//           as they're discovered.
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - Performs a depth first traversal, calling the appropraite function inside of the Traveler class when it
+//           encounters a new vertex or edge. The marked set and the previous-edge map are flat vectors indexed by id.
+template<class VertexType>
+bool csrGraph<VertexType>::depthFirst(const VertexType & root_data, GraphTraveler<VertexType> * traveler) {
+    SearchWorkspace<VertexType> workspace;
+    return depthFirst(root_data, traveler, workspace);
+}
+
+// @func   - depthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components
+//           as they're discovered, #3 the workspace to keep the bookkeeping of the search in
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - Runs the visitor version below through a TravelerAdapter, or with no callbacks at all for a null traveler.
+template<class VertexType>
+bool csrGraph<VertexType>::depthFirst(const VertexType & root_data, GraphTraveler<VertexType> * traveler, SearchWorkspace<VertexType> & workspace) {
+
+    if(traveler == nullptr)
+        return depthFirst(root_data, NullVisitor(), workspace);
+
+    return depthFirst(root_data, TravelerAdapter<VertexType>(*traveler), workspace);
+}
+
+// @func   - depthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 any visitor (see Visitor.h)
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+template<class VertexType>
+template<class Visitor, class>
+bool csrGraph<VertexType>::depthFirst(const VertexType & root_data, Visitor && visitor) {
+    SearchWorkspace<VertexType> workspace;
+    return depthFirst(root_data, std::forward<Visitor>(visitor), workspace);
+}
+
+// @func   - depthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 any visitor (see Visitor.h), #3 the workspace to
+//           keep the bookkeeping of the search in
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - The stack and the marks live in the workspace, so a caller that reuses it doesn't allocate anything. The
+//           callbacks the visitor doesn't have are compiled out of the loop.
+template<class VertexType>
+template<class Visitor, class>
+bool csrGraph<VertexType>::depthFirst(const VertexType & root_data, Visitor && visitor, SearchWorkspace<VertexType> & workspace) {
+
+    int root = findVertex(root_data);
+
+    if(root == -1)
+        return false;
+
+    workspace.begin(vertices.size());
+
+    // an Edge only gets built for the callbacks the visitor actually has
+    typedef typename std::remove_reference<Visitor>::type visitor_type;
+    const bool examines = HasExamineEdge<visitor_type, Edge<VertexType> >::value;
+    const bool traverses = HasTraverseEdge<visitor_type, Edge<VertexType> >::value;
+
+    // the stack and the marks live in the workspace, the arc each vertex was reached along is kept with it
+    std::vector<unsigned int> & stack = workspace.getFrontier();
+
+    visitStartingVertex(visitor, root_data);
+
+    workspace.reach(root);
+    stack.push_back(root);
+
+    while(stack.size()) {
+
+        unsigned int current = stack.back(); stack.pop_back();
+
+        if(traverses && workspace.getArc(current) != -1)
+            visitTraverseEdge(visitor, makeEdge(workspace.getPrevious(current), workspace.getArc(current)));
+
+        for(unsigned int j = offsets[current]; j < offsets[current+1]; j++) {
+
+            if(examines) visitExamineEdge(visitor, makeEdge(current, j));
+
+            unsigned int target = targets[j];
+
+            if(!workspace.isReached(target)) {
+                workspace.reach(target, current);
+                workspace.setArc(target, j);
+                stack.push_back(target);
+            }
+        }
+    }
+
+    visitFinishedTraversal(visitor);
+
+    return true;
+}
+
+// @func   - breadthFirst
+// @args   - #1 Data associated with the starting vertex for the search,  #2 Traveler class to process the graph
+//           components as they're discovered.
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - Performs a breadth first traversal, calling the appropriate function inside of the Traveler class when
+//           it encounters a new vertex or edge.
+template<class VertexType>
+bool csrGraph<VertexType>::breadthFirst(const VertexType & root_data, GraphTraveler<VertexType> * traveler) {
+    SearchWorkspace<VertexType> workspace;
+    return breadthFirst(root_data, traveler, workspace);
+}
+
+// @func   - breadthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components
+//           as they're discovered, #3 the workspace to keep the bookkeeping of the search in
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - Runs the visitor version below through a TravelerAdapter, or with no callbacks at all for a null traveler.
+template<class VertexType>
+bool csrGraph<VertexType>::breadthFirst(const VertexType & root_data, GraphTraveler<VertexType> * traveler, SearchWorkspace<VertexType> & workspace) {
+
+    if(traveler == nullptr)
+        return breadthFirst(root_data, NullVisitor(), workspace);
+
+    return breadthFirst(root_data, TravelerAdapter<VertexType>(*traveler), workspace);
+}
+
+// @func   - breadthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 any visitor (see Visitor.h)
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+template<class VertexType>
+template<class Visitor, class>
+bool csrGraph<VertexType>::breadthFirst(const VertexType & root_data, Visitor && visitor) {
+    SearchWorkspace<VertexType> workspace;
+    return breadthFirst(root_data, std::forward<Visitor>(visitor), workspace);
+}
+
+// @func   - breadthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 any visitor (see Visitor.h), #3 the workspace to
+//           keep the bookkeeping of the search in
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - The queue and the marks live in the workspace, so a caller that reuses it doesn't allocate anything. The
+//           callbacks the visitor doesn't have are compiled out of the loop.
+template<class VertexType>
+template<class Visitor, class>
+bool csrGraph<VertexType>::breadthFirst(const VertexType & root_data, Visitor && visitor, SearchWorkspace<VertexType> & workspace) {
+
+    int root = findVertex(root_data);
+
+    if(root == -1)
+        return false;
+
+    workspace.begin(vertices.size());
+
+    // an Edge only gets built for the callbacks the visitor actually has
+    typedef typename std::remove_reference<Visitor>::type visitor_type;
+    const bool examines = HasExamineEdge<visitor_type, Edge<VertexType> >::value;
+    const bool traverses = HasTraverseEdge<visitor_type, Edge<VertexType> >::value;
+
+    // the queue and the marks live in the workspace, the arc each vertex was reached along is kept with it
+    std::vector<unsigned int> & queue = workspace.getFrontier();
+
+    visitStartingVertex(visitor, root_data);
+
+    workspace.reach(root, -1, 0);
+    queue.push_back(root);
+
+    // the queue never shrinks, we just walk a read index through it since every vertex is enqueued at most once
+    for(unsigned int head = 0; head < queue.size(); head++) {
+
+        unsigned int current = queue[head];
+
+        if(traverses && workspace.getArc(current) != -1)
+            visitTraverseEdge(visitor, makeEdge(workspace.getPrevious(current), workspace.getArc(current)));
+
+        for(unsigned int j = offsets[current]; j < offsets[current+1]; j++) {
+
+            if(examines) visitExamineEdge(visitor, makeEdge(current, j));
+
+            unsigned int target = targets[j];
+
+            if(!workspace.isReached(target)) {
+                workspace.reach(target, current, workspace.getDistance(current) + 1);
+                workspace.setArc(target, j);
+                queue.push_back(target);
+            }
+        }
+    }
+
+    visitFinishedTraversal(visitor);
+
+    return true;
+}
+
+// @func   - breadthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components as
+//           they're discovered, #3 which strategy to search with
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - Searches straight over the compressed arrays, see BreadthFirst.h.
+template<class VertexType>
+bool csrGraph<VertexType>::breadthFirst(const VertexType & root_data, GraphTraveler<VertexType> * traveler, const BreadthFirstOptions & options) {
+
+    if(options.strategy == BreadthFirstStrategy::TopDown)
+        return breadthFirst(root_data, traveler);
+
+    int root = findVertex(root_data);
+
+    if(root == -1)
+        return false;
+
+    AdjacencyView out = { offsets.data(), targets.data(), weights.data() };
+    AdjacencyView in = out;
+
+    // an undirected graph stores every edge in both directions, a directed one needs its in-arcs packed separately
+    std::vector<unsigned int> in_offsets, in_sources;
+    std::vector<double> in_weights;
+
+    if(is_directed) {
+        transpose(in_offsets, in_sources, in_weights);
+        in = { in_offsets.data(), in_sources.data(), in_weights.data() };
+    }
+
+    std::vector<int> parent;
+    std::vector<double> parent_weight;
+    std::vector<unsigned int> order;
+
+    directionOptimizingSearch(vertices.size(), out, in, root, options, parent, parent_weight, order);
+
+    if(traveler) {
+
+        traveler->starting_vertex(root_data);
+
+        for(unsigned int i = 1; i < order.size(); i++)
+            traveler->traverse_edge(Edge<VertexType>(const_cast<Vertex<VertexType> *>(&vertices[parent[order[i]]]), const_cast<Vertex<VertexType> *>(&vertices[order[i]]), parent_weight[order[i]]));
+
+        traveler->finished_traversal();
+    }
+
+    return true;
+}
+
+// @func   - parallelBreadthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 distance output, #3 parent output, #4 the number
+//           of threads to search with (0 for one per hardware thread)
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - Searches straight over the compressed arrays with parallelBreadthFirstSearch, see BreadthFirst.h.
+template<class VertexType>
+bool csrGraph<VertexType>::parallelBreadthFirst(const VertexType & root_data, std::vector<int> & distance, std::vector<int> & parent, unsigned int threads) const {
+
+    int root = findVertex(root_data);
+
+    if(root == -1)
+        return false;
+
+    AdjacencyView out = { offsets.data(), targets.data(), weights.data() };
+    parallelBreadthFirstSearch(vertices.size(), out, root, threads, distance, parent);
+
+    return true;
+}
+
+// @func   - deltaStepping
+// @args   - #1 Data contained in the source vertex, #2 dist output, #3 prev output, #4 the bucket width and number of threads
+// @return - Bool indicating if the function could find the source vertex based on arg#1
+// @info   - Searches straight over the compressed arrays with deltaSteppingSearch, see ShortestPath.h.
+template<class VertexType>
+bool csrGraph<VertexType>::deltaStepping(const VertexType & source, std::vector<double> & dist, std::vector<int> & prev, const DeltaSteppingOptions & options) const {
+
+    int src = findVertex(source);
+
+    if(src == -1)
+        return false;
+
+    AdjacencyView out = { offsets.data(), targets.data(), weights.data() };
+    deltaSteppingSearch(vertices.size(), out, src, options, dist, prev);
+
+    return true;
+}
+
+// @func   - shortestPaths
+// @args   - #1 The (source, destination) pairs, #2 output, the answers, #3 the number of threads
+// @return - Bool, false if any of the vertices isn't in the graph
+// @info   - Looks every vertex up once, then hands the dense ids to batchShortestPaths, see ShortestPath.h.
+template<class VertexType>
+bool csrGraph<VertexType>::shortestPaths(const std::vector<std::pair<VertexType, VertexType> > & queries, ShortestPathBatch & result, unsigned int threads) const {
+
+    std::vector<std::pair<unsigned int, unsigned int> > ids;
+    ids.reserve(queries.size());
+
+    for(auto & query : queries) {
+
+        int source = findVertex(query.first), destination = findVertex(query.second);
+
+        if(source == -1 || destination == -1)
+            return false;
+
+        ids.push_back(std::make_pair((unsigned int) source, (unsigned int) destination));
+    }
+
+    AdjacencyView out = { offsets.data(), targets.data(), weights.data() };
+    batchShortestPaths(vertices.size(), out, ids, threads, result);
+
+    return true;
+}
+
+// @func   - shortestPathTrees
+// @args   - #1 The sources, #2 output, the trees, #3 the number of threads
+// @return - Bool, false if any of the sources isn't in the graph
+// @info   - Looks every source up once, then hands the dense ids to batchShortestPathTrees, see ShortestPath.h.
+template<class VertexType>
+bool csrGraph<VertexType>::shortestPathTrees(const std::vector<VertexType> & sources, ShortestPathTrees & result, unsigned int threads) const {
+
+    std::vector<unsigned int> ids;
+    ids.reserve(sources.size());
+
+    for(auto & source : sources) {
+
+        int id = findVertex(source);
+
+        if(id == -1)
+            return false;
+
+        ids.push_back(id);
+    }
+
+    AdjacencyView out = { offsets.data(), targets.data(), weights.data() };
+    batchShortestPathTrees(vertices.size(), out, ids, threads, result);
+
+    return true;
+}
+
+// @func   - minimumCut
+// @args   - #1 Optional output, the total weight of the edges that cross the cut
+// @return - 2 column vector of vertices, each column representing one half of the cut.
+// @info   - Runs the Stoer-Wagner algorithm, see the version below that takes a MinimumCutOptions.
+template<class VertexType>
+std::vector<std::vector<VertexType> > csrGraph<VertexType>::minimumCut(double * cut_weight) {
+    return minimumCut(cut_weight, MinimumCutOptions());
+}
+
+// @func   - minimumCut
+// @args   - #1 Optional output, the total weight of the edges that cross the cut, #2 which algorithm to use and how to run it
+// @return - 2 column vector of vertices, each column representing one half of the cut. Empty if the graph has fewer than
+//           two vertices.
+// @info   - Runs the algorithm the options pick (see MinimumCut.h), edges are counted whichever way they point.
+template<class VertexType>
+std::vector<std::vector<VertexType> > csrGraph<VertexType>::minimumCut(double * cut_weight, const MinimumCutOptions & options) {
+
+    std::vector<std::vector<VertexType> > ret;
+
+    if(cut_weight) *cut_weight = 0;
+
+    if(vertices.size() < 2)
+        return ret;
+
+    std::vector<WeightedArc> arcs;
+    arcs.reserve(getNumEdges());
+
+    // undirected graphs store each edge in both directions, only hand it over once
+    for(unsigned int i = 0; i < vertices.size(); i++)
+        for(unsigned int j = offsets[i]; j < offsets[i+1]; j++)
+            if(is_directed || targets[j] > i)
+                arcs.push_back(WeightedArc{i, targets[j], weights[j]});
+
+    std::vector<bool> side;
+    double weight = 0;
+    if(options.algorithm == MinimumCutAlgorithm::KargerStein)
+        weight = kargerSteinCut(vertices.size(), arcs, side, options.trials, options.threads, options.seed);
+    else
+        weight = stoerWagnerCut(vertices.size(), arcs, side);
+
+    ret.resize(2);
+    for(unsigned int i = 0; i < vertices.size(); i++)
+        ret[side[i]].push_back(vertices[i].getData());
+
+    if(cut_weight) *cut_weight = weight;
+
+    return ret;
+}
+
+// @func   - minimuminSpanningTree
+// @args   - #1 GraphTraveler object that is used to build the minimum spanning tree
+// @return - Boolean that indicates if the minimum tree could be traversed or not, false if the graph is not connected
+// @info   - Prim's algorithm starting from vertex 0, using a binary heap with lazy deletion over (weight, edge index) pairs.
+//           For directed graphs the tree is grown along out-edges, just like the dGraph class does.
+template<class VertexType>
+bool csrGraph<VertexType>::minimumSpanningTree(GraphTraveler<VertexType> * traveler) {
+
+    // A non connected graph cannot be spanned
+    if(!vertices.size() || !isConnected())
+        return false;
+
+    // (weight, edge index) pairs, the source of an edge index is recovered through src_of
+    typedef std::pair<double, unsigned int> weight_edge_pair;
+    std::priority_queue<weight_edge_pair, std::vector<weight_edge_pair>, std::greater<weight_edge_pair> > queue;
+
+    std::vector<bool> mst_set(vertices.size(), false);
+    std::vector<unsigned int> src_of(targets.size());
+
+    for(unsigned int i = 0; i < vertices.size(); i++)
+        for(unsigned int j = offsets[i]; j < offsets[i+1]; j++)
+            src_of[j] = i;
+
+    unsigned int in_tree = 0;
+
+    auto add_vertex = [&](unsigned int id) {
+        mst_set[id] = true;
+        in_tree++;
+
+        for(unsigned int j = offsets[id]; j < offsets[id+1]; j++) {
+            if(traveler) traveler->examine_edge(makeEdge(id, j));
+            if(!mst_set[targets[j]])
+                queue.push(std::make_pair(weights[j], j));
+        }
+    };
+
+    if(traveler) traveler->starting_vertex(vertices[0].getData());
+
+    add_vertex(0);
+
+    while(in_tree != vertices.size() && !queue.empty()) {
+
+        unsigned int edge = queue.top().second; queue.pop();
+
+        // stale entry, the target was already pulled into the tree through a cheaper edge
+        if(mst_set[targets[edge]])
+            continue;
+
+        if(traveler) traveler->traverse_edge(makeEdge(src_of[edge], edge));
+
+        add_vertex(targets[edge]);
+    }
+
+    if(traveler) traveler->finished_traversal();
+
+    return in_tree == vertices.size();
+}
+
+// @func   - dijkstrasMinimumTree
+// @args   - #1 Data contained in starting vertex for search, #2 optional destination vertex, if null we will
+//           find the path to every node otherwise we stop when we find the destination node
+// @return - A pair containing two maps. The first map takes a vertex and returns the previuos vertex in the
+//           path there from the source vertex.The second map takes a vertex and gives the total weight that
+//           it takes to get there from the source vertex.
+// @info   - Throws an exception if the source vertex is not contained in the graph.
+template<class VertexType>
+typename csrGraph<VertexType>::dist_prev_pair * csrGraph<VertexType>::dijkstrasMinimumTree(const VertexType & source, const VertexType * dest) {
+
+    int src = findVertex(source);
+
+    if(src == -1)
+        throw std::logic_error("Source Vertex Not in Graph\n");
+
+    int dst = (dest == nullptr)? -1 : findVertex(*dest);
+
+    SearchWorkspace<VertexType> workspace;
+    dijkstras(src, dst, workspace);
+
+    // translate the flat arrays back into vertex data at the API boundary
+    typename csrGraph<VertexType>::dist_prev_pair * ret = new csrGraph<VertexType>::dist_prev_pair();
+
+    ret->second.reserve(vertices.size());
+
+    for(unsigned int i = 0; i < vertices.size(); i++) {
+        ret->second.insert(std::make_pair(vertices[i].getData(), workspace.getDistance(i)));
+        if(workspace.getPrevious(i) != -1)
+            ret->first.insert(std::make_pair(vertices[i].getData(), vertices[workspace.getPrevious(i)].getData()));
+    }
+
+    return ret;
+}
+
+// @func   - dijkstrasMinimumTree
+// @args   - #1 Data contained in starting vertex for search, #2 the workspace to leave the results in, #3 optional
+//           destination vertex, if null we will find the path to every node otherwise we stop when we find it
+// @info   - Leaves the distances and predecessors in the workspace instead of building maps, see the version in dGraph.
+//           Throws an exception if the source vertex is not contained in the graph.
+template<class VertexType>
+void csrGraph<VertexType>::dijkstrasMinimumTree(const VertexType & source, SearchWorkspace<VertexType> & workspace, const VertexType * dest) {
+
+    int src = findVertex(source);
+
+    if(src == -1)
+        throw std::logic_error("Source Vertex Not in Graph\n");
+
+    dijkstras(src, (dest == nullptr)? -1 : findVertex(*dest), workspace);
+}
+
+// @func   - dijkstrasShortestPath
+// @args   - #1 Source Vertex, #2 Dest Vertex, #3 the GraphTraveler-derived object that will recieve the vertices and edges in minimum order
+// @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+// @info   - This decodes the flat prev array directly instead of going through the maps that dijkstrasMinimumTree returns.
+template<class VertexType>
+bool csrGraph<VertexType>::dijkstrasShortestPath(const VertexType & src_data, const VertexType & dest_data, GraphTraveler<VertexType> * traveler) {
+    SearchWorkspace<VertexType> workspace;
+    return dijkstrasShortestPath(src_data, dest_data, traveler, workspace);
+}
+
+// @func   - dijkstrasShortestPath
+// @args   - #1 Source Vertex, #2 Dest Vertex, #3 the GraphTraveler-derived object that will recieve the vertices and edges in
+//           minimum order, #4 the workspace to run the search in
+// @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+// @info   - Runs the visitor version below through a TravelerAdapter, or with no callbacks at all for a null traveler.
+template<class VertexType>
+bool csrGraph<VertexType>::dijkstrasShortestPath(const VertexType & src_data, const VertexType & dest_data, GraphTraveler<VertexType> * traveler, SearchWorkspace<VertexType> & workspace) {
+
+    if(traveler == nullptr)
+        return dijkstrasShortestPath(src_data, dest_data, NullVisitor(), workspace);
+
+    return dijkstrasShortestPath(src_data, dest_data, TravelerAdapter<VertexType>(*traveler), workspace);
+}
+
+// @func   - dijkstrasShortestPath
+// @args   - #1 Source Vertex, #2 Dest Vertex, #3 any visitor (see Visitor.h) to hand the path to
+// @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+template<class VertexType>
+template<class Visitor, class>
+bool csrGraph<VertexType>::dijkstrasShortestPath(const VertexType & src_data, const VertexType & dest_data, Visitor && visitor) {
+    SearchWorkspace<VertexType> workspace;
+    return dijkstrasShortestPath(src_data, dest_data, std::forward<Visitor>(visitor), workspace);
+}
+
+// @func   - dijkstrasShortestPath
+// @args   - #1 Source Vertex, #2 Dest Vertex, #3 any visitor (see Visitor.h) to hand the path to, #4 the workspace to run the
+//           search in
+// @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+// @info   - The search and the path it finds are kept in the workspace, so a caller that reuses it doesn't allocate anything.
+template<class VertexType>
+template<class Visitor, class>
+bool csrGraph<VertexType>::dijkstrasShortestPath(const VertexType & src_data, const VertexType & dest_data, Visitor && visitor, SearchWorkspace<VertexType> & workspace) {
+
+    int src = findVertex(src_data);
+    int dest = findVertex(dest_data);
+
+    if(src == -1 || dest == -1)
+        throw std::logic_error("SRC or DEST Vertices Do Not Exist in Graph\n");
+
+    if(src == dest) {
+        visitStartingVertex(visitor, src_data);
+        visitFinishedTraversal(visitor);
+        return true;
+    }
+
+    dijkstras(src, dest, workspace);
+
+    if(workspace.getPrevious(dest) == -1)
+        return false;
+
+    visitStartingVertex(visitor, src_data);
+
+    // the path only has to be walked for a visitor that wants its edges
+    if(HasTraverseEdge<typename std::remove_reference<Visitor>::type, Edge<VertexType> >::value) {
+
+        // walk backwards from the destination to recover the path, then hand it to the visitor front to back. The
+        // workspace kept the arc every vertex was reached along, so no edges have to be looked up
+        std::vector<unsigned int> & path = workspace.getFrontier();
+        path.clear();
+        for(int current = dest; current != src; current = workspace.getPrevious(current))
+            path.push_back(current);
+
+        for(int i = path.size()-1; i >= 0; --i)
+            visitTraverseEdge(visitor, makeEdge(workspace.getPrevious(path[i]), workspace.getArc(path[i])));
+    }
+
+    visitFinishedTraversal(visitor);
+
+    return true;
+}
+
+// @func   - aStar
+// @args   - #1 Data contained in starting vertex for search, #2 Vector of possible goal vertices to reach, #3 Pointer to a
+//           hueristic function on a given node, nullptr turns the search into Dijkstra's algorithm
+// @return - Vector containing, in-order, the vertices to take to reach your goal. Empty if you are there or no path exists.
+// @info   - Performs the A* path-finding algorithm to get from a starting vertex to any goal vertex in a list of vertices.
+template<class VertexType>
+std::vector<VertexType> csrGraph<VertexType>::aStar(const VertexType & start, std::vector<VertexType> goals, double hueristic(VertexType&, VertexType&)) {
+
+    if(hueristic == nullptr)
+        return aStar(start, goals, [](VertexType &, VertexType &) { return 0.0; });
+
+    return aStar<double (*)(VertexType&, VertexType&)>(start, goals, hueristic);
+}
+
+// @func   - aStar
+// @args   - #1 Data contained in starting vertex for search, #2 Vector of possible goal vertices to reach, #3 Any callable
+//           taking (VertexType&, VertexType&) that estimates the distance from a vertex to a goal, #4 optional pointer
+//           that gets the number of vertices the search expanded
+// @return - Vector containing, in-order, the vertices to take to reach the closest goal (not including the start).
+// @info   - This is Dijkstra's algorithm over the dense vertex ids with every priority raised by the estimate of the vertex,
+//           the estimate is only computed once per vertex, the first time the search reaches it.
+template<class VertexType>
+template<class Heuristic, class>
+std::vector<VertexType> csrGraph<VertexType>::aStar(const VertexType & start, const std::vector<VertexType> & goals, Heuristic hueristic, unsigned int * expanded) {
+
+    std::vector<VertexType> path;
+
+    if(expanded != nullptr)
+        *expanded = 0;
+
+    int start_id = findVertex(start);
+
+    if(start_id == -1)
+        return path;
+
+    unsigned int src = start_id;
+
+    std::vector<bool> is_goal(vertices.size(), false);
+    std::vector<VertexType> goal_data;
+
+    for(auto & goal : goals) {
+        int id = findVertex(goal);
+        if(id != -1 && !is_goal[id]) {
+            is_goal[id] = true;
+            goal_data.push_back(goal);
+        }
+    }
+
+    // we are either already there or there is nowhere to go
+    if(goal_data.empty() || is_goal[src])
+        return path;
+
+    // the heuristic takes non-const references to match the GraphInterface signature, it shouldn't modify the vertex
+    auto estimate = [&](unsigned int id) -> double {
+        VertexType & data = const_cast<VertexType &>(vertices[id].getData());
+        double best = std::numeric_limits<double>::infinity();
+        for(auto & goal : goal_data)
+            best = std::min(best, (double) hueristic(data, goal));
+        return best;
+    };
+
+    std::vector<double> dist(vertices.size(), std::numeric_limits<double>::infinity());
+    std::vector<double> guess(vertices.size(), 0.0);
+    std::vector<int> prev(vertices.size(), -1);
+    IndexedHeap<double> queue(vertices.size());
+
+    dist[src] = 0;
+    guess[src] = estimate(src);
+    queue.push(src, guess[src]);
+
+    while(!queue.empty()) {
+
+        unsigned int current = queue.pop();
+
+        if(expanded != nullptr)
+            (*expanded)++;
+
+        if(is_goal[current]) {
+            for(int at = current; at != (int) src; at = prev[at])
+                path.push_back(vertices[at].getData());
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+
+        for(unsigned int index = offsets[current]; index < offsets[current+1]; index++) {
+
+            unsigned int target = targets[index];
+            double temp_weight = dist[current] + weights[index];
+
+            if(temp_weight < dist[target]) {
+
+                // first time we've seen this vertex
+                if(dist[target] == std::numeric_limits<double>::infinity())
+                    guess[target] = estimate(target);
+
+                // an inconsistent heuristic can make us reopen an expanded vertex, pushOrDecrease handles both cases
+                dist[target] = temp_weight;
+                prev[target] = current;
+                queue.pushOrDecrease(target, temp_weight + guess[target]);
+            }
+        }
+    }
+
+    return path;
+}
+
+// @func   - isDirected
+// @args   - None
+// @return - True if this is a directed graph, false if it is undirected
+template<class VertexType>
+bool csrGraph<VertexType>::isDirected() const {
+    return is_directed;
+}
+
+// @func   - getVertexId
+// @args   - #1 Data contained in the vertex to look up
+// @return - The dense integer id of the vertex, -1 if the vertex is not in the graph
+template<class VertexType>
+int csrGraph<VertexType>::getVertexId(const VertexType & data) const {
+    return findVertex(data);
+}
+
+// @func   - getVertexData
+// @args   - #1 Dense integer id of a vertex
+// @return - The data contained in the vertex with that id, throws an error if the id is out of range
+template<class VertexType>
+VertexType csrGraph<VertexType>::getVertexData(unsigned int id) const {
+
+    if(id >= vertices.size())
+        throw std::logic_error("getVertexData() | Error : Vertex id out of range\n");
+
+    return vertices[id].getData();
+}
+
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////         PRIVATE FUNCTIONS        //////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// @func   - freeze
+// @args   - #1 The graph to copy all vertices and edges out of
+// @info   - The first pass assigns ids and counts the edges of every vertex, the second pass fills in the edge arrays.
+template<class VertexType>
+void csrGraph<VertexType>::freeze(const GraphInterface<VertexType> & graph) {
+
+    destroyGraph();
+
+    std::vector<VertexType> all_vertices = graph.getAllVertices();
+
+    vertices.reserve(all_vertices.size());
+    offsets.reserve(all_vertices.size()+1);
+    lookup_map.reserve(all_vertices.size());
+
+    for(auto & data : all_vertices)
+        insertVertex(data);
+
+    std::vector<std::pair<std::pair<unsigned int, unsigned int>, double> > arcs;
+    arcs.reserve(2*graph.getNumEdges());
+
+    for(unsigned int i = 0; i < all_vertices.size(); i++) {
+        for(auto & edge : graph.getIncidentEdges(all_vertices[i]))
+            arcs.push_back(std::make_pair(std::make_pair(i, lookup_map.at(edge.getTarget()->getData())), edge.getWeight()));
+    }
+
+    rebuild(arcs);
+}
+
+// @func   - findVertex
+// @args   - #1 Value contained in the vertex to be found
+// @return - The id of the vertex, or -1 if it isn't in the graph
+template<class VertexType>
+int csrGraph<VertexType>::findVertex(const VertexType & data) const {
+
+    auto get = lookup_map.find(data);
+
+    if(get == lookup_map.end())
+        return -1;
+
+    return get->second;
+}
+
+// @func   - findEdge
+// @args   - #1 id of the source vertex, #2 id of the target vertex
+// @return - Index into the targets/weights arrays for the edge, or -1 if there is no such edge
+template<class VertexType>
+int csrGraph<VertexType>::findEdge(unsigned int src, unsigned int dest) const {
+
+    auto begin = targets.begin() + offsets[src];
+    auto end = targets.begin() + offsets[src+1];
+    auto get = std::lower_bound(begin, end, dest);
+
+    if(get == end || *get != dest)
+        return -1;
+
+    return get - targets.begin();
+}
+
+// @func   - insertArc
+// @args   - #1 id of the source vertex, #2 id of the target vertex, #3 weight of the edge
+// @return - False if the edge already exists
+template<class VertexType>
+bool csrGraph<VertexType>::insertArc(unsigned int src, unsigned int dest, double weight) {
+
+    auto begin = targets.begin() + offsets[src];
+    auto end = targets.begin() + offsets[src+1];
+    auto get = std::lower_bound(begin, end, dest);
+
+    // no parallel edges
+    if(get != end && *get == dest)
+        return false;
+
+    unsigned int index = get - targets.begin();
+
+    targets.insert(targets.begin() + index, dest);
+    weights.insert(weights.begin() + index, weight);
+
+    for(unsigned int i = src+1; i < offsets.size(); i++)
+        offsets[i]++;
+
+    return true;
+}
+
+// @func   - deleteArc
+// @args   - #1 id of the source vertex, #2 id of the target vertex
+// @return - False if the edge doesn't exist
+template<class VertexType>
+bool csrGraph<VertexType>::deleteArc(unsigned int src, unsigned int dest) {
+
+    int index = findEdge(src, dest);
+
+    if(index == -1)
+        return false;
+
+    targets.erase(targets.begin() + index);
+    weights.erase(weights.begin() + index);
+
+    for(unsigned int i = src+1; i < offsets.size(); i++)
+        offsets[i]--;
+
+    return true;
+}
+
+// @func   - rebuild
+// @args   - #1 Vector of (source id, target id, weight) arcs, all ids must be valid
+// @info   - This is a counting sort on the source id followed by a sort of each edge range by target id. Duplicate arcs
+//           and self loops are dropped so the result obeys the same rules as insertEdge.
+template<class VertexType>
+void csrGraph<VertexType>::rebuild(std::vector<std::pair<std::pair<unsigned int, unsigned int>, double> > & arcs) {
+
+    unsigned int n = vertices.size();
+
+    offsets.assign(n+1, 0);
+
+    for(auto & arc : arcs)
+        offsets[arc.first.first+1]++;
+
+    for(unsigned int i = 0; i < n; i++)
+        offsets[i+1] += offsets[i];
+
+    targets.assign(arcs.size(), 0);
+    weights.assign(arcs.size(), 0.0);
+
+    std::vector<unsigned int> position(offsets.begin(), offsets.end()-1);
+
+    for(auto & arc : arcs) {
+        unsigned int index = position[arc.first.first]++;
+        targets[index] = arc.first.second;
+        weights[index] = arc.second;
+    }
+
+    // sort every edge range by target id and squeeze out any self loops or duplicates
+    std::vector<std::pair<unsigned int, double> > range;
+    unsigned int write = 0;
+
+    for(unsigned int i = 0; i < n; i++) {
+
+        range.clear();
+        for(unsigned int j = offsets[i]; j < offsets[i+1]; j++)
+            range.push_back(std::make_pair(targets[j], weights[j]));
+
+        std::stable_sort(range.begin(), range.end(),
+            [](const std::pair<unsigned int, double> & a, const std::pair<unsigned int, double> & b) { return a.first < b.first; });
+
+        offsets[i] = write;
+
+        for(unsigned int k = 0; k < range.size(); k++) {
+            if(range[k].first == i || (k && range[k].first == range[k-1].first))
+                continue;
+
+            targets[write] = range[k].first;
+            weights[write] = range[k].second;
+            write++;
+        }
+    }
+
+    offsets[n] = write;
+    targets.resize(write);
+    weights.resize(write);
+
+    num_edges = (is_directed)? write : write/2;
+}
+
+// @func   - makeEdge
+// @args   - #1 id of the source vertex, #2 index of the edge in the targets/weights arrays
+// @return - An Edge object pointing at our internal vertices, used to talk to the GraphTraveler objects
+// @info   - The Edge class wants non-const vertex pointers, but the traveler only ever receives a const reference to the
+//           edge so it is safe to cast away the constness here.
+template<class VertexType>
+Edge<VertexType> csrGraph<VertexType>::makeEdge(unsigned int src, unsigned int edge) const {
+
+    return Edge<VertexType>(const_cast<Vertex<VertexType> *>(&vertices[src]),
+                            const_cast<Vertex<VertexType> *>(&vertices[targets[edge]]),
+                            weights[edge]);
+}
+
+// @func   - reachable
+// @args   - #1 id of the starting vertex, #2 bool, if true we follow edges backwards
+// @return - The number of vertices that can be reached from the starting vertex
+// @info   - To follow edges backwards we first build the transposed offset/source arrays, which costs O(V+E).
+template<class VertexType>
+unsigned int csrGraph<VertexType>::reachable(unsigned int start, bool backwards) const {
+
+    unsigned int n = vertices.size();
+
+    const std::vector<unsigned int> * adj_offsets = &offsets;
+    const std::vector<unsigned int> * adj_targets = &targets;
+
+    std::vector<unsigned int> rev_offsets, rev_targets;
+    std::vector<double> rev_weights;
+
+    if(backwards) {
+        transpose(rev_offsets, rev_targets, rev_weights);
+        adj_offsets = &rev_offsets;
+        adj_targets = &rev_targets;
+    }
+
+    std::vector<bool> marked(n, false);
+    std::vector<unsigned int> stack(1, start);
+    unsigned int count = 1;
+    marked[start] = true;
+
+    while(stack.size()) {
+        unsigned int current = stack.back(); stack.pop_back();
+
+        for(unsigned int j = (*adj_offsets)[current]; j < (*adj_offsets)[current+1]; j++) {
+            unsigned int target = (*adj_targets)[j];
+            if(!marked[target]) {
+                marked[target] = true;
+                count++;
+                stack.push_back(target);
+            }
+        }
+    }
+
+    return count;
+}
+
+// @func   - dijkstras
+// @args   - #1 id of the source vertex, #2 id of the destination vertex (-1 for none), #3 the workspace to leave the
+//           distances, predecessors and arcs in
+// @info   - Uses an IndexedHeap keyed on the vertex ids, vertices are pushed when they are first discovered and their
+//           entry is decreased in place when a shorter path is found, so the heap never holds more than V entries.
+template<class VertexType>
+void csrGraph<VertexType>::dijkstras(unsigned int src, int dest, SearchWorkspace<VertexType> & workspace) const {
+
+    workspace.begin(vertices.size());
+    IndexedHeap<double> & queue = workspace.getHeap();
+
+    workspace.reach(src, -1, 0);
+    queue.push(src, 0.0);
+
+    while(!queue.empty()) {
+
+        unsigned int current = queue.pop();
+
+        if((int) current == dest)
+            break;
+
+        workspace.scan(current);
+
+        for(unsigned int j = offsets[current]; j < offsets[current+1]; j++) {
+
+            unsigned int target = targets[j];
+            double temp_weight = workspace.getDistance(current) + weights[j];
+
+            if(!workspace.isScanned(target) && temp_weight < workspace.getDistance(target)) {
+                workspace.reach(target, current, temp_weight);
+                workspace.setArc(target, j);
+                queue.pushOrDecrease(target, temp_weight);
+            }
+        }
+    }
+}
+
+// @func - transpose
+// @args - #1 output, the offsets of the in-arcs of every vertex, #2 output, the source of every in-arc, #3 output, the weight
+//         of every in-arc
+// @info - A counting sort over the targets, O(V+E).
+template<class VertexType>
+void csrGraph<VertexType>::transpose(std::vector<unsigned int> & in_offsets, std::vector<unsigned int> & in_sources,
+                                     std::vector<double> & in_weights) const {
+
+    unsigned int n = vertices.size();
+
+    in_offsets.assign(n+1, 0);
+    in_sources.resize(targets.size());
+    in_weights.resize(targets.size());
+
+    for(auto target : targets)
+        in_offsets[target+1]++;
+
+    for(unsigned int i = 0; i < n; i++)
+        in_offsets[i+1] += in_offsets[i];
+
+    std::vector<unsigned int> position(in_offsets.begin(), in_offsets.end()-1);
+
+    for(unsigned int i = 0; i < n; i++) {
+        for(unsigned int j = offsets[i]; j < offsets[i+1]; j++) {
+            unsigned int slot = position[targets[j]]++;
+            in_sources[slot] = i;
+            in_weights[slot] = weights[j];
+        }
+    }
+}
@@ -0,0 +1,492 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - csrGraph.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is my declaration of the csrGraph (compressed sparse row graph) class. This class represents a templated,
+*               read-optimized graph that can be either directed or undirected. It implements the exact same GraphInterface
+*               as the dGraph and uGraph classes, so it can be used anywhere those can, but it is designed for workloads that
+*               build a graph once and then query it many, many times.
+*
+*   @Details  - Instead of keeping a heap-allocated AdjList (and a std::list of heap-allocated Edges) for every vertex, this
+*               class gives every vertex a dense integer id in the range [0, V) and stores all of the edges of the graph in
+*               three contiguous arrays :
+*               offsets - V+1 entries, the edges leaving vertex i are stored in the range [offsets[i], offsets[i+1])
+*               targets - E entries, the id of the vertex that each edge points to
+*               weights - E entries, the weight associated with each edge
+*               So the graph from the dGraph header would be stored like this (vertex ids in parenthesis) :
+*               -------------------------------------------------------------
+*               offsets |  0  2  5  8 10 13 15                               |
+*               targets |  c  d  v  d  e  a  v  e  a  b  b  c  v  b  c       |
+*               -------------------------------------------------------------
+*               Walking the edges of a vertex is then a linear scan through a contiguous block of memory instead of a pointer
+*               chase per edge, and all of the algorithms below keep their per-vertex state in flat std::vectors indexed by
+*               the vertex id instead of in std::unordered_maps keyed by the vertex data. The edges of each vertex are kept
+*               sorted by target id, which lets containsEdge/getEdgeWeight use a binary search.
+*
+*               The price for all of this is that mutating the graph is expensive. Inserting a vertex is cheap, but
+*               inserting or deleting an edge has to shift the arrays (O(V+E)), so the intended use is to build the graph in
+*               a dGraph or uGraph and then freeze it into a csrGraph using the provided constructors.
+**/
+
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <deque>
+#include <queue>
+#include <unordered_map>
+#include <algorithm>
+#include <type_traits>
+#include <iostream>         // needed for printGraph function..
+#include <limits>
+
+#include "../../GraphInterface/GraphInterface.h"
+#include "../Vertex/Vertex.h"
+#include "../Edge/Edge.h"
+#include "../DirectedGraph/dGraph.h"
+#include "../UndirectedGraph/uGraph.h"
+#include "../../GraphTraveler/BipartiteTraveler.hpp"
+#include "../PriorityQueue/IndexedHeap.h"
+#include "../BreadthFirst/BreadthFirst.h"
+#include "../ShortestPath/ShortestPath.h"
+#include "../SearchWorkspace/SearchWorkspace.h"
+#include "../Visitor/Visitor.h"
+#include "../MinimumCut/MinimumCut.h"
+
+
+template <class VertexType>
+class csrGraph : public GraphInterface <VertexType>
+{
+    //////////////////////////////////////////////////////
+    ////////         PUBLIC INTERFACE       //////////////
+    //////////////////////////////////////////////////////
+public:
+
+    // @func - Constructor#1
+    // @args - #1 Bool indicating if the graph is directed (true) or undirected (false)
+    // @info - Initializes everything to empty
+    csrGraph(bool = true);
+
+    // @func - Constructor#2
+    // @args - #1 The directed graph to freeze into this compressed representation
+    // @info - Copies every vertex and edge out of the dGraph, the dGraph is not modified.
+    csrGraph(const dGraph<VertexType> &);
+
+    // @func - Constructor#3
+    // @args - #1 The undirected graph to freeze into this compressed representation
+    // @info - Copies every vertex and edge out of the uGraph, the uGraph is not modified.
+    csrGraph(const uGraph<VertexType> &);
+
+    // @func  - Destructor
+    // @info  - Nothing is dynamically allocated by this class, everything lives in std::vectors.
+    virtual ~csrGraph();
+
+    // @func - destoryGraph
+    // @info - deletes all internal vertices and edges
+    bool destroyGraph();
+
+    // @func   - insertVertex
+    // @args   - #1 The value of the node to be inserted
+    // @return - Boolean indicating succes
+    bool insertVertex(const VertexType &);
+
+    // @func   - deleteVertex
+    // @args   - #1 The value of the node to be deleted
+    // @return - Boolean indicating success
+    // @info   - This renumbers the vertices and rebuilds the arrays, O(V+E).
+    bool deleteVertex(const VertexType &);
+
+    // @func   - getAllVertices
+    // @args   - none
+    // @return - Vector of the data contained inside all vertices, in order of their ids.
+    std::vector<VertexType> getAllVertices() const;
+
+    // @func   - getAllEdges
+    // @args   - none
+    // @return - Vector of all of the edges in the graph
+    std::vector<Edge<VertexType> > getAllEdges() const;
+
+    // @func   - insertVertices
+    // @args   - #1 Vector of Vertex data corresponding to the vertices to be added.
+    // @return - Boolean indicating succes
+    bool insertVertices(std::vector<VertexType>);
+
+    // @func   - deleteVertices
+    // @args   - #1 Vector of Vertex data corresponding to the vertices to be deleted.
+    // @return - Boolean indicating success
+    bool deleteVertices(std::vector<VertexType>);
+
+    // @func   - insertEdge
+    // @args   - #1 The "From" Node, #2 the "To" Node, #3 The weight for this new edge
+    // @return - Boolean indicating succes
+    // @info   - This has to shift the edge arrays to keep them compressed, O(V+E).
+    bool insertEdge(const VertexType &, const VertexType &, double = 1.0);
+
+    // @func   - deleteEdge
+    // @args   - #1 The "From" Node, the "To" Node.
+    // @return - Boolean indicating succes
+    // @info   - This has to shift the edge arrays to keep them compressed, O(V+E).
+    bool deleteEdge(const VertexType &, const VertexType &);
+
+    // @func   - numVertices
+    // @args   - None
+    // @return - The number of vertices currently in the graph.
+    int getNumVertices() const;
+
+    // @func   - numEdges
+    // @args   - None
+    // @return - The number of edges currently in the graph (for undirected graphs each edge is counted once).
+    int getNumEdges() const;
+
+    // @func   - containsVerex
+    // @args   - #1 data associated with the vertex that you wish to query for existence
+    // @return - Bool corresponding to the existence of a vertex with the given data in this graph
+    bool containsVertex(const VertexType &);
+
+    // @func   - containsEdge
+    // @args   - #1 data associated with the 'from' vertex, #2 data associated with the 'to' vertex.
+    // @return - Bool corresponding to the existence of an edge in the graph between the two vertices
+    bool containsEdge(const VertexType &, const VertexType &);
+
+    // @func   - getEdgeWeight
+    // @args   - #1 data associated with vetex #1, data associated with vertex #2
+    // @return - returns the weight of the edge, throws error if edge not found
+    double getEdgeWeight(const VertexType &, const VertexType &);
+
+    // @func   - setEdgeWeight
+    // @args   - #1 data associated with vetex #1, data associated with vertex #2, #3 weight to set
+    // @return - returns true if the weight could be set, false if the edge wasn't found
+    bool setEdgeWeight(const VertexType &, const VertexType &, double);
+
+    // @func   - getIncidentEdges
+    // @args   - Data contained in vertex that you wish to recieve a list of adjacent vertices of.
+    // @return - Vector of the edges that eminate from the given vertex, throws error if the vertex is not found.
+    std::vector< Edge<VertexType> > getIncidentEdges(const VertexType &) const;
+
+    // @func   - processVertex
+    // @args   - #1 Data contained in vertex that you wish to process, #2 GraphTraveler object that will process the vertex and it's edges
+    // @return - Bool indicating if the vertex could be found or not.
+    bool processVertex(const VertexType &, GraphTraveler<VertexType> *) const;
+
+    // @func   - processVertices
+    // @args   - #1 Data contained in vertices that you wish to process, #2 GraphTraveler object that will process the vertex and it's edges
+    // @return - Bool indicating if the vertices could be found or not.
+    bool processVertices(const std::vector<VertexType> &, GraphTraveler<VertexType> *) const;
+
+    // @func   - makeGraphDense
+    // @args   - A function that takes two vertices and assigns a weight to their edge
+    // @return - Bool indicating success
+    bool makeGraphDense(double setWeight(VertexType&, VertexType&) = nullptr);
+
+    // @func   - reverse
+    // @args   - none
+    // @return - Bool indicating success
+    // @info   - This function switches the direction of all edges, does nothing for undirected graphs.
+    bool reverse();
+
+    // @func   - invert
+    // @args   - #1 Weighing function that takes in two vertices and assigns a weight to an edge between them
+    // @return - Bool indicating success
+    bool invert(double setWeight(VertexType&, VertexType&) = nullptr);
+
+    // @func   - printGraph
+    // @args   - none
+    // @return - none
+    // @info   - prints the adjecency list representation of the graph to the console.
+    void printGraph() const;
+
+    // @func   - isConnected
+    // @args   - None
+    // @return - Bool indicating whether or not the graph is connected (strongly connected for directed graphs)
+    bool isConnected();
+
+    // @func   - isBipartite
+    // @args   - None
+    // @return - Bool indicating whether or not the graph is bipartite
+    bool isBipartite();
+
+    // @func   - getBipartition
+    // @args   - std::pair pointer that will be filled with two vectors of vertices, consisting of one bipartition of the graph
+    // @return - Bool indicating whether or not the graph is bipartite and able to be bipartitioned
+    bool getBipartition(std::pair<std::vector<VertexType>, std::vector<VertexType> > *);
+
+    // @func   - depthFirst
+    // @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components as they're discovered.
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    bool depthFirst(const VertexType &, GraphTraveler<VertexType> * = nullptr);
+
+    // @func   - depthFirst
+    // @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components as
+    //           they're discovered, #3 the workspace to keep the bookkeeping of the search in
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    bool depthFirst(const VertexType &, GraphTraveler<VertexType> *, SearchWorkspace<VertexType> &);
+
+    // @func   - depthFirst
+    // @args   - #1 Data associated with the starting vertex for the search, #2 any visitor (see Visitor.h), #3 optionally the
+    //           workspace to keep the bookkeeping of the search in
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    // @info   - The same search with the visitor's callbacks bound at compile time, the ones it doesn't have are compiled out.
+    //           The GraphTraveler versions above run through this one with a TravelerAdapter.
+    template <class Visitor, class = typename std::enable_if<IsVisitor<Visitor>::value>::type>
+    bool depthFirst(const VertexType &, Visitor &&);
+
+    template <class Visitor, class = typename std::enable_if<IsVisitor<Visitor>::value>::type>
+    bool depthFirst(const VertexType &, Visitor &&, SearchWorkspace<VertexType> &);
+
+    // @func   - breadthFirst
+    // @args   - #1 Data associated with the starting vertex for the search,  #2 Traveler class to process the graph components as they're discovered.
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    bool breadthFirst(const VertexType &, GraphTraveler<VertexType> * = nullptr);
+
+    // @func   - breadthFirst
+    // @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components as
+    //           they're discovered, #3 the workspace to keep the bookkeeping of the search in
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    bool breadthFirst(const VertexType &, GraphTraveler<VertexType> *, SearchWorkspace<VertexType> &);
+
+    // @func   - breadthFirst
+    // @args   - #1 Data associated with the starting vertex for the search, #2 any visitor (see Visitor.h), #3 optionally the
+    //           workspace to keep the bookkeeping of the search in
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    // @info   - The same search with the visitor's callbacks bound at compile time, the ones it doesn't have are compiled out.
+    //           The GraphTraveler versions above run through this one with a TravelerAdapter.
+    template <class Visitor, class = typename std::enable_if<IsVisitor<Visitor>::value>::type>
+    bool breadthFirst(const VertexType &, Visitor &&);
+
+    template <class Visitor, class = typename std::enable_if<IsVisitor<Visitor>::value>::type>
+    bool breadthFirst(const VertexType &, Visitor &&, SearchWorkspace<VertexType> &);
+
+    // @func   - breadthFirst
+    // @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components as
+    //           they're discovered, #3 which strategy to search with
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    // @info   - BreadthFirstStrategy::DirectionOptimizing runs the search in BreadthFirst.h straight over our
+    //           arrays (directed graphs build their in-arcs first), the traveler is handed the edges of the search tree level by level once the search is done.
+    bool breadthFirst(const VertexType &, GraphTraveler<VertexType> *, const BreadthFirstOptions &);
+
+    // @func   - parallelBreadthFirst
+    // @args   - #1 Data associated with the starting vertex for the search, #2 output, the number of edges on a shortest path
+    //           from the start to every vertex (-1 if it can't be reached), #3 output, the vertex each vertex was reached from
+    //           (-1 if it wasn't reached, the start is its own parent), #4 the number of threads to search with (0 for one per
+    //           hardware thread)
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    // @info   - Both outputs are indexed by the dense vertex ids, see getVertexId. Every level of the search is spread across the
+    //           threads, see parallelBreadthFirstSearch in BreadthFirst.h.
+    bool parallelBreadthFirst(const VertexType &, std::vector<int> &, std::vector<int> &, unsigned int = 0) const;
+
+    // @func   - deltaStepping
+    // @args   - #1 Data contained in the source vertex, #2 output, the length of the shortest path from the source to every
+    //           vertex (infinity if it can't be reached), #3 output, the vertex before each vertex on that path (-1 for the
+    //           source and the vertices that can't be reached), #4 the bucket width and the number of threads to use
+    // @return - Bool indicating if the function could find the source vertex based on arg#1
+    // @info   - Returns what dijkstrasMinimumTree does as flat arrays indexed by the dense vertex ids (see getVertexId), but
+    //           spreads each query across threads with the delta-stepping search in ShortestPath.h. Throws a logic_error if
+    //           any edge has a negative weight.
+    bool deltaStepping(const VertexType &, std::vector<double> &, std::vector<int> &, const DeltaSteppingOptions & = DeltaSteppingOptions()) const;
+
+    // @func   - shortestPaths
+    // @args   - #1 The (source, destination) pairs to find shortest paths between, #2 output, the length and the path of every
+    //           query (see ShortestPathBatch), #3 the number of threads to answer them with (0 for one per hardware thread)
+    // @return - Bool, false if any of the vertices isn't in the graph, in which case nothing is searched
+    // @info   - The queries are spread across threads that search the graph at the same time without changing it, each one
+    //           with scratch arrays it reuses from query to query, see ShortestPath.h. Throws a logic_error if any edge has a
+    //           negative weight.
+    bool shortestPaths(const std::vector<std::pair<VertexType, VertexType> > &, ShortestPathBatch &, unsigned int = 0) const;
+
+    // @func   - shortestPathTrees
+    // @args   - #1 The sources to build shortest path trees from, #2 output, the distance and predecessor of every vertex from
+    //           every source (see ShortestPathTrees), #3 the number of threads to build them with (0 for one per hardware thread)
+    // @return - Bool, false if any of the sources isn't in the graph, in which case nothing is searched
+    bool shortestPathTrees(const std::vector<VertexType> &, ShortestPathTrees &, unsigned int = 0) const;
+
+    // @func   - minimuminCut
+    // @args   - #1 Optional output, the total weight of the edges that cross the cut
+    // @return - 2 column vector of vertices, each column representing one half of the cut.
+    std::vector<std::vector<VertexType> > minimumCut(double * = nullptr);
+
+    // @func   - minimumCut
+    // @args   - #1 Optional output, the total weight of the edges that cross the cut, #2 which algorithm to use and how to run it
+    // @return - 2 column vector of vertices, each column representing one half of the cut.
+    // @info   - MinimumCutAlgorithm::KargerStein trades exactness for speed on very large graphs, see MinimumCut.h.
+    std::vector<std::vector<VertexType> > minimumCut(double *, const MinimumCutOptions &);
+
+    // @func   - minimuminSpanningTree
+    // @args   - #1 GraphTraveler object that is used to build the minimum spanning tree
+    // @return - Boolean that indicates if the minimum tree could be traversed or not, false if the graph is not connected
+    bool minimumSpanningTree(GraphTraveler<VertexType> * = nullptr);
+
+    // @func   - dijkstrasMinimumTree
+    // @args   - #1 Data contained in starting vertex for search, #2 optional destination vertex, if null we will find the path to every node
+    //           otherwise we stop when we find the destination node
+    // @return - A pair containing two maps. The first map takes a vertex and returns the previuos vertex in the path there from the source vertex.
+    //           The second map takes a vertex and gives the total weight that it takes to get there from the source vertex.
+    // @info   - The search itself runs over the flat arrays, the maps are only built at the end to satisfy the GraphInterface.
+    typename csrGraph<VertexType>::dist_prev_pair * dijkstrasMinimumTree(const VertexType &, const VertexType * = nullptr);
+
+    // @func   - dijkstrasMinimumTree
+    // @args   - #1 Data contained in starting vertex for search, #2 the workspace to leave the results in, #3 optional destination
+    // @info   - Leaves the distance and predecessor of every vertex in the workspace, read them by dense vertex id.
+    void dijkstrasMinimumTree(const VertexType &, SearchWorkspace<VertexType> &, const VertexType * = nullptr);
+
+    // @func   - dijkstrasShortestPath
+    // @args   - #1 Source Vertex, #2 Dest Vertex, #3 the GraphTraveler-derived object that will recieve the vertices and edges in minimum order
+    // @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+    bool dijkstrasShortestPath(const VertexType &, const VertexType &, GraphTraveler<VertexType> * = nullptr);
+
+    // @func   - dijkstrasShortestPath
+    // @args   - #1 Source Vertex, #2 Dest Vertex, #3 the traveler to hand the path to, #4 the workspace to run the search in
+    // @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+    bool dijkstrasShortestPath(const VertexType &, const VertexType &, GraphTraveler<VertexType> *, SearchWorkspace<VertexType> &);
+
+    // @func   - dijkstrasShortestPath
+    // @args   - #1 Source Vertex, #2 Dest Vertex, #3 any visitor (see Visitor.h) to hand the path to, #4 optionally the workspace
+    //           to run the search in
+    // @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+    // @info   - The path is only walked edge by edge if the visitor has a traverse_edge callback.
+    template <class Visitor, class = typename std::enable_if<IsVisitor<Visitor>::value>::type>
+    bool dijkstrasShortestPath(const VertexType &, const VertexType &, Visitor &&);
+
+    template <class Visitor, class = typename std::enable_if<IsVisitor<Visitor>::value>::type>
+    bool dijkstrasShortestPath(const VertexType &, const VertexType &, Visitor &&, SearchWorkspace<VertexType> &);
+
+    // @func   - aStar
+    // @args   - #1 Data contained in starting vertex for search, #2 Vector of possible goal vertices to reach, #3 Pointer
+    //           to a hueristic function on a given node
+    // @return - Vector containing, in-order, the vertices to take to reach your goal. Empty if you are there or no path exists.
+    std::vector<VertexType> aStar(const VertexType &, std::vector<VertexType>, double hueristic(VertexType&, VertexType&));
+
+    // @func   - aStar
+    // @args   - #1 Data contained in starting vertex for search, #2 Vector of possible goal vertices to reach, #3 Any callable
+    //           taking (VertexType&, VertexType&) that estimates the distance from a vertex to a goal, #4 optional pointer
+    //           that gets the number of vertices the search expanded
+    // @return - Vector containing, in-order, the vertices to take to reach the closest goal (not including the start). Empty
+    //           if you are there or no path exists.
+    // @info   - A vertex is estimated by its smallest estimate over all of the goals, so the path is a shortest one as long
+    //           as the heuristic never overestimates the distance to a goal. Passing nullptr picks the version above.
+    template <class Heuristic, class = typename std::enable_if<!std::is_same<Heuristic, std::nullptr_t>::value>::type>
+    std::vector<VertexType> aStar(const VertexType &, const std::vector<VertexType> &, Heuristic, unsigned int * = nullptr);
+
+    // @func   - isDirected
+    // @args   - None
+    // @return - True if this is a directed graph, false if it is undirected
+    bool isDirected() const;
+
+    // @func   - getVertexId
+    // @args   - #1 Data contained in the vertex to look up
+    // @return - The dense integer id of the vertex, -1 if the vertex is not in the graph
+    int getVertexId(const VertexType &) const;
+
+    // @func   - getVertexData
+    // @args   - #1 Dense integer id of a vertex, must be in the range [0, getNumVertices())
+    // @return - The data contained in the vertex with that id
+    VertexType getVertexData(unsigned int) const;
+
+
+    //////////////////////////////////////////////////////
+    ////////           PRIVATE DATA      /////////////////
+    //////////////////////////////////////////////////////
+private:
+
+    // @friend - GraphSnapshot
+    // @info   - Snapshots are the compressed arrays written to disk, so they are read from and loaded into directly.
+    template <class> friend class GraphSnapshot;
+
+    // @typedef - (too long to retype)
+    // @info    - The same pair of unordered_maps that the dGraph and uGraph classes return from their dijkstras algorithm.
+    typedef std::pair<std::unordered_map<VertexType, VertexType>, std::unordered_map<VertexType, double> > dist_prev_pair;
+
+    // @member - is_directed
+    // @info   - If false, every edge is stored twice (once in each direction), just like the uGraph class does.
+    bool is_directed;
+
+    // @member - num_edges
+    // @info   - Number of Edges currently in the graph, for undirected graphs this is half the length of the targets array.
+    int num_edges;
+
+    // @member - vertices
+    // @info   - Maps a dense vertex id to the vertex object for that id.
+    std::vector<Vertex<VertexType> > vertices;
+
+    // @member - offsets
+    // @info   - Always has vertices.size()+1 entries, the edges of vertex i live in [offsets[i], offsets[i+1]) of the edge arrays.
+    std::vector<unsigned int> offsets;
+
+    // @member - targets
+    // @info   - The id of the target vertex for each edge, sorted by id within the range of each vertex.
+    std::vector<unsigned int> targets;
+
+    // @member - weights
+    // @info   - The weight for each edge, parallel to the targets array.
+    std::vector<double> weights;
+
+    // @member - lookup_map
+    // @info   - Maps the data contained in a vertex to the dense id of that vertex. This is only used at the API boundary,
+    //           once a search has translated its arguments into ids it never touches this map again.
+    std::unordered_map<VertexType, unsigned int> lookup_map;
+
+
+    //////////////////////////////////////////////////////
+    ////////       PRIVATE FUNCTIONS     /////////////////
+    //////////////////////////////////////////////////////
+
+    // @func   - freeze
+    // @args   - #1 The graph to copy all vertices and edges out of
+    // @info   - Used by the freezing constructors, builds the compressed arrays in two passes over the other graph.
+    void freeze(const GraphInterface<VertexType> &);
+
+    // @func   - findVertex
+    // @args   - #1 Value contained in the vertex to be found
+    // @return - The id of the vertex, or -1 if it isn't in the graph
+    int findVertex(const VertexType &) const;
+
+    // @func   - findEdge
+    // @args   - #1 id of the source vertex, #2 id of the target vertex
+    // @return - Index into the targets/weights arrays for the edge, or -1 if there is no such edge
+    // @info   - Binary searches the sorted edge range of the source vertex
+    int findEdge(unsigned int, unsigned int) const;
+
+    // @func   - insertArc
+    // @args   - #1 id of the source vertex, #2 id of the target vertex, #3 weight of the edge
+    // @return - False if the edge already exists
+    // @info   - Inserts a single directed arc into the compressed arrays.
+    bool insertArc(unsigned int, unsigned int, double);
+
+    // @func   - deleteArc
+    // @args   - #1 id of the source vertex, #2 id of the target vertex
+    // @return - False if the edge doesn't exist
+    // @info   - Removes a single directed arc from the compressed arrays.
+    bool deleteArc(unsigned int, unsigned int);
+
+    // @func   - rebuild
+    // @args   - #1 Vector of (source id, target id, weight) arcs, all ids must be valid
+    // @info   - Throws away all current edges and rebuilds the compressed arrays from the given list of arcs
+    void rebuild(std::vector<std::pair<std::pair<unsigned int, unsigned int>, double> > &);
+
+    // @func   - makeEdge
+    // @args   - #1 id of the source vertex, #2 index of the edge in the targets/weights arrays
+    // @return - An Edge object pointing at our internal vertices, used to talk to the GraphTraveler objects
+    Edge<VertexType> makeEdge(unsigned int, unsigned int) const;
+
+    // @func   - reachable
+    // @args   - #1 id of the starting vertex, #2 bool, if true we follow edges backwards
+    // @return - The number of vertices that can be reached from the starting vertex
+    unsigned int reachable(unsigned int, bool) const;
+
+    // @func   - transpose
+    // @args   - #1 output, in-arc offsets, #2 output, in-arc sources, #3 output, in-arc weights
+    // @info   - Packs the arcs entering every vertex the same way the arcs leaving it are packed
+    void transpose(std::vector<unsigned int> &, std::vector<unsigned int> &, std::vector<double> &) const;
+
+    // @func   - dijkstras
+    // @args   - #1 id of the source vertex, #2 id of the destination vertex (-1 for none), #3 the workspace to leave the
+    //           distances, predecessors and arcs in
+    // @info   - Runs Dijkstra's algorithm over the flat arrays.
+    void dijkstras(unsigned int, int, SearchWorkspace<VertexType> &) const;
+
+};
+
+#include "csrGraph.cpp"
+#endif
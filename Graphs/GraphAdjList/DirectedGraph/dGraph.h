@@ -49,6 +49,8 @@
 #include <set>
 #include <iostream>         // needed for printGraph function..
 #include <limits>
+#include <algorithm>
+#include <type_traits>
 #include <random>
 
 #include "../../GraphInterface/GraphInterface.h"
@@ -57,6 +59,15 @@
 #include "../Edge/Edge.h"
 #include "../../GraphTraveler/dTraveler.hpp"
 #include "../../GraphTraveler/BipartiteTraveler.hpp"
+#include "../PriorityQueue/IndexedHeap.h"
+#include "../BreadthFirst/BreadthFirst.h"
+#include "../ShortestPath/ShortestPath.h"
+#include "../SearchWorkspace/SearchWorkspace.h"
+#include "../Visitor/Visitor.h"
+#include "../GraphView/GraphView.h"
+#include "../MinimumCut/MinimumCut.h"
+#include "../SpanningTree/SpanningTree.h"
+#include "../GraphIO/EdgeListReader.h"
 
 // template<class V> BipartiteTraveler;
 
@@ -75,9 +86,10 @@ public:
     dGraph();
 
     // @func  - Constructor#2
-    // @args  - #1 String that contains the filename from which to load a graph
-    // @error - Can throw IO error if invalid filename or file structure to build graph
-    dGraph(std::string fn);
+    // @args  - #1 String that contains the filename from which to load a graph, #2 the format of the file (see GraphIO/EdgeListReader.h),
+    //          #3 bool, true if the file is known to have no duplicate edges or self loops (skips the per-edge checks)
+    // @error - Throws a logic_error if the file can't be opened or a line of it can't be parsed
+    dGraph(std::string fn, EdgeListFormat = EdgeListFormat::Auto, bool = false);
 
     // @func  - Copy Constructor
     // @args  - dGraph object that you wish to make this a copy of
@@ -128,8 +140,9 @@ public:
     bool insertVertex(const VertexType &);
 
     // @func   - deleteVertex
-    // @args   - none
+    // @args   - #1 Data contained in the vertex to be deleted
     // @return - Boolean indicating success
+    // @info   - Only touches the edges leaving and entering the vertex, the last vertex in the graph takes over its id.
     bool deleteVertex(const VertexType &);
 
     // @func   - getAllVertices
@@ -137,6 +150,12 @@ public:
     // @return - Vector of the data contained inside all vertices.
     std::vector<VertexType> getAllVertices() const;
 
+    // @func   - getVertices
+    // @args   - none
+    // @return - A view over the data of every vertex in id order, which reads the graph in place instead of copying it
+    // @info   - The view is only good until the next vertex or edge is inserted or deleted, see GraphView/GraphView.h.
+    VertexView<VertexType> getVertices() const;
+
     // @func   - getAllEdges
     // @args   - none
     // @return - Vector of all of the edges in the graph
@@ -147,6 +166,16 @@ public:
     // @return - Boolean indicating success, returns false if it can't find the vertex to update.
     bool updateVertex(const VertexType &, const VertexType &);
 
+    // @func   - loadFile
+    // @args   - #1 The file to load, #2 the format of the file (see GraphIO/EdgeListReader.h), #3 bool, true if the file is known
+    //           to have no duplicate edges or self loops
+    // @return - Bool indicating success
+    // @info   - Streams the vertices and edges in the file into this graph, on top of whatever is already in it. Edges without a weight
+    //           are given a weight of 1.0. When the input is clean the edges are appended straight to the adjacency lists without
+    //           checking for duplicates, which is much faster but will corrupt the graph if the file does have duplicate edges.
+    // @error  - Throws a logic_error if the file can't be opened or a line of it can't be parsed
+    bool loadFile(const std::string &, EdgeListFormat = EdgeListFormat::Auto, bool = false);
+
     // @func   - deleteVertices
     // @args   - #1 Vector of Vertex data corresponding to the vertices to be added.
     // @return - Boolean indicating succes
@@ -204,6 +233,59 @@ public:
     // @return - Vector of pairs, first item is the vertex that the edge points to, second is the weight of that edge.
     std::vector< Edge<VertexType> > getIncidentEdges(const VertexType &) const;
 
+    // @func   - getNeighbors
+    // @args   - #1 Data contained in the vertex
+    // @return - A view over the edges leaving the vertex, throws a logic_error if the vertex isn't in the graph
+    // @info   - getIncidentEdges without the copies, the view is only good until the next vertex or edge is inserted or deleted.
+    NeighborView<VertexType> getNeighbors(const VertexType &) const;
+
+    // @func   - getIncomingEdges
+    // @args   - #1 Data contained in the vertex whose incoming edges you want
+    // @return - Vector of every edge that points at the vertex, throws a logic_error if the vertex isn't in the graph
+    // @info   - O(in degree) while the graph keeps its in-edge index (see setInEdgeIndex), O(V) otherwise.
+    std::vector< Edge<VertexType> > getIncomingEdges(const VertexType &) const;
+
+    // @func   - inDegree
+    // @args   - #1 Data contained in the vertex
+    // @return - The number of edges pointing at the vertex, throws a logic_error if the vertex isn't in the graph
+    unsigned int inDegree(const VertexType &) const;
+
+    // @func   - setInEdgeIndex
+    // @args   - #1 bool, true to keep an index of the edges entering every vertex (the default), false to drop it
+    // @return - Bool indicating success
+    // @info   - The index makes deleteVertex, getIncomingEdges, inDegree and the backward half of bidirectionalShortestPath
+    //           cost only the edges they touch, at the price of a pointer per edge and a little extra work in every edge insert
+    //           and delete. Graphs that are mostly written to can turn it off, turning it back on rebuilds it
+    //           in O(V+E).
+    bool setInEdgeIndex(bool);
+
+    // @func   - hasInEdgeIndex
+    // @args   - none
+    // @return - True if the graph is keeping an index of the edges entering every vertex
+    bool hasInEdgeIndex() const;
+
+    // @func   - getVertexId
+    // @args   - #1 Data contained in the vertex whose id you want
+    // @return - The dense id of the vertex, in the range [0, getNumVertices()), -1 if the vertex isn't in the graph
+    // @info   - Ids are assigned in insertion order. Deleting a vertex hands its id to the vertex that had the highest id, every
+    //           other id stays the same.
+    int getVertexId(const VertexType &) const;
+
+    // @func   - getVertexData
+    // @args   - #1 The dense id of a vertex
+    // @return - The data contained in the vertex with the given id, throws a logic_error if the id is out of range
+    const VertexType & getVertexData(unsigned int) const;
+
+    // @func   - getEdgePoolStats
+    // @args   - none
+    // @return - The allocation statistics of the pool that the edges of this graph are allocated from
+    PoolStats getEdgePoolStats() const;
+
+    // @func   - getVertexPoolStats
+    // @args   - none
+    // @return - The allocation statistics of the pool that the adjacency lists of this graph are allocated from
+    PoolStats getVertexPoolStats() const;
+
     // @func   - processVertex
     // @args   - #1 Data contained in vertex that you wish to process, #2 GraphTraveler object that will process the vertex and it's edges
     // @return - Bool indicating if the vertex could be found or not.
@@ -245,10 +327,18 @@ public:
 
     // @func   - isConnected
     // @args   - None
-    // @return - Bool indicating whether or not the graph is connected
-    // @info   - This function uses BFS to search to see if any given vertex can be reached from any other given vertex
+    // @return - Bool indicating whether or not the graph is strongly connected
+    // @info   - Runs Tarjan's algorithm from the first vertex and stops as soon as the first component is finished, the graph is
+    //           strongly connected if that component holds every vertex.
     bool isConnected();
 
+    // @func   - stronglyConnectedComponents
+    // @args   - #1 Output, the component of every vertex indexed by its dense id (see getVertexId)
+    // @return - The number of strongly connected components
+    // @info   - An iterative Tarjan's algorithm, one O(V+E) pass over flat arrays. Components are numbered in reverse topological
+    //           order, so every edge between two different components points from the higher numbered one to the lower one.
+    unsigned int stronglyConnectedComponents(std::vector<unsigned int> &) const;
+
     // @func   - isBipartite
     // @args   - None
     // @return - Bool indicating whether or not the graph is bipartite
@@ -279,6 +369,25 @@ public:
     //           This precondition allows us to use an std::unordered_map to keep track of the seen and unseen vertices.
     bool depthFirst(const VertexType &, GraphTraveler<VertexType> * = nullptr);
 
+    // @func   - depthFirst
+    // @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components as
+    //           they're discovered, #3 the workspace to keep the bookkeeping of the search in
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    // @info   - Reusing one workspace across searches keeps them from allocating, see SearchWorkspace.h.
+    bool depthFirst(const VertexType &, GraphTraveler<VertexType> *, SearchWorkspace<VertexType> &);
+
+    // @func   - depthFirst
+    // @args   - #1 Data associated with the starting vertex for the search, #2 any visitor (see Visitor.h), #3 optionally the
+    //           workspace to keep the bookkeeping of the search in
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    // @info   - The same search with the visitor's callbacks bound at compile time, the ones it doesn't have are compiled out.
+    //           The GraphTraveler versions above run through this one with a TravelerAdapter.
+    template <class Visitor, class = typename std::enable_if<IsVisitor<Visitor>::value>::type>
+    bool depthFirst(const VertexType &, Visitor &&);
+
+    template <class Visitor, class = typename std::enable_if<IsVisitor<Visitor>::value>::type>
+    bool depthFirst(const VertexType &, Visitor &&, SearchWorkspace<VertexType> &);
+
     // @func   - breadthFirst
     // @args   - #1 Data associated with the starting vertex for the search,  #2 Traveler class to process the graph components as they're discovered.
     // @return - Bool indicating if the function could find the starting vertex based on arg#1
@@ -288,11 +397,82 @@ public:
     //           unseen vertices.
     bool breadthFirst(const VertexType &, GraphTraveler<VertexType> * = nullptr);
 
+    // @func   - breadthFirst
+    // @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components as
+    //           they're discovered, #3 the workspace to keep the bookkeeping of the search in
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    // @info   - Reusing one workspace across searches keeps them from allocating, see SearchWorkspace.h. Afterwards the
+    //           workspace holds the number of edges between the start and every vertex it reached (getDistance).
+    bool breadthFirst(const VertexType &, GraphTraveler<VertexType> *, SearchWorkspace<VertexType> &);
+
+    // @func   - breadthFirst
+    // @args   - #1 Data associated with the starting vertex for the search, #2 any visitor (see Visitor.h), #3 optionally the
+    //           workspace to keep the bookkeeping of the search in
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    // @info   - The same search with the visitor's callbacks bound at compile time, the ones it doesn't have are compiled out.
+    //           The GraphTraveler versions above run through this one with a TravelerAdapter.
+    template <class Visitor, class = typename std::enable_if<IsVisitor<Visitor>::value>::type>
+    bool breadthFirst(const VertexType &, Visitor &&);
+
+    template <class Visitor, class = typename std::enable_if<IsVisitor<Visitor>::value>::type>
+    bool breadthFirst(const VertexType &, Visitor &&, SearchWorkspace<VertexType> &);
+
+    // @func   - breadthFirst
+    // @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components as
+    //           they're discovered, #3 which strategy to search with
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    // @info   - BreadthFirstStrategy::DirectionOptimizing packs the graph into flat arrays and runs the search in BreadthFirst.h,
+    //           the traveler is handed the edges of the search tree level by level once the search is done.
+    bool breadthFirst(const VertexType &, GraphTraveler<VertexType> *, const BreadthFirstOptions &);
+
+    // @func   - parallelBreadthFirst
+    // @args   - #1 Data associated with the starting vertex for the search, #2 output, the number of edges on a shortest path
+    //           from the start to every vertex (-1 if it can't be reached), #3 output, the vertex each vertex was reached from
+    //           (-1 if it wasn't reached, the start is its own parent), #4 the number of threads to search with (0 for one per
+    //           hardware thread)
+    // @return - Bool indicating if the function could find the starting vertex based on arg#1
+    // @info   - Both outputs are indexed by the dense vertex ids, see getVertexId. Every level of the search is spread across the
+    //           threads, see parallelBreadthFirstSearch in BreadthFirst.h.
+    bool parallelBreadthFirst(const VertexType &, std::vector<int> &, std::vector<int> &, unsigned int = 0) const;
+
+    // @func   - deltaStepping
+    // @args   - #1 Data contained in the source vertex, #2 output, the length of the shortest path from the source to every
+    //           vertex (infinity if it can't be reached), #3 output, the vertex before each vertex on that path (-1 for the
+    //           source and the vertices that can't be reached), #4 the bucket width and the number of threads to use
+    // @return - Bool indicating if the function could find the source vertex based on arg#1
+    // @info   - Returns what dijkstrasMinimumTree does as flat arrays indexed by the dense vertex ids (see getVertexId), but
+    //           spreads each query across threads with the delta-stepping search in ShortestPath.h. Throws a logic_error if
+    //           any edge has a negative weight.
+    bool deltaStepping(const VertexType &, std::vector<double> &, std::vector<int> &, const DeltaSteppingOptions & = DeltaSteppingOptions()) const;
+
+    // @func   - shortestPaths
+    // @args   - #1 The (source, destination) pairs to find shortest paths between, #2 output, the length and the path of every
+    //           query (see ShortestPathBatch), #3 the number of threads to answer them with (0 for one per hardware thread)
+    // @return - Bool, false if any of the vertices isn't in the graph, in which case nothing is searched
+    // @info   - The queries are spread across threads that search the graph at the same time without changing it, each one
+    //           with scratch arrays it reuses from query to query, see ShortestPath.h. Throws a logic_error if any edge has a
+    //           negative weight.
+    bool shortestPaths(const std::vector<std::pair<VertexType, VertexType> > &, ShortestPathBatch &, unsigned int = 0) const;
+
+    // @func   - shortestPathTrees
+    // @args   - #1 The sources to build shortest path trees from, #2 output, the distance and predecessor of every vertex from
+    //           every source (see ShortestPathTrees), #3 the number of threads to build them with (0 for one per hardware thread)
+    // @return - Bool, false if any of the sources isn't in the graph, in which case nothing is searched
+    bool shortestPathTrees(const std::vector<VertexType> &, ShortestPathTrees &, unsigned int = 0) const;
+
     // @func   - minimuminCut
-    // @args   - none
+    // @args   - #1 Optional output, the total weight of the edges that cross the cut
+    // @return - 2 column vector of vertices, each column representing one half of the cut.
+    // @info   - Partitions the current graph into two subsets that have the minimum total edge weight between them,
+    //           counting the edges that cross in either direction. Uses the Stoer-Wagner algorithm, all edge weights must be
+    //           non-negative.
+    std::vector<std::vector<VertexType> > minimumCut(double * = nullptr);
+
+    // @func   - minimumCut
+    // @args   - #1 Optional output, the total weight of the edges that cross the cut, #2 which algorithm to use and how to run it
     // @return - 2 column vector of vertices, each column representing one half of the cut.
-    // @info   - Partitions the current graph into two subsets that have at the minmum number of edges between them.
-    std::vector<std::vector<VertexType> > minimumCut();
+    // @info   - MinimumCutAlgorithm::KargerStein trades exactness for speed on very large graphs, see MinimumCut.h.
+    std::vector<std::vector<VertexType> > minimumCut(double *, const MinimumCutOptions &);
 
     // @func   - minimuminSpanningTree
     // @args   - none
@@ -300,6 +480,14 @@ public:
     // @info   - This function will traverse the graph is such an order as to build a minimum spanning tree,
     bool minimumSpanningTree(GraphTraveler<VertexType> * = nullptr);
 
+    // @func   - minimuminSpanningTree
+    // @args   - #1 GraphTraveler object that is used to build the minimum spanning tree, #2 which algorithm to use and whether to
+    //           build a spanning forest, see SpanningTree/SpanningTree.h
+    // @return - Boolean that indicates if the minimum tree could be traversed or not. False if the graph is not strongly-connected, unless
+    //           a forest was asked for, in which case each component gets its own tree and the function always succeeds.
+    // @info   - The first tree starts at starting_vertex, every other tree of a forest starts at a discover_vertex call.
+    bool minimumSpanningTree(GraphTraveler<VertexType> *, const SpanningTreeOptions &);
+
     // @func   - dijkstrasMinimumTree
     // @args   - #1 Data contained in starting vertex for search, #2 optional destination vertex, if null we will find the path to every node
     //           otherwise we stop when we find the destination node
@@ -309,6 +497,13 @@ public:
     //           the source vertex is not contained in the map.
     typename dGraph<VertexType>::dist_prev_pair * dijkstrasMinimumTree(const VertexType &,const  VertexType * = nullptr);
 
+    // @func   - dijkstrasMinimumTree
+    // @args   - #1 Data contained in starting vertex for search, #2 the workspace to leave the results in, #3 optional destination
+    //           vertex, if null we will find the path to every node otherwise we stop when we find the destination node
+    // @info   - Leaves the distance and predecessor of every vertex in the workspace, read them by dense vertex id (see
+    //           getVertexId) with getDistance and getPrevious. Throws an exception if the source vertex is not in the graph.
+    void dijkstrasMinimumTree(const VertexType &, SearchWorkspace<VertexType> &, const VertexType * = nullptr);
+
     // @func   - dijkstrasMinimumPath
     // @args   - #1 Source Vertex, #2 Dest Vertex, #3 the GraphTraveler-derived object that will recieve the vertices and edges in minimum order
     // @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
@@ -317,6 +512,31 @@ public:
     //           structure that contains the shortest path from the source vertex to any vertex in the map.
     bool dijkstrasShortestPath(const VertexType &, const VertexType &, GraphTraveler<VertexType> * = nullptr);
 
+    // @func   - dijkstrasShortestPath
+    // @args   - #1 Source Vertex, #2 Dest Vertex, #3 the GraphTraveler-derived object that will recieve the vertices and edges in
+    //           minimum order, #4 the workspace to run the search in
+    // @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+    bool dijkstrasShortestPath(const VertexType &, const VertexType &, GraphTraveler<VertexType> *, SearchWorkspace<VertexType> &);
+
+    // @func   - dijkstrasShortestPath
+    // @args   - #1 Source Vertex, #2 Dest Vertex, #3 any visitor (see Visitor.h) to hand the path to, #4 optionally the workspace
+    //           to run the search in
+    // @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+    // @info   - The path is only walked edge by edge if the visitor has a traverse_edge callback.
+    template <class Visitor, class = typename std::enable_if<IsVisitor<Visitor>::value>::type>
+    bool dijkstrasShortestPath(const VertexType &, const VertexType &, Visitor &&);
+
+    template <class Visitor, class = typename std::enable_if<IsVisitor<Visitor>::value>::type>
+    bool dijkstrasShortestPath(const VertexType &, const VertexType &, Visitor &&, SearchWorkspace<VertexType> &);
+
+    // @func   - bidirectionalShortestPath
+    // @args   - #1 Source Vertex, #2 Dest Vertex, #3 the GraphTraveler-derived object that will recieve the vertices and edges in minimum order
+    // @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+    // @info   - Finds the same path as dijkstrasShortestPath, but searches forward from the source and BACKWARD from the destination at
+    //           the same time and stops once the two searches can't improve on the best path where they met. On large sparse graphs
+    //           this settles far fewer vertices than a one sided search. Throws an exception if either vertex is not in the graph.
+    bool bidirectionalShortestPath(const VertexType &, const VertexType &, GraphTraveler<VertexType> * = nullptr);
+
 
     // @func   - aStar
     // @args   - #1 Data contained in starting vertex for search, #2 Vector of possible goal vertices to reach, #3 Pointer
@@ -325,6 +545,17 @@ public:
     // @info   - Performs the A* path-finding algorithm to get from a starting vertex to any goal vertex in a list of vertices.
     std::vector<VertexType> aStar(const VertexType &, std::vector<VertexType>, double hueristic(VertexType&, VertexType&));
 
+    // @func   - aStar
+    // @args   - #1 Data contained in starting vertex for search, #2 Vector of possible goal vertices to reach, #3 Any callable
+    //           taking (VertexType&, VertexType&) that estimates the distance from a vertex to a goal, #4 optional pointer
+    //           that gets the number of vertices the search expanded
+    // @return - Vector containing, in-order, the vertices to take to reach the closest goal (not including the start). Empty
+    //           if you are there or no path exists.
+    // @info   - A vertex is estimated by its smallest estimate over all of the goals, so the path is a shortest one as long
+    //           as the heuristic never overestimates the distance to a goal. Passing nullptr picks the version above.
+    template <class Heuristic, class = typename std::enable_if<!std::is_same<Heuristic, std::nullptr_t>::value>::type>
+    std::vector<VertexType> aStar(const VertexType &, const std::vector<VertexType> &, Heuristic, unsigned int * = nullptr);
+
 
 
     //////////////////////////////////////////////////////
@@ -350,6 +581,15 @@ private:
     //           that vertex and all of the edges eminating from it to other vertices in the graph
     std::vector< AdjList<VertexType> * > list;
 
+    // @member - vertex_pool
+    // @info   - Slab allocator that every AdjList in the list vector is allocated from
+    ObjectPool<AdjList<VertexType> > vertex_pool;
+
+    // @member - edge_pool
+    // @info   - Slab allocator that every Edge in the graph is allocated from. The AdjLists hold a pointer to this pool, it is
+    //           released in one shot when the graph is destroyed instead of freeing the edges one by one.
+    ObjectPool<Edge<VertexType> > edge_pool;
+
     // @member - lookup_map
     // @info   - Allows us to look up where in our vector of vertices a vertex with a given set of VertexData is. This allows us to
     //           have an (amortized) O(1) lookup time to find a Vertex given a piece of VertexData, as apposed to scanning linearly
@@ -358,6 +598,27 @@ private:
     //           Value   - A pointer to the AdjList object for the Vertex that contains the data contained by the key.
     std::unordered_map<VertexType,  AdjList<VertexType> *> lookup_map;
 
+    // @member - reverse_offsets, reverse_sources, reverse_weights
+    // @info   - A packed reverse view of the graph, the edges entering vertex i come from reverse_sources[j] with weight reverse_weights[j]
+    //           for every j in [reverse_offsets[i], reverse_offsets[i+1]). It is built on demand by buildReverseView and thrown away
+    //           (reverse_valid = false) whenever the vertices or edges of the graph change.
+    mutable std::vector<unsigned int> reverse_offsets;
+    mutable std::vector<unsigned int> reverse_sources;
+    mutable std::vector<double> reverse_weights;
+    mutable bool reverse_valid;
+
+    // @member - in_edges
+    // @info   - in_edges[i] holds every edge entering the vertex with id i, in no particular order. Our adjacency lists only hold
+    //           the edges leaving each vertex, so without it deleting a vertex would have to scan the whole graph for the edges
+    //           pointing at it. Every function that adds or removes an edge keeps it up to date through indexEdge/unindexEdge.
+    //           Empty while in_edge_index is false.
+    std::vector<std::vector<Edge<VertexType> *> > in_edges;
+
+    // @member - in_edge_index
+    // @info   - Whether in_edges is being kept, see setInEdgeIndex. This is a setting of the graph object rather than part of its
+    //           contents, so assigning another graph to this one leaves it alone.
+    bool in_edge_index;
+
     // @typedef - (too long to retype)
     // @info    - This is a pair of unordered_maps that is returned from the dijkstras algorithm to the helper function. Contained
     //            inside these two maps is both the shortest path from the source vertex to any other node in the graph, and the net
@@ -372,12 +633,63 @@ private:
     ////////       PRIVATE FUNCTIONS     /////////////////
     //////////////////////////////////////////////////////
 
+    // @func   - copyFrom
+    // @args   - #1 The graph to copy the vertices and edges of
+    // @info   - Used by the copy constructor and operator=, this graph has to be empty when it's called.
+    void copyFrom(const dGraph<VertexType> &);
+
     // @func   - findVertex
     // @args   - #1 Value contained in the vertex to be found
     // @return - pointer to the vertex to be found, null if not found
     // @info   - Goes through our vector of vertices and find which one (if any) contain the data given by the argument
     AdjList<VertexType> *  findVertex(const VertexType &) const;
 
+    // @func   - findOrInsertVertex
+    // @args   - #1 Value contained in the vertex to be found
+    // @return - pointer to the AdjList of the vertex, which is inserted first if it isn't already in the graph
+    AdjList<VertexType> *  findOrInsertVertex(const VertexType &);
+
+    // @func   - indexEdge
+    // @args   - #1 An edge that was just added to the adjacency list of its source
+    // @info   - Records the edge in the in_edges list of its target.
+    void indexEdge(Edge<VertexType> *);
+
+    // @func   - unindexEdge
+    // @args   - #1 An edge that is about to be deleted from the adjacency list of its source
+    // @info   - Removes the edge from the in_edges list of its target, O(in degree of the target).
+    void unindexEdge(Edge<VertexType> *);
+
+    // @func   - reachable
+    // @args   - #1 Id of the vertex to start from, #2 bool, if true follow the edges backwards
+    // @return - The number of vertices that can be reached from (or can reach, if backwards) the starting vertex
+    unsigned int reachable(unsigned int, bool = false) const;
+
+    // @func   - dijkstras
+    // @args   - #1 id of the source vertex, #2 id of the destination vertex (-1 for none), #3 the workspace to leave the
+    //           distances and predecessors in
+    // @info   - Runs Dijkstra's algorithm over the dense vertex ids.
+    void dijkstras(unsigned int, int, SearchWorkspace<VertexType> &) const;
+
+    // @func   - tarjan
+    // @args   - #1 Output, the component of every vertex, #2 bool, if true stop as soon as the first component is finished
+    // @return - The number of components that were finished
+    unsigned int tarjan(std::vector<unsigned int> &, bool = false) const;
+
+    // @func   - packArcs
+    // @args   - #1 output offsets, #2 output targets, #3 output weights
+    // @info   - Packs the adjacency lists into flat arrays, the edges leaving vertex i are at [offsets[i], offsets[i+1]).
+    void packArcs(std::vector<unsigned int> &, std::vector<unsigned int> &, std::vector<double> &) const;
+
+    // @func   - buildReverseView
+    // @info   - Rebuilds the reverse_* arrays with a counting sort over the edges if they are out of date, O(V+E).
+    void buildReverseView() const;
+
+    // @func   - bidirectional
+    // @args   - #1 id of the source vertex, #2 id of the destination vertex, #3 output, the ids along the path from source to destination
+    // @return - False if there is no path
+    // @info   - Bidirectional Dijkstra over the dense vertex ids, the backward search walks the reverse view.
+    bool bidirectional(unsigned int, unsigned int, std::vector<unsigned int> &) const;
+
 
 };
 
@@ -0,0 +1,342 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - EdgeListReader.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the EdgeListReader class, see EdgeListReader.h for the formats it understands.
+*               The reader isn't a template, so everything in here is marked inline to keep the header-only layout the rest
+*               of the project uses.
+**/
+
+#include "EdgeListReader.h"
+
+// @func  - Constructor
+// @args  - #1 The file to read, #2 the format of the file, #3 the size of the read buffer in bytes
+// @error - Throws a logic_error if the file can't be opened
+inline EdgeListReader::EdgeListReader(const std::string & fn, EdgeListFormat fmt, unsigned int buffer_size) :
+    file(nullptr), filename(fn), format(fmt), buffer(nullptr), capacity(buffer_size ? buffer_size : 1), pos(nullptr),
+    end(nullptr), eof(false), line_number(0), expected_vertices(0), expected_edges(0) {
+
+    file = std::fopen(fn.c_str(), "rb");
+
+    if(file == nullptr)
+        throw std::logic_error("Could Not Open Graph File : " + fn + "\n");
+
+    buffer = new char[capacity+1];
+    pos = end = buffer;
+    *end = '\0';
+
+    if(format != EdgeListFormat::Auto)
+        return;
+
+    // the extension is the strongest hint we have
+    std::string::size_type dot = fn.find_last_of('.');
+    std::string ext = dot == std::string::npos ? "" : fn.substr(dot);
+
+    if(ext == ".gr" || ext == ".dimacs") {
+        format = EdgeListFormat::DIMACS;
+        return;
+    }
+
+    // otherwise peek at the first thing in the file, DIMACS files always start with a comment or problem line
+    refill();
+
+    const char * peek = pos;
+    while(peek < end && (*peek == ' ' || *peek == '\t' || *peek == '\r' || *peek == '\n'))
+        peek++;
+
+    if(peek+1 < end && (*peek == 'c' || *peek == 'p') && (peek[1] == ' ' || peek[1] == '\t' || peek[1] == '\n'))
+        format = EdgeListFormat::DIMACS;
+    else
+        format = EdgeListFormat::EdgeList;
+}
+
+// @func - Destructor
+// @info - Closes the file and frees the buffer
+inline EdgeListReader::~EdgeListReader() {
+
+    if(file != nullptr)
+        std::fclose(file);
+
+    delete[] buffer;
+}
+
+// @func   - next
+// @args   - #1 The record to fill in
+// @return - Bool, false once the end of the file has been reached
+inline bool EdgeListReader::next(EdgeListRecord & record) {
+
+    const char * line, * line_end;
+
+    while(nextLine(line, line_end)) {
+
+        while(line < line_end && (*line == ' ' || *line == '\t'))
+            line++;
+
+        if(line == line_end)
+            continue;
+
+        EdgeListToken weight;
+
+        if(format == EdgeListFormat::DIMACS) {
+
+            char type = *line++;
+
+            if(type == 'c')
+                continue;
+
+            // p <problem type> <vertices> <edges>
+            if(type == 'p') {
+                EdgeListToken problem, num_vertices, num_edges;
+                if(!nextToken(line, line_end, problem) || !nextToken(line, line_end, num_vertices) || !nextToken(line, line_end, num_edges))
+                    error("Malformed Problem Line");
+
+                expected_vertices = readVertex<unsigned long>(num_vertices);
+                expected_edges = readVertex<unsigned long>(num_edges);
+                continue;
+            }
+
+            if(type != 'a' && type != 'e')
+                error(std::string("Unknown DIMACS Line Type '") + type + "'");
+
+            if(!nextToken(line, line_end, record.source) || !nextToken(line, line_end, record.target))
+                error("Edge Line Needs a Source and a Target");
+
+            record.has_target = true;
+        }
+        else {
+
+            if(*line == '#' || *line == '%')
+                continue;
+
+            nextToken(line, line_end, record.source);
+            record.has_target = nextToken(line, line_end, record.target);
+        }
+
+        record.has_weight = nextToken(line, line_end, weight);
+        record.weight = record.has_weight ? parseWeight(weight) : 1.0;
+
+        if(record.has_weight && !record.has_target)
+            error("Weight Given Without a Target");
+
+        EdgeListToken extra;
+        if(nextToken(line, line_end, extra))
+            error("Too Many Fields on Line");
+
+        return true;
+    }
+
+    return false;
+}
+
+// @func   - getFormat
+// @return - The format the file is being parsed as, never Auto
+inline EdgeListFormat EdgeListReader::getFormat() const {
+    return format;
+}
+
+// @func   - getExpectedVertices
+// @return - The number of vertices given by the header of the file, 0 if there is no header
+inline unsigned long EdgeListReader::getExpectedVertices() const {
+    return expected_vertices;
+}
+
+// @func   - getExpectedEdges
+// @return - The number of edges given by the header of the file, 0 if there is no header
+inline unsigned long EdgeListReader::getExpectedEdges() const {
+    return expected_edges;
+}
+
+// @func   - getLineNumber
+// @return - The line number of the last line that was read
+inline unsigned long EdgeListReader::getLineNumber() const {
+    return line_number;
+}
+
+// @func   - nextLine
+// @args   - #1 Set to the start of the line, #2 set to the end of the line (not including the newline)
+// @return - Bool, false at the end of the file
+inline bool EdgeListReader::nextLine(const char *& line, const char *& line_end) {
+
+    while(true) {
+
+        char * newline = static_cast<char *>(std::memchr(pos, '\n', end-pos));
+
+        if(newline != nullptr || (eof && pos < end)) {
+
+            line = pos;
+            line_end = newline ? newline : end;
+            pos = newline ? newline+1 : end;
+            line_number++;
+
+            // windows line endings
+            if(line_end > line && line_end[-1] == '\r')
+                line_end--;
+
+            return true;
+        }
+
+        // anything left in the buffer was handed out above, so at the end of the file we're done
+        if(eof)
+            return false;
+
+        refill();
+    }
+}
+
+// @func   - refill
+// @return - Bool, false if nothing more could be read
+inline bool EdgeListReader::refill() {
+
+    unsigned int leftover = end-pos;
+
+    if(leftover == capacity) {
+        // a single line fills the whole buffer, so make the buffer bigger
+        char * bigger = new char[capacity*2+1];
+        std::memcpy(bigger, pos, leftover);
+        delete[] buffer;
+        buffer = bigger;
+        capacity *= 2;
+    }
+    else if(pos != buffer) {
+        std::memmove(buffer, pos, leftover);
+    }
+
+    pos = buffer;
+    end = buffer + leftover;
+
+    size_t count = std::fread(end, 1, capacity-leftover, file);
+    end += count;
+    *end = '\0';
+
+    if(count == 0)
+        eof = true;
+
+    return count > 0;
+}
+
+// @func   - nextToken
+// @args   - #1 The position to start from, moved past the token, #2 end of the line, #3 the token to fill in
+// @return - Bool, false if there are no more tokens on the line
+inline bool EdgeListReader::nextToken(const char *& at, const char * line_end, EdgeListToken & token) {
+
+    while(at < line_end && (*at == ' ' || *at == '\t'))
+        at++;
+
+    if(at == line_end)
+        return false;
+
+    token.begin = at;
+
+    while(at < line_end && *at != ' ' && *at != '\t')
+        at++;
+
+    token.end = at;
+
+    return true;
+}
+
+// @func   - parseWeight
+// @args   - #1 The token holding the weight
+// @return - The weight, throws a logic_error if the token isn't a number
+inline double EdgeListReader::parseWeight(const EdgeListToken & token) const {
+
+    // the token is always followed by whitespace, a newline, or the '\0' we keep after the data, so strtod stops on its own
+    char * parsed;
+    double weight = std::strtod(token.begin, &parsed);
+
+    if(parsed != token.end)
+        error("Invalid Edge Weight '" + std::string(token.begin, token.end) + "'");
+
+    return weight;
+}
+
+// @func   - readVertex
+// @args   - #1 A token from the last record
+// @return - The token converted to the vertex type with parseVertex
+template <class VertexType>
+VertexType EdgeListReader::readVertex(const EdgeListToken & token) const {
+
+    try {
+        return parseVertex<VertexType>(token);
+    }
+    catch(const std::logic_error & e) {
+        std::string what = e.what();
+        error(what.substr(0, what.find('\n')));
+        throw;
+    }
+}
+
+// @func - error
+// @args - #1 Description of the problem
+inline void EdgeListReader::error(const std::string & what) const {
+
+    std::ostringstream message;
+    message << filename << ":" << line_number << " : " << what << "\n";
+
+    throw std::logic_error(message.str());
+}
+
+// @func   - parseVertex (integral types)
+// @args   - #1 A token returned by the EdgeListReader
+// @return - The token converted to the vertex type
+template <class VertexType>
+typename std::enable_if<std::is_integral<VertexType>::value, VertexType>::type parseVertex(const EdgeListToken & token) {
+
+    const char * at = token.begin;
+    bool negative = false;
+
+    if(at < token.end && (*at == '-' || *at == '+')) {
+        negative = *at == '-';
+        at++;
+    }
+
+    if(at == token.end || (negative && !std::is_signed<VertexType>::value))
+        throw std::logic_error("Invalid Vertex '" + std::string(token.begin, token.end) + "'\n");
+
+    // the digits are added up as an unsigned magnitude, which has room for the magnitude of min() as well as max()
+    typedef typename std::make_unsigned<VertexType>::type Magnitude;
+    Magnitude limit = (Magnitude) std::numeric_limits<VertexType>::max() + (negative ? 1 : 0);
+    Magnitude value = 0;
+
+    for(; at < token.end; at++) {
+        if(*at < '0' || *at > '9')
+            throw std::logic_error("Invalid Vertex '" + std::string(token.begin, token.end) + "'\n");
+
+        Magnitude digit = *at - '0';
+        if(value > (limit - digit) / 10)
+            throw std::logic_error("Vertex Out of Range '" + std::string(token.begin, token.end) + "'\n");
+
+        value = value*10 + digit;
+    }
+
+    // -(value-1)-1 never leaves the range of the type, even when the magnitude is that of min()
+    if(negative && value)
+        return -(VertexType) (value - 1) - 1;
+
+    return (VertexType) value;
+}
+
+// @func   - parseVertex (std::string)
+// @args   - #1 A token returned by the EdgeListReader
+// @return - The token as a string
+template <class VertexType>
+typename std::enable_if<std::is_same<VertexType, std::string>::value, VertexType>::type parseVertex(const EdgeListToken & token) {
+    return std::string(token.begin, token.end);
+}
+
+// @func   - parseVertex (everything else)
+// @args   - #1 A token returned by the EdgeListReader
+// @return - The token converted with the vertex type's operator>>
+template <class VertexType>
+typename std::enable_if<!std::is_integral<VertexType>::value && !std::is_same<VertexType, std::string>::value, VertexType>::type
+parseVertex(const EdgeListToken & token) {
+
+    std::istringstream stream(std::string(token.begin, token.end));
+    VertexType value;
+
+    if(!(stream >> value) || stream.peek() != EOF)
+        throw std::logic_error("Invalid Vertex '" + std::string(token.begin, token.end) + "'\n");
+
+    return value;
+}
@@ -0,0 +1,164 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - EdgeListReader.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the declaration of the EdgeListReader class, a streaming parser for the text formats that large graphs
+*               are usually distributed in. The graph classes use it to implement their file-loading constructors.
+*
+*   @Details  - Three formats are understood :
+*               EdgeList - One edge per line, "src dst [weight]", separated by any amount of spaces or tabs. Lines that start
+*                          with '#' or '%' are comments. A line with a single token declares a vertex with no edges.
+*               SNAP     - The format of the Stanford Large Network Dataset Collection, "src<tab>dst" with '#' comments. This
+*                          is a special case of EdgeList and is parsed by the same code.
+*               DIMACS   - The format of the DIMACS shortest path challenge. 'c' lines are comments, the 'p' line gives the
+*                          number of vertices and edges, and every 'a src dst weight' (or 'e src dst [weight]') line is an edge.
+*               Auto     - Picks DIMACS if the file ends in .gr or .dimacs or starts with a 'c' or 'p' line, EdgeList otherwise.
+*
+*               The file is read through one large buffer that is refilled with fread, and the reader never copies a line
+*               out of it. Each record hands back tokens that point straight into the buffer, which stay valid until the
+*               next call to next(), so parsing a multi-gigabyte file performs no per-line allocation at all. The caller
+*               turns the tokens into vertex data with readVertex<VertexType>, which goes through parseVertex<VertexType>
+*               (with its hand-rolled fast path for the integral types) and adds the line number to any error.
+**/
+
+#ifndef EDGE_LIST_READER_H
+#define EDGE_LIST_READER_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <limits>
+
+// @enum - EdgeListFormat
+// @info - The file formats the EdgeListReader understands, see the top of this file for a description of each
+enum class EdgeListFormat { Auto, EdgeList, SNAP, DIMACS };
+
+// @struct - EdgeListToken
+// @info   - A single whitespace separated token, [begin, end) points into the reader's buffer
+struct EdgeListToken
+{
+    const char * begin;
+    const char * end;
+};
+
+// @struct - EdgeListRecord
+// @info   - One record of the file, either a vertex on its own (has_target == false) or an edge
+struct EdgeListRecord
+{
+    EdgeListToken source;
+    EdgeListToken target;
+    bool has_target;
+    double weight;
+    bool has_weight;
+};
+
+class EdgeListReader
+{
+public:
+
+    // @func  - Constructor
+    // @args  - #1 The file to read, #2 the format of the file, #3 the size of the read buffer in bytes
+    // @error - Throws a logic_error if the file can't be opened
+    EdgeListReader(const std::string &, EdgeListFormat = EdgeListFormat::Auto, unsigned int = 1 << 20);
+
+    // @func - Destructor
+    // @info - Closes the file and frees the buffer
+    ~EdgeListReader();
+
+    // @func   - next
+    // @args   - #1 The record to fill in
+    // @return - Bool, false once the end of the file has been reached
+    // @error  - Throws a logic_error (with the line number) if a line can't be parsed
+    bool next(EdgeListRecord &);
+
+    // @func   - getFormat
+    // @return - The format the file is being parsed as, never Auto
+    EdgeListFormat getFormat() const;
+
+    // @func   - getExpectedVertices, getExpectedEdges
+    // @return - The sizes given by the header of the file (the DIMACS 'p' line), 0 if the file has no header or it hasn't been read yet
+    unsigned long getExpectedVertices() const;
+    unsigned long getExpectedEdges() const;
+
+    // @func   - getLineNumber
+    // @return - The line number of the last line that was read
+    unsigned long getLineNumber() const;
+
+    // @func   - readVertex
+    // @args   - #1 A token from the last record
+    // @return - The token converted to the vertex type with parseVertex
+    // @error  - Throws a logic_error (with the line number) if the token isn't a valid value of the vertex type
+    template <class VertexType>
+    VertexType readVertex(const EdgeListToken &) const;
+
+private:
+
+    // We own a FILE handle and a buffer, so we can't be copied
+    EdgeListReader(const EdgeListReader &);
+    EdgeListReader & operator=(const EdgeListReader &);
+
+    // @func   - nextLine
+    // @args   - #1 Set to the start of the line, #2 set to the end of the line (not including the newline)
+    // @return - Bool, false at the end of the file
+    // @info   - Refills the buffer when the current line runs off the end of it, growing the buffer for lines longer than it.
+    bool nextLine(const char *&, const char *&);
+
+    // @func   - refill
+    // @return - Bool, false if nothing more could be read
+    // @info   - Moves the unread tail of the buffer to the front and reads as much as fits after it.
+    bool refill();
+
+    // @func   - nextToken
+    // @args   - #1 The position to start from, moved past the token, #2 end of the line, #3 the token to fill in
+    // @return - Bool, false if there are no more tokens on the line
+    static bool nextToken(const char *&, const char *, EdgeListToken &);
+
+    // @func   - parseWeight
+    // @args   - #1 The token holding the weight
+    // @return - The weight, throws a logic_error if the token isn't a number
+    double parseWeight(const EdgeListToken &) const;
+
+    // @func - error
+    // @args - #1 Description of the problem
+    // @info - Throws a logic_error that includes the file name and the current line number
+    void error(const std::string &) const;
+
+    std::FILE * file;
+    std::string filename;
+    EdgeListFormat format;
+
+    // @member - buffer
+    // @info   - The read buffer, [pos, end) is the data that hasn't been parsed yet. There is always room for one
+    //           extra byte at *end which we keep as '\0', so strtod can never run off the end of the data.
+    char * buffer;
+    unsigned int capacity;
+    char * pos;
+    char * end;
+    bool eof;
+
+    unsigned long line_number;
+    unsigned long expected_vertices, expected_edges;
+};
+
+// @func   - parseVertex
+// @args   - #1 A token returned by the EdgeListReader
+// @return - The token converted to the vertex type. The integral types are parsed by hand, std::string is constructed straight
+//           from the token, and everything else goes through an std::istringstream (so it needs an operator>>).
+// @error  - Throws a logic_error if the token isn't a valid value of the vertex type, or is out of the range of an integral type
+template <class VertexType>
+typename std::enable_if<std::is_integral<VertexType>::value, VertexType>::type parseVertex(const EdgeListToken &);
+
+template <class VertexType>
+typename std::enable_if<std::is_same<VertexType, std::string>::value, VertexType>::type parseVertex(const EdgeListToken &);
+
+template <class VertexType>
+typename std::enable_if<!std::is_integral<VertexType>::value && !std::is_same<VertexType, std::string>::value, VertexType>::type
+parseVertex(const EdgeListToken &);
+
+#include "EdgeListReader.cpp"
+#endif
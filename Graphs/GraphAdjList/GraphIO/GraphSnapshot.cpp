@@ -0,0 +1,516 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - GraphSnapshot.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the GraphSnapshot class, see GraphSnapshot.h for the layout of the file.
+**/
+
+#include "GraphSnapshot.h"
+
+// @func   - snapshotEncode
+// @args   - #1 Vertex data to write into a non-integral vertex table
+// @return - The bytes to store for the vertex, which parseVertex turns back into the same data
+inline std::string snapshotEncode(const std::string & data) {
+    return data;
+}
+
+template <class VertexType>
+std::string snapshotEncode(const VertexType & data) {
+
+    // floating point data is written with enough digits to read back the exact same value, the default 6 would let
+    // vertices that only differ past the sixth digit collapse into one
+    std::ostringstream stream;
+    if(std::numeric_limits<VertexType>::is_specialized)
+        stream.precision(std::numeric_limits<VertexType>::max_digits10);
+    stream << data;
+    return stream.str();
+}
+
+
+// @func   - write
+// @args   - #1 The graph to write out, #2 the file to write it to
+// @return - Bool, false if the file couldn't be written
+template <class VertexType>
+bool GraphSnapshot<VertexType>::write(const dGraph<VertexType> & graph, const std::string & fn) {
+    return write(csrGraph<VertexType>(graph), fn);
+}
+
+// @func   - write
+// @args   - #1 The graph to write out, #2 the file to write it to
+// @return - Bool, false if the file couldn't be written
+template <class VertexType>
+bool GraphSnapshot<VertexType>::write(const uGraph<VertexType> & graph, const std::string & fn) {
+    return write(csrGraph<VertexType>(graph), fn);
+}
+
+// @func   - write
+// @args   - #1 The graph to write out, #2 the file to write it to
+// @return - Bool, false if the file couldn't be written
+// @info   - The header is written last, so a file that was only partly written never has a valid magic number.
+template <class VertexType>
+bool GraphSnapshot<VertexType>::write(const csrGraph<VertexType> & graph, const std::string & fn) {
+
+    FILE * file = std::fopen(fn.c_str(), "wb");
+
+    if(file == nullptr)
+        return false;
+
+    SnapshotHeader head;
+    std::memset(&head, 0, sizeof(head));
+
+    bool ok = std::fwrite(&head, sizeof(head), 1, file) == 1;
+
+    head.version = VERSION;
+    head.byte_order = 0x01020304;
+    head.flags = (graph.is_directed ? 1 : 0) | (is_integral::value ? 2 : 0);
+    head.vertex_size = sizeof(VertexType);
+    head.num_vertices = graph.vertices.size();
+    head.num_edges = graph.num_edges;
+    head.num_arcs = graph.targets.size();
+
+    ok = ok && writeVertices(file, graph, head, is_integral());
+
+    std::vector<uint64_t> wide_offsets(graph.offsets.begin(), graph.offsets.end());
+    std::vector<uint32_t> narrow_targets(graph.targets.begin(), graph.targets.end());
+
+    head.offsets_offset = writeSection(file, wide_offsets.data(), wide_offsets.size()*sizeof(uint64_t), ok);
+    head.targets_offset = writeSection(file, narrow_targets.data(), narrow_targets.size()*sizeof(uint32_t), ok);
+    head.weights_offset = writeSection(file, graph.weights.data(), graph.weights.size()*sizeof(double), ok);
+    head.file_size = ok ? std::ftell(file) : 0;
+
+    std::memcpy(head.magic, "GRAPHSNP", 8);
+
+    ok = ok && std::fseek(file, 0, SEEK_SET) == 0 && std::fwrite(&head, sizeof(head), 1, file) == 1;
+    ok = (std::fclose(file) == 0) && ok;
+
+    return ok;
+}
+
+// @func  - Constructor
+// @args  - #1 The snapshot file to open
+// @error - Throws a logic_error if the file can't be mapped or isn't a snapshot of a graph over this VertexType
+template <class VertexType>
+GraphSnapshot<VertexType>::GraphSnapshot(const std::string & fn) : base(nullptr), size(0), header(nullptr), offsets(nullptr),
+    targets(nullptr), weights(nullptr), vertex_table(nullptr), sorted_index(nullptr) {
+
+    int fd = ::open(fn.c_str(), O_RDONLY);
+
+    if(fd == -1)
+        throw std::logic_error("GraphSnapshot : could not open " + fn);
+
+    struct stat info;
+
+    if(::fstat(fd, &info) == -1 || (size_t) info.st_size < sizeof(SnapshotHeader)) {
+        ::close(fd);
+        throw std::logic_error("GraphSnapshot : " + fn + " is too short to be a snapshot");
+    }
+
+    size = info.st_size;
+    void * mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if(mapping == MAP_FAILED)
+        throw std::logic_error("GraphSnapshot : could not map " + fn);
+
+    base = (const char *) mapping;
+    header = (const SnapshotHeader *) base;
+
+    if(std::memcmp(header->magic, "GRAPHSNP", 8) != 0)
+        error(fn, "not a graph snapshot");
+
+    if(header->byte_order != 0x01020304)
+        error(fn, "written on a machine with a different byte order");
+
+    if(header->version != VERSION)
+        error(fn, "unsupported snapshot version " + std::to_string(header->version));
+
+    if(((header->flags & 2) != 0) != is_integral::value || header->vertex_size != sizeof(VertexType))
+        error(fn, "written for a different vertex type");
+
+    if(header->file_size != size)
+        error(fn, "truncated");
+
+    // every count and offset in the header is checked against the size of the file before anything it points at is read,
+    // the counts first so that none of the sums below can wrap around
+    if(header->num_vertices >= size || header->num_arcs >= size)
+        error(fn, "corrupt header");
+
+    if(!sectionFits(header->offsets_offset, header->num_vertices + 1, sizeof(uint64_t)) ||
+       !sectionFits(header->targets_offset, header->num_arcs, sizeof(uint32_t)) ||
+       !sectionFits(header->weights_offset, header->num_arcs, sizeof(double)))
+        error(fn, "truncated");
+
+    if(is_integral::value ? !sectionFits(header->vertex_offset, header->num_vertices, sizeof(VertexType)) ||
+                            !sectionFits(header->index_offset, header->num_vertices, sizeof(uint32_t))
+                          : !sectionFits(header->vertex_offset, header->num_vertices + 1, sizeof(uint64_t)))
+        error(fn, "truncated");
+
+    // the strings of a non-integral vertex table follow its offsets, and have to fit in what is left of the file
+    if(!is_integral::value) {
+
+        const uint64_t * string_offsets = (const uint64_t *) (base + header->vertex_offset);
+        uint64_t string_bytes = size - header->vertex_offset - (header->num_vertices + 1)*sizeof(uint64_t);
+
+        for(uint64_t i = 0; i < header->num_vertices; i++)
+            if(string_offsets[i] > string_offsets[i+1])
+                error(fn, "corrupt vertex section");
+
+        if(string_offsets[header->num_vertices] > string_bytes)
+            error(fn, "truncated");
+    }
+
+    offsets = (const uint64_t *) (base + header->offsets_offset);
+    targets = (const uint32_t *) (base + header->targets_offset);
+    weights = (const double *) (base + header->weights_offset);
+
+    // every id and offset the queries follow has to stay inside its section, this is the one pass over the file that
+    // opening it makes
+    if(offsets[0] != 0 || offsets[header->num_vertices] != header->num_arcs)
+        error(fn, "corrupt offsets section");
+
+    for(uint64_t i = 0; i < header->num_vertices; i++)
+        if(offsets[i] > offsets[i+1])
+            error(fn, "corrupt offsets section");
+
+    for(uint64_t j = 0; j < header->num_arcs; j++)
+        if(targets[j] >= header->num_vertices)
+            error(fn, "corrupt targets section");
+
+    if(is_integral::value) {
+
+        const uint32_t * index = (const uint32_t *) (base + header->index_offset);
+
+        for(uint64_t i = 0; i < header->num_vertices; i++)
+            if(index[i] >= header->num_vertices)
+                error(fn, "corrupt index section");
+    }
+
+    openVertices(is_integral());
+}
+
+// @func - Destructor
+// @info - Unmaps the file
+template <class VertexType>
+GraphSnapshot<VertexType>::~GraphSnapshot() {
+
+    if(base != nullptr)
+        ::munmap((void *) base, size);
+}
+
+// @func   - isDirected
+// @return - True if the snapshot was written from a directed graph
+template <class VertexType>
+bool GraphSnapshot<VertexType>::isDirected() const {
+    return header->flags & 1;
+}
+
+// @func   - getNumVertices
+// @return - The number of vertices in the graph
+template <class VertexType>
+int GraphSnapshot<VertexType>::getNumVertices() const {
+    return header->num_vertices;
+}
+
+// @func   - getNumEdges
+// @return - The number of edges in the graph (for undirected graphs each edge is counted once)
+template <class VertexType>
+int GraphSnapshot<VertexType>::getNumEdges() const {
+    return header->num_edges;
+}
+
+// @func   - containsVertex
+// @args   - #1 data associated with the vertex that you wish to query for existence
+// @return - Bool corresponding to the existence of a vertex with the given data in this graph
+template <class VertexType>
+bool GraphSnapshot<VertexType>::containsVertex(const VertexType & data) const {
+    return getVertexId(data) != -1;
+}
+
+// @func   - containsEdge
+// @args   - #1 data associated with the 'from' vertex, #2 data associated with the 'to' vertex.
+// @return - Bool corresponding to the existence of an edge in the graph between the two vertices
+template <class VertexType>
+bool GraphSnapshot<VertexType>::containsEdge(const VertexType & v1, const VertexType & v2) const {
+
+    int src = getVertexId(v1), dest = getVertexId(v2);
+
+    return src != -1 && dest != -1 && findArc(src, dest) != -1;
+}
+
+// @func   - getEdgeWeight
+// @args   - #1 data associated with vetex #1, data associated with vertex #2
+// @return - returns the weight of the edge, throws error if edge not found
+template <class VertexType>
+double GraphSnapshot<VertexType>::getEdgeWeight(const VertexType & v1, const VertexType & v2) const {
+
+    int src = getVertexId(v1), dest = getVertexId(v2);
+    long long arc = (src == -1 || dest == -1) ? -1 : findArc(src, dest);
+
+    if(arc == -1)
+        throw std::logic_error("Edge Not Found");
+
+    return weights[arc];
+}
+
+// @func   - getVertexId
+// @args   - #1 Data contained in the vertex to look up
+// @return - The dense integer id of the vertex, -1 if the vertex is not in the graph
+template <class VertexType>
+int GraphSnapshot<VertexType>::getVertexId(const VertexType & data) const {
+    return findVertex(data, is_integral());
+}
+
+// @func   - getVertexData
+// @args   - #1 Dense integer id of a vertex
+// @return - The data contained in the vertex with that id, throws a logic_error if the id is out of range
+template <class VertexType>
+VertexType GraphSnapshot<VertexType>::getVertexData(unsigned int id) const {
+
+    if(id >= header->num_vertices)
+        throw std::logic_error("Vertex Id Out Of Range");
+
+    return (vertex_table != nullptr) ? vertex_table[id] : decoded[id];
+}
+
+// @func   - getDegree
+// @args   - #1 Dense integer id of a vertex, must be in the range [0, getNumVertices())
+// @return - The number of arcs leaving the vertex
+template <class VertexType>
+unsigned int GraphSnapshot<VertexType>::getDegree(unsigned int id) const {
+    return offsets[id+1] - offsets[id];
+}
+
+// @func   - getTargets
+// @args   - #1 Dense integer id of a vertex, must be in the range [0, getNumVertices())
+// @return - Pointer to the getDegree(id) target ids of the vertex, sorted by id.
+template <class VertexType>
+const uint32_t * GraphSnapshot<VertexType>::getTargets(unsigned int id) const {
+    return targets + offsets[id];
+}
+
+// @func   - getWeights
+// @args   - #1 Dense integer id of a vertex, must be in the range [0, getNumVertices())
+// @return - Pointer to the getDegree(id) weights of the vertex, parallel to getTargets.
+template <class VertexType>
+const double * GraphSnapshot<VertexType>::getWeights(unsigned int id) const {
+    return weights + offsets[id];
+}
+
+// @func   - load
+// @args   - #1 The graph to copy the snapshot into, it is emptied first
+// @info   - The arcs are already free of duplicates and self loops, so every insertEdge call succeeds.
+template <class VertexType>
+void GraphSnapshot<VertexType>::load(dGraph<VertexType> & graph) const {
+
+    graph.destroyGraph();
+
+    for(unsigned int i = 0; i < header->num_vertices; i++)
+        graph.insertVertex(getVertexData(i));
+
+    for(unsigned int i = 0; i < header->num_vertices; i++) {
+        VertexType src = getVertexData(i);
+        for(uint64_t arc = offsets[i]; arc < offsets[i+1]; arc++)
+            graph.insertEdge(src, getVertexData(targets[arc]), weights[arc]);
+    }
+}
+
+// @func   - load
+// @args   - #1 The graph to copy the snapshot into, it is emptied first
+// @info   - Each undirected edge is stored as two arcs, only the one leaving the lower id is inserted.
+template <class VertexType>
+void GraphSnapshot<VertexType>::load(uGraph<VertexType> & graph) const {
+
+    graph.destroyGraph();
+
+    for(unsigned int i = 0; i < header->num_vertices; i++)
+        graph.insertVertex(getVertexData(i));
+
+    for(unsigned int i = 0; i < header->num_vertices; i++) {
+        VertexType src = getVertexData(i);
+        for(uint64_t arc = offsets[i]; arc < offsets[i+1]; arc++) {
+            if(targets[arc] > i || (isDirected() && targets[arc] != i))
+                graph.insertEdge(src, getVertexData(targets[arc]), weights[arc]);
+        }
+    }
+}
+
+// @func   - load
+// @args   - #1 The graph to copy the snapshot into, it is emptied first
+// @info   - The snapshot is already in the csrGraph layout, so the arrays are copied straight across.
+template <class VertexType>
+void GraphSnapshot<VertexType>::load(csrGraph<VertexType> & graph) const {
+
+    graph.destroyGraph();
+
+    graph.is_directed = isDirected();
+    graph.num_edges = header->num_edges;
+    graph.vertices.reserve(header->num_vertices);
+    graph.lookup_map.reserve(header->num_vertices);
+
+    for(unsigned int i = 0; i < header->num_vertices; i++) {
+        graph.vertices.push_back(Vertex<VertexType>(getVertexData(i)));
+        graph.lookup_map.insert(std::make_pair(graph.vertices.back().getData(), i));
+    }
+
+    graph.offsets.assign(offsets, offsets + header->num_vertices + 1);
+    graph.targets.assign(targets, targets + header->num_arcs);
+    graph.weights.assign(weights, weights + header->num_arcs);
+}
+
+// @func - openVertices
+// @info - Integral vertex tables are used in place, the sorted index makes lookups a binary search.
+template <class VertexType>
+void GraphSnapshot<VertexType>::openVertices(std::true_type) {
+
+    vertex_table = (const VertexType *) (base + header->vertex_offset);
+    sorted_index = (const uint32_t *) (base + header->index_offset);
+}
+
+// @func - openVertices
+// @info - Anything else is decoded into a vector and indexed with a hash map, just like csrGraph does.
+template <class VertexType>
+void GraphSnapshot<VertexType>::openVertices(std::false_type) {
+
+    const uint64_t * string_offsets = (const uint64_t *) (base + header->vertex_offset);
+    const char * bytes = (const char *) (string_offsets + header->num_vertices + 1);
+
+    decoded.reserve(header->num_vertices);
+    lookup_map.reserve(header->num_vertices);
+
+    for(unsigned int i = 0; i < header->num_vertices; i++) {
+        EdgeListToken token = { bytes + string_offsets[i], bytes + string_offsets[i+1] };
+        decoded.push_back(parseVertex<VertexType>(token));
+        lookup_map.insert(std::make_pair(decoded.back(), i));
+    }
+}
+
+// @func - findVertex
+// @info - Binary search over the sorted index of the mapped vertex table
+template <class VertexType>
+int GraphSnapshot<VertexType>::findVertex(const VertexType & data, std::true_type) const {
+
+    const uint32_t * end = sorted_index + header->num_vertices;
+    const VertexType * table = vertex_table;
+
+    const uint32_t * get = std::lower_bound(sorted_index, end, data,
+        [table](uint32_t id, const VertexType & value) { return table[id] < value; });
+
+    if(get == end || vertex_table[*get] != data)
+        return -1;
+
+    return *get;
+}
+
+// @func - findVertex
+// @info - Hash map lookup into the decoded vertex table
+template <class VertexType>
+int GraphSnapshot<VertexType>::findVertex(const VertexType & data, std::false_type) const {
+
+    auto get = lookup_map.find(data);
+
+    if(get == lookup_map.end())
+        return -1;
+
+    return get->second;
+}
+
+// @func - findArc
+// @args - #1 id of the source vertex, #2 id of the target vertex
+// @info - Binary searches the sorted arcs of the source vertex, returns the arc index or -1
+template <class VertexType>
+long long GraphSnapshot<VertexType>::findArc(unsigned int src, unsigned int dest) const {
+
+    const uint32_t * begin = targets + offsets[src];
+    const uint32_t * end = targets + offsets[src+1];
+    const uint32_t * get = std::lower_bound(begin, end, dest);
+
+    if(get == end || *get != dest)
+        return -1;
+
+    return get - targets;
+}
+
+// @func - writeVertices
+// @info - Integral types write the vertex table as is, followed by the ids sorted by vertex value.
+template <class VertexType>
+bool GraphSnapshot<VertexType>::writeVertices(FILE * file, const csrGraph<VertexType> & graph, SnapshotHeader & head, std::true_type) {
+
+    bool ok = true;
+    std::vector<VertexType> table;
+    std::vector<uint32_t> index(graph.vertices.size());
+
+    table.reserve(graph.vertices.size());
+
+    for(unsigned int i = 0; i < graph.vertices.size(); i++) {
+        table.push_back(graph.vertices[i].getData());
+        index[i] = i;
+    }
+
+    std::sort(index.begin(), index.end(), [&table](uint32_t a, uint32_t b) { return table[a] < table[b]; });
+
+    head.vertex_offset = writeSection(file, table.data(), table.size()*sizeof(VertexType), ok);
+    head.index_offset = writeSection(file, index.data(), index.size()*sizeof(uint32_t), ok);
+
+    return ok;
+}
+
+// @func - writeVertices
+// @info - Everything else is written as text, string i lives in [offsets[i], offsets[i+1]) of the bytes after the offsets.
+template <class VertexType>
+bool GraphSnapshot<VertexType>::writeVertices(FILE * file, const csrGraph<VertexType> & graph, SnapshotHeader & head, std::false_type) {
+
+    bool ok = true;
+    std::string bytes;
+    std::vector<uint64_t> string_offsets(1, 0);
+
+    string_offsets.reserve(graph.vertices.size()+1);
+
+    for(auto & vert : graph.vertices) {
+        bytes += snapshotEncode(vert.getData());
+        string_offsets.push_back(bytes.size());
+    }
+
+    head.vertex_offset = writeSection(file, string_offsets.data(), string_offsets.size()*sizeof(uint64_t), ok);
+    head.index_offset = 0;
+
+    ok = ok && std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+
+    return ok;
+}
+
+// @func   - sectionFits
+// @args   - #1 The offset of the section, #2 the number of elements in it, #3 the size of each element
+// @return - True if the section starts on an 8 byte boundary, as writeSection leaves it, and lies entirely inside of the
+//           mapped file
+template <class VertexType>
+bool GraphSnapshot<VertexType>::sectionFits(uint64_t offset, uint64_t count, uint64_t width) const {
+    return offset % 8 == 0 && offset <= size && count <= (size - offset) / width;
+}
+
+// @func - writeSection
+// @info - Pads the file out to an 8 byte boundary and writes the given bytes, returns the offset they were written at
+template <class VertexType>
+uint64_t GraphSnapshot<VertexType>::writeSection(FILE * file, const void * data, size_t bytes, bool & ok) {
+
+    static const char padding[8] = {0};
+
+    long position = std::ftell(file);
+    size_t pad = (8 - position % 8) % 8;
+
+    ok = ok && position != -1 && std::fwrite(padding, 1, pad, file) == pad;
+    ok = ok && (bytes == 0 || std::fwrite(data, 1, bytes, file) == bytes);
+
+    return position + pad;
+}
+
+// @func - error
+// @info - Unmaps the file and throws a logic_error describing what was wrong with it
+template <class VertexType>
+void GraphSnapshot<VertexType>::error(const std::string & fn, const std::string & msg) {
+
+    ::munmap((void *) base, size);
+    base = nullptr;
+
+    throw std::logic_error("GraphSnapshot : " + fn + " " + msg);
+}
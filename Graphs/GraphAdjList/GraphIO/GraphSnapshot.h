@@ -0,0 +1,237 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - GraphSnapshot.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the declaration of the GraphSnapshot class, a versioned binary file format for graphs that is written
+*               once from an existing graph and then opened with mmap. Opening a snapshot doesn't parse or copy anything, the
+*               queries below read straight out of the mapped pages, so a process that restarts often can have its graph back
+*               in the time it takes the kernel to map the file and read through it once, instead of rebuilding it edge by
+*               edge.
+*
+*   @Details  - A snapshot is the compressed sparse row layout of the csrGraph class written to disk. Every section starts on
+*               an 8 byte boundary so that it can be used in place :
+*               -------------------------------------------------------------------------------
+*               header  | magic, version, byte order, flags, sizeof(VertexType), counts, offsets |
+*               vertex  | integral types - VertexType[V] in id order                            |
+*                       | anything else  - uint64[V+1] string offsets, then the encoded bytes   |
+*               index   | integral types only - uint32[V] of vertex ids sorted by vertex value  |
+*               offsets | uint64[V+1], the edges of vertex i are in [offsets[i], offsets[i+1])  |
+*               targets | uint32[A], the id of the target of each arc, sorted within a vertex   |
+*               weights | double[A], the weight of each arc                                     |
+*               -------------------------------------------------------------------------------
+*               A is the number of arcs, which is the number of edges for a directed graph and twice that for an undirected
+*               one (each edge is stored once in each direction, the same as uGraph and csrGraph do).
+*
+*               Opening a snapshot checks that every section lies inside the file and makes one O(V+A) pass over the
+*               offsets, targets and index to make sure every offset and id in them is in range, so a corrupt file is
+*               refused up front instead of sending a query out of bounds later on.
+*
+*               For integral vertex types the vertex table is used in place as well, and getVertexId binary searches the
+*               sorted index, so nothing is copied out of the file. Any other vertex type is written as text (the same text
+*               parseVertex reads) and has to be decoded into a vector and a hash map when the snapshot is opened.
+**/
+
+#ifndef GRAPH_SNAPSHOT_H
+#define GRAPH_SNAPSHOT_H
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <limits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "EdgeListReader.h"
+#include "../DirectedGraph/dGraph.h"
+#include "../UndirectedGraph/uGraph.h"
+#include "../CompressedGraph/csrGraph.h"
+
+// @struct - SnapshotHeader
+// @info   - The first 104 bytes of every snapshot file, all section offsets are in bytes from the start of the file
+struct SnapshotHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t flags;
+    uint32_t vertex_size;
+    uint64_t num_vertices;
+    uint64_t num_edges;
+    uint64_t num_arcs;
+    uint64_t vertex_offset;
+    uint64_t index_offset;
+    uint64_t offsets_offset;
+    uint64_t targets_offset;
+    uint64_t weights_offset;
+    uint64_t file_size;
+};
+
+template <class VertexType>
+class GraphSnapshot
+{
+public:
+
+    // @const - VERSION
+    // @info  - Bumped whenever the layout of the file changes, files with any other version are refused
+    static const uint32_t VERSION = 1;
+
+    // @func   - write
+    // @args   - #1 The graph to write out, #2 the file to write it to
+    // @return - Bool, false if the file couldn't be written
+    // @info   - The dGraph and uGraph versions freeze the graph into a csrGraph first, the graph itself isn't modified.
+    static bool write(const dGraph<VertexType> &, const std::string &);
+    static bool write(const uGraph<VertexType> &, const std::string &);
+    static bool write(const csrGraph<VertexType> &, const std::string &);
+
+    // @func  - Constructor
+    // @args  - #1 The snapshot file to open
+    // @error - Throws a logic_error if the file can't be mapped or isn't a snapshot of a graph over this VertexType
+    GraphSnapshot(const std::string &);
+
+    // @func - Destructor
+    // @info - Unmaps the file
+    ~GraphSnapshot();
+
+    GraphSnapshot(const GraphSnapshot &) = delete;
+    GraphSnapshot & operator=(const GraphSnapshot &) = delete;
+
+    // @func   - isDirected
+    // @return - True if the snapshot was written from a directed graph
+    bool isDirected() const;
+
+    // @func   - getNumVertices
+    // @return - The number of vertices in the graph
+    int getNumVertices() const;
+
+    // @func   - getNumEdges
+    // @return - The number of edges in the graph (for undirected graphs each edge is counted once)
+    int getNumEdges() const;
+
+    // @func   - containsVertex
+    // @args   - #1 data associated with the vertex that you wish to query for existence
+    // @return - Bool corresponding to the existence of a vertex with the given data in this graph
+    bool containsVertex(const VertexType &) const;
+
+    // @func   - containsEdge
+    // @args   - #1 data associated with the 'from' vertex, #2 data associated with the 'to' vertex.
+    // @return - Bool corresponding to the existence of an edge in the graph between the two vertices
+    bool containsEdge(const VertexType &, const VertexType &) const;
+
+    // @func   - getEdgeWeight
+    // @args   - #1 data associated with vetex #1, data associated with vertex #2
+    // @return - returns the weight of the edge, throws error if edge not found
+    double getEdgeWeight(const VertexType &, const VertexType &) const;
+
+    // @func   - getVertexId
+    // @args   - #1 Data contained in the vertex to look up
+    // @return - The dense integer id of the vertex, -1 if the vertex is not in the graph
+    int getVertexId(const VertexType &) const;
+
+    // @func   - getVertexData
+    // @args   - #1 Dense integer id of a vertex
+    // @return - The data contained in the vertex with that id, throws a logic_error if the id is out of range
+    VertexType getVertexData(unsigned int) const;
+
+    // @func   - getDegree
+    // @args   - #1 Dense integer id of a vertex, must be in the range [0, getNumVertices())
+    // @return - The number of arcs leaving the vertex
+    unsigned int getDegree(unsigned int) const;
+
+    // @func   - getTargets
+    // @args   - #1 Dense integer id of a vertex, must be in the range [0, getNumVertices())
+    // @return - Pointer to the getDegree(id) target ids of the vertex, sorted by id. Points into the mapped file.
+    const uint32_t * getTargets(unsigned int) const;
+
+    // @func   - getWeights
+    // @args   - #1 Dense integer id of a vertex, must be in the range [0, getNumVertices())
+    // @return - Pointer to the getDegree(id) weights of the vertex, parallel to getTargets. Points into the mapped file.
+    const double * getWeights(unsigned int) const;
+
+    // @func   - load
+    // @args   - #1 The graph to copy the snapshot into, it is emptied first
+    // @info   - Rebuilds a mutable graph from the snapshot. The csrGraph version copies the arrays over wholesale, the
+    //           dGraph and uGraph versions insert vertex by vertex but never have to parse any text.
+    void load(dGraph<VertexType> &) const;
+    void load(uGraph<VertexType> &) const;
+    void load(csrGraph<VertexType> &) const;
+
+
+private:
+
+    // @member - base
+    // @info   - The start of the mapped file, the header lives here
+    const char * base;
+
+    // @member - size
+    // @info   - The length of the mapping in bytes
+    size_t size;
+
+    // @member - header, offsets, targets, weights
+    // @info   - Pointers to each of the sections inside of the mapping
+    const SnapshotHeader * header;
+    const uint64_t * offsets;
+    const uint32_t * targets;
+    const double * weights;
+
+    // @member - vertex_table, sorted_index
+    // @info   - Integral vertex types only, the vertex table and the sorted index inside of the mapping
+    const VertexType * vertex_table;
+    const uint32_t * sorted_index;
+
+    // @member - decoded, lookup_map
+    // @info   - Non-integral vertex types only, the vertex table decoded when the file was opened
+    std::vector<VertexType> decoded;
+    std::unordered_map<VertexType, unsigned int> lookup_map;
+
+    // @func - openVertices
+    // @info - Sets up the vertex table, in place for integral types and decoded for everything else
+    void openVertices(std::true_type);
+    void openVertices(std::false_type);
+
+    // @func - findVertex
+    // @info - The implementation of getVertexId for integral and non-integral types
+    int findVertex(const VertexType &, std::true_type) const;
+    int findVertex(const VertexType &, std::false_type) const;
+
+    // @func - findArc
+    // @args - #1 id of the source vertex, #2 id of the target vertex
+    // @info - Binary searches the sorted arcs of the source vertex, returns the arc index or -1
+    long long findArc(unsigned int, unsigned int) const;
+
+    // @func - writeVertices
+    // @info - Writes the vertex section (and for integral types the sorted index) of a new snapshot
+    static bool writeVertices(FILE *, const csrGraph<VertexType> &, SnapshotHeader &, std::true_type);
+    static bool writeVertices(FILE *, const csrGraph<VertexType> &, SnapshotHeader &, std::false_type);
+
+    // @func   - sectionFits
+    // @args   - #1 The offset of the section, #2 the number of elements in it, #3 the size of each element
+    // @return - True if the section starts on an 8 byte boundary, as writeSection leaves it, and lies entirely inside of the
+    //           mapped file
+    bool sectionFits(uint64_t, uint64_t, uint64_t) const;
+
+    // @func - writeSection
+    // @info - Pads the file out to an 8 byte boundary and writes the given bytes, returns the offset they were written at
+    static uint64_t writeSection(FILE *, const void *, size_t, bool &);
+
+    // @func - error
+    // @info - Unmaps the file and throws a logic_error describing what was wrong with it
+    void error(const std::string &, const std::string &);
+
+    // @typedef - is_integral
+    // @info    - Used to pick between the in place and the decoded vertex tables
+    typedef typename std::is_integral<VertexType>::type is_integral;
+};
+
+#include "GraphSnapshot.cpp"
+#endif
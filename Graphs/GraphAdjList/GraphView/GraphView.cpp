@@ -0,0 +1,210 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - GraphView.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the NeighborView and VertexView classes declared in GraphView.h.
+**/
+
+#include "GraphView.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////           NEIGHBOR VIEW          //////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template <class VertexType>
+NeighborView<VertexType>::iterator::iterator() : current() {}
+
+template <class VertexType>
+NeighborView<VertexType>::iterator::iterator(EdgeIterator it) : current(it) {}
+
+template <class VertexType>
+typename NeighborView<VertexType>::iterator::reference NeighborView<VertexType>::iterator::operator*() const {
+    return **current;
+}
+
+template <class VertexType>
+typename NeighborView<VertexType>::iterator::pointer NeighborView<VertexType>::iterator::operator->() const {
+    return *current;
+}
+
+template <class VertexType>
+typename NeighborView<VertexType>::iterator & NeighborView<VertexType>::iterator::operator++() {
+    ++current;
+    return *this;
+}
+
+template <class VertexType>
+typename NeighborView<VertexType>::iterator NeighborView<VertexType>::iterator::operator++(int) {
+    iterator old = *this;
+    ++current;
+    return old;
+}
+
+template <class VertexType>
+bool NeighborView<VertexType>::iterator::operator==(const iterator & other) const {
+    return current == other.current;
+}
+
+template <class VertexType>
+bool NeighborView<VertexType>::iterator::operator!=(const iterator & other) const {
+    return current != other.current;
+}
+
+// @func   - target
+// @return - The data of the vertex the current edge points to
+template <class VertexType>
+const VertexType & NeighborView<VertexType>::iterator::target() const {
+    return (*current)->getTarget()->getData();
+}
+
+// @func   - targetId
+// @return - The id of the vertex the current edge points to
+template <class VertexType>
+unsigned int NeighborView<VertexType>::iterator::targetId() const {
+    return (*current)->getTarget()->getIndex();
+}
+
+// @func   - weight
+// @return - The weight of the current edge
+template <class VertexType>
+double NeighborView<VertexType>::iterator::weight() const {
+    return (*current)->getWeight();
+}
+
+// @func - Constructor#1
+// @args - None
+// @info - An empty view
+template <class VertexType>
+NeighborView<VertexType>::NeighborView() : edges(nullptr) {}
+
+// @func - Constructor#2
+// @args - #1 The adjacency list whose edges the view walks
+template <class VertexType>
+NeighborView<VertexType>::NeighborView(AdjList<VertexType> * adj) : edges(adj->getEdgeList()) {}
+
+template <class VertexType>
+typename NeighborView<VertexType>::iterator NeighborView<VertexType>::begin() const {
+    return edges ? iterator(edges->begin()) : iterator();
+}
+
+template <class VertexType>
+typename NeighborView<VertexType>::iterator NeighborView<VertexType>::end() const {
+    return edges ? iterator(edges->end()) : iterator();
+}
+
+// @func   - size
+// @return - The number of edges in the view
+template <class VertexType>
+unsigned int NeighborView<VertexType>::size() const {
+    return edges ? edges->size() : 0;
+}
+
+// @func   - empty
+// @return - True if the vertex has no edges
+template <class VertexType>
+bool NeighborView<VertexType>::empty() const {
+    return !edges || edges->empty();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////            VERTEX VIEW           //////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template <class VertexType>
+VertexView<VertexType>::iterator::iterator() : current() {}
+
+template <class VertexType>
+VertexView<VertexType>::iterator::iterator(ListIterator it) : current(it) {}
+
+template <class VertexType>
+typename VertexView<VertexType>::iterator::reference VertexView<VertexType>::iterator::operator*() const {
+    return (*current)->getVertex()->getData();
+}
+
+template <class VertexType>
+typename VertexView<VertexType>::iterator::pointer VertexView<VertexType>::iterator::operator->() const {
+    return &(*current)->getVertex()->getData();
+}
+
+template <class VertexType>
+typename VertexView<VertexType>::iterator & VertexView<VertexType>::iterator::operator++() {
+    ++current;
+    return *this;
+}
+
+template <class VertexType>
+typename VertexView<VertexType>::iterator VertexView<VertexType>::iterator::operator++(int) {
+    iterator old = *this;
+    ++current;
+    return old;
+}
+
+template <class VertexType>
+bool VertexView<VertexType>::iterator::operator==(const iterator & other) const {
+    return current == other.current;
+}
+
+template <class VertexType>
+bool VertexView<VertexType>::iterator::operator!=(const iterator & other) const {
+    return current != other.current;
+}
+
+// @func   - id
+// @return - The id of the current vertex
+template <class VertexType>
+unsigned int VertexView<VertexType>::iterator::id() const {
+    return (*current)->getVertex()->getIndex();
+}
+
+// @func   - neighbors
+// @return - A view over the edges of the current vertex
+template <class VertexType>
+NeighborView<VertexType> VertexView<VertexType>::iterator::neighbors() const {
+    return NeighborView<VertexType>(*current);
+}
+
+// @func - Constructor
+// @args - #1 The adjacency lists of the graph
+template <class VertexType>
+VertexView<VertexType>::VertexView(const std::vector<AdjList<VertexType> *> & adj_lists) : list(&adj_lists) {}
+
+template <class VertexType>
+typename VertexView<VertexType>::iterator VertexView<VertexType>::begin() const {
+    return iterator(list->begin());
+}
+
+template <class VertexType>
+typename VertexView<VertexType>::iterator VertexView<VertexType>::end() const {
+    return iterator(list->end());
+}
+
+// @func   - size
+// @return - The number of vertices in the graph
+template <class VertexType>
+unsigned int VertexView<VertexType>::size() const {
+    return list->size();
+}
+
+// @func   - empty
+// @return - True if the graph has no vertices
+template <class VertexType>
+bool VertexView<VertexType>::empty() const {
+    return list->empty();
+}
+
+// @func   - operator[]
+// @args   - #1 A vertex id, which has to be less than size()
+// @return - The data of the vertex with that id
+template <class VertexType>
+const VertexType & VertexView<VertexType>::operator[](unsigned int id) const {
+    return (*list)[id]->getVertex()->getData();
+}
+
+// @func   - neighbors
+// @args   - #1 A vertex id, which has to be less than size()
+// @return - A view over the edges of the vertex with that id
+template <class VertexType>
+NeighborView<VertexType> VertexView<VertexType>::neighbors(unsigned int id) const {
+    return NeighborView<VertexType>((*list)[id]);
+}
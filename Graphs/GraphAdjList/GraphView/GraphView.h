@@ -0,0 +1,189 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - GraphView.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This file declares the NeighborView and VertexView classes, which let a caller walk the edges leaving a
+*               vertex and the vertices of a dGraph or uGraph without copying anything out of the graph. getIncidentEdges,
+*               getAllVertices and getAllEdges build and return a vector of copies, a view is just a pair of iterators into
+*               the graph's own storage, so creating one is O(1) and walking it touches nothing but the graph itself.
+*
+*   @Details  - A view is only good for as long as the graph isn't changed, inserting or deleting a vertex or an edge can
+*               leave a view (and any iterator taken from it) pointing at storage that has moved or been freed. Changing the
+*               weight of an edge is fine.
+*
+*               Dereferencing a NeighborView iterator gives the edge itself, the iterator also has target(), targetId() and
+*               weight() for the common cases. Dereferencing a VertexView iterator gives the vertex data, its id() and
+*               neighbors() give the vertex id and a NeighborView over the vertex's edges.
+**/
+
+#ifndef GRAPH_VIEW_H
+#define GRAPH_VIEW_H
+
+#include <vector>
+#include <iterator>
+#include <cstddef>
+#include "../AdjacencyList/AdjList.h"
+
+// @class - NeighborView
+// @info  - The edges leaving one vertex (all of its edges, for an undirected graph), in the order the graph stores them.
+template <class VertexType>
+class NeighborView
+{
+public:
+
+    typedef typename AdjList<VertexType>::EdgeContainer::const_iterator EdgeIterator;
+
+    // @class - iterator
+    // @info  - A forward iterator over the edges of the view.
+    class iterator
+    {
+    public:
+
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Edge<VertexType> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const Edge<VertexType> * pointer;
+        typedef const Edge<VertexType> & reference;
+
+        iterator();
+        iterator(EdgeIterator);
+
+        reference operator*() const;
+        pointer operator->() const;
+
+        iterator & operator++();
+        iterator operator++(int);
+
+        bool operator==(const iterator &) const;
+        bool operator!=(const iterator &) const;
+
+        // @func   - target
+        // @return - The data of the vertex the current edge points to
+        const VertexType & target() const;
+
+        // @func   - targetId
+        // @return - The id of the vertex the current edge points to
+        unsigned int targetId() const;
+
+        // @func   - weight
+        // @return - The weight of the current edge
+        double weight() const;
+
+    private:
+
+        EdgeIterator current;
+    };
+
+    typedef iterator const_iterator;
+
+    // @func - Constructor#1
+    // @args - None
+    // @info - An empty view
+    NeighborView();
+
+    // @func - Constructor#2
+    // @args - #1 The adjacency list whose edges the view walks
+    NeighborView(AdjList<VertexType> *);
+
+    iterator begin() const;
+    iterator end() const;
+
+    // @func   - size
+    // @return - The number of edges in the view
+    unsigned int size() const;
+
+    // @func   - empty
+    // @return - True if the vertex has no edges
+    bool empty() const;
+
+private:
+
+    // @member - edges
+    // @info   - The edge container of the adjacency list, or null for an empty view.
+    const typename AdjList<VertexType>::EdgeContainer * edges;
+};
+
+// @class - VertexView
+// @info  - Every vertex of a graph, in id order.
+template <class VertexType>
+class VertexView
+{
+public:
+
+    typedef typename std::vector<AdjList<VertexType> *>::const_iterator ListIterator;
+
+    // @class - iterator
+    // @info  - A forward iterator over the vertices of the view.
+    class iterator
+    {
+    public:
+
+        typedef std::forward_iterator_tag iterator_category;
+        typedef VertexType value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const VertexType * pointer;
+        typedef const VertexType & reference;
+
+        iterator();
+        iterator(ListIterator);
+
+        reference operator*() const;
+        pointer operator->() const;
+
+        iterator & operator++();
+        iterator operator++(int);
+
+        bool operator==(const iterator &) const;
+        bool operator!=(const iterator &) const;
+
+        // @func   - id
+        // @return - The id of the current vertex
+        unsigned int id() const;
+
+        // @func   - neighbors
+        // @return - A view over the edges of the current vertex
+        NeighborView<VertexType> neighbors() const;
+
+    private:
+
+        ListIterator current;
+    };
+
+    typedef iterator const_iterator;
+
+    // @func - Constructor
+    // @args - #1 The adjacency lists of the graph
+    VertexView(const std::vector<AdjList<VertexType> *> &);
+
+    iterator begin() const;
+    iterator end() const;
+
+    // @func   - size
+    // @return - The number of vertices in the graph
+    unsigned int size() const;
+
+    // @func   - empty
+    // @return - True if the graph has no vertices
+    bool empty() const;
+
+    // @func   - operator[]
+    // @args   - #1 A vertex id, which has to be less than size()
+    // @return - The data of the vertex with that id
+    const VertexType & operator[](unsigned int) const;
+
+    // @func   - neighbors
+    // @args   - #1 A vertex id, which has to be less than size()
+    // @return - A view over the edges of the vertex with that id
+    NeighborView<VertexType> neighbors(unsigned int) const;
+
+private:
+
+    // @member - list
+    // @info   - The adjacency lists of the graph, indexed by vertex id.
+    const std::vector<AdjList<VertexType> *> * list;
+};
+
+#include "GraphView.cpp"
+
+#endif
@@ -0,0 +1,293 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - MinimumCut.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the shared minimum cut algorithms. They aren't templates, so everything in
+*               here is marked inline to keep the header-only layout the rest of the project uses.
+**/
+
+#include "MinimumCut.h"
+
+// @func   - stoerWagnerCut
+// @args   - #1 The number of vertices, #2 the edges of the graph, #3 output, the side of the cut each vertex is on
+// @return - The weight of the minimum cut
+inline double stoerWagnerCut(unsigned int num_vertices, const std::vector<WeightedArc> & arcs, std::vector<bool> & side) {
+
+    side.assign(num_vertices, false);
+
+    if(num_vertices < 2)
+        return 0;
+
+    // adjacent[v] holds every arc of the original vertices that super vertex v stands for, and owner maps an original
+    // vertex to the super vertex it has been merged into. Merging only ever moves arcs from one list to another, so
+    // contracting never has to look anything up and the lists never hold more than 2E arcs between them.
+    std::vector<std::vector<std::pair<unsigned int, double> > > adjacent(num_vertices);
+
+    for(auto & arc : arcs) {
+
+        if(arc.weight < 0)
+            throw std::logic_error("Minimum Cut Requires Non-Negative Edge Weights\n");
+
+        if(arc.source == arc.target)
+            continue;
+
+        adjacent[arc.source].push_back(std::make_pair(arc.target, arc.weight));
+        adjacent[arc.target].push_back(std::make_pair(arc.source, arc.weight));
+    }
+
+    // the super vertices that haven't been merged away yet, and the original vertices each one stands for
+    std::vector<unsigned int> active(num_vertices), owner(num_vertices);
+    std::vector<std::vector<unsigned int> > members(num_vertices);
+
+    for(unsigned int i = 0; i < num_vertices; i++) {
+        active[i] = owner[i] = i;
+        members[i].push_back(i);
+    }
+
+    std::vector<double> connection(num_vertices, 0);
+    std::vector<unsigned int> best_side;
+    double best = std::numeric_limits<double>::infinity();
+
+    // the heap pops the smallest key, so it is keyed on the negated connection to pop the most tightly connected vertex first
+    IndexedHeap<double> heap(num_vertices);
+
+    while(active.size() > 1 && best > 0) {
+
+        for(auto v : active) {
+            connection[v] = 0;
+            heap.push(v, 0);
+        }
+
+        unsigned int previous = active[0], last = active[0];
+
+        while(!heap.empty()) {
+
+            previous = last;
+            last = heap.pop();
+
+            for(auto & arc : adjacent[last]) {
+                unsigned int neighbor = owner[arc.first];
+                if(heap.contains(neighbor)) {
+                    connection[neighbor] += arc.second;
+                    heap.decreaseKey(neighbor, -connection[neighbor]);
+                }
+            }
+        }
+
+        // the cut of the phase separates last from everything else, the first phase always counts so there is a side to
+        // hand back even when every cut is infinite
+        if(best_side.empty() || connection[last] < best) {
+            best = connection[last];
+            best_side = members[last];
+        }
+
+        // merge last into previous, the arcs between the two become self loops and are dropped
+        for(auto v : members[last])
+            owner[v] = previous;
+
+        auto & merged = adjacent[previous];
+        merged.insert(merged.end(), adjacent[last].begin(), adjacent[last].end());
+        merged.erase(std::remove_if(merged.begin(), merged.end(),
+            [&](const std::pair<unsigned int, double> & arc) { return owner[arc.first] == previous; }), merged.end());
+        std::vector<std::pair<unsigned int, double> >().swap(adjacent[last]);
+
+        members[previous].insert(members[previous].end(), members[last].begin(), members[last].end());
+        members[last].clear();
+
+        for(unsigned int i = 0; i < active.size(); i++) {
+            if(active[i] == last) {
+                active[i] = active.back();
+                active.pop_back();
+                break;
+            }
+        }
+    }
+
+    for(auto v : best_side)
+        side[v] = true;
+
+    return best;
+}
+
+// @func   - kargerSteinCut
+// @args   - #1 The number of vertices, #2 the edges of the graph, #3 output, the side of the cut each vertex is on, #4 the
+//           number of trials, #5 the number of worker threads, #6 the seed
+// @return - The weight of the lightest cut that was found
+inline double kargerSteinCut(unsigned int num_vertices, const std::vector<WeightedArc> & arcs, std::vector<bool> & side,
+                             unsigned int trials, unsigned int threads, unsigned long long seed) {
+
+    side.assign(num_vertices, false);
+
+    if(num_vertices < 2)
+        return 0;
+
+    // edges of weight zero can never be contracted, so they are dropped along with the self loops
+    std::vector<WeightedArc> live;
+    live.reserve(arcs.size());
+    UnionFind components(num_vertices);
+
+    for(auto & arc : arcs) {
+
+        if(arc.weight < 0)
+            throw std::logic_error("Minimum Cut Requires Non-Negative Edge Weights\n");
+
+        if(arc.weight > 0 && arc.source != arc.target) {
+            live.push_back(arc);
+            components.unite(arc.source, arc.target);
+        }
+    }
+
+    // a graph that isn't connected has a free cut around the component of vertex 0, and contraction would stall on it
+    if(components.getNumSets() > 1) {
+        for(unsigned int i = 0; i < num_vertices; i++)
+            side[i] = !components.connected(i, 0);
+        return 0;
+    }
+
+    if(!trials) {
+        double n = num_vertices;
+        trials = std::max(1u, (unsigned int) std::ceil(std::log2(n) * std::log(n)));
+    }
+
+    if(!threads)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, trials);
+
+    if(!seed)
+        seed = std::random_device()();
+
+    // every thread runs its share of the trials with its own generator and keeps its own best cut
+    std::vector<double> best(threads, std::numeric_limits<double>::infinity());
+    std::vector<std::vector<bool> > best_side(threads);
+
+    auto worker = [&](unsigned int id) {
+
+        std::mt19937_64 gen(seed + id);
+        std::vector<bool> trial_side;
+
+        for(unsigned int trial = id; trial < trials; trial += threads) {
+            double weight = kargerSteinTrial(num_vertices, live, gen, trial_side);
+            if(best_side[id].empty() || weight < best[id]) {
+                best[id] = weight;
+                best_side[id] = trial_side;
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for(unsigned int id = 1; id < threads; id++)
+        workers.push_back(std::thread(worker, id));
+
+    worker(0);
+
+    for(auto & thread : workers)
+        thread.join();
+
+    unsigned int winner = std::min_element(best.begin(), best.end()) - best.begin();
+    side = best_side[winner];
+
+    return best[winner];
+}
+
+// @func   - kargerSteinTrial
+// @args   - #1 The number of vertices, #2 the edges of the graph, #3 the random generator, #4 output, the side of the cut each
+//           vertex is on
+// @return - The weight of the lightest cut this trial found
+inline double kargerSteinTrial(unsigned int num_vertices, const std::vector<WeightedArc> & arcs, std::mt19937_64 & gen,
+                               std::vector<bool> & side) {
+
+    // the textbook recursion bottoms out at 6 vertices, but on graphs this small Stoer-Wagner is exact and much cheaper
+    // than the thousands of recursive calls it takes to get all the way down there
+    const unsigned int base_size = 32;
+
+    if(num_vertices <= base_size)
+        return stoerWagnerCut(num_vertices, arcs, side);
+
+    unsigned int target = (unsigned int) std::ceil(1 + num_vertices / std::sqrt(2.0));
+    double best = std::numeric_limits<double>::infinity();
+
+    std::vector<unsigned int> labels;
+    std::vector<WeightedArc> contracted;
+    std::vector<bool> contracted_side;
+
+    for(int branch = 0; branch < 2; branch++) {
+
+        contractArcs(num_vertices, arcs, target, gen, labels, contracted);
+        double weight = kargerSteinTrial(target, contracted, gen, contracted_side);
+
+        if(branch == 0 || weight < best) {
+            best = weight;
+            side.resize(num_vertices);
+            for(unsigned int i = 0; i < num_vertices; i++)
+                side[i] = contracted_side[labels[i]];
+        }
+    }
+
+    return best;
+}
+
+// @func - contractArcs
+// @args - #1 The number of vertices, #2 the edges of the graph, #3 how many vertices to leave, #4 the random generator,
+//         #5 output, the new label of every vertex, #6 output, the edges of the contracted graph
+inline void contractArcs(unsigned int num_vertices, const std::vector<WeightedArc> & arcs, unsigned int target,
+                         std::mt19937_64 & gen, std::vector<unsigned int> & labels, std::vector<WeightedArc> & contracted) {
+
+    // the edge with the smallest Exp(weight) key is a weighted random pick, and so is the smallest of the ones that are left
+    std::exponential_distribution<double> exponential(1.0);
+    std::vector<std::pair<double, unsigned int> > order(arcs.size());
+
+    for(unsigned int i = 0; i < arcs.size(); i++)
+        order[i] = std::make_pair(exponential(gen) / arcs[i].weight, i);
+
+    // only the first few hundred edges in key order are usually needed, so they are pulled out and sorted a block at a time
+    UnionFind sets(num_vertices);
+    unsigned int begin = 0;
+
+    while(begin < order.size() && sets.getNumSets() > target) {
+
+        unsigned int end = std::min((unsigned int) order.size(), begin + 2*num_vertices);
+        std::nth_element(order.begin() + begin, order.begin() + end - 1, order.end());
+        std::sort(order.begin() + begin, order.begin() + end);
+
+        for(unsigned int i = begin; i < end && sets.getNumSets() > target; i++)
+            sets.unite(arcs[order[i].second].source, arcs[order[i].second].target);
+
+        begin = end;
+    }
+
+    // number the surviving sets 0 to target-1
+    const unsigned int unlabeled = std::numeric_limits<unsigned int>::max();
+    std::vector<unsigned int> root_label(num_vertices, unlabeled);
+    unsigned int next = 0;
+
+    labels.resize(num_vertices);
+    for(unsigned int i = 0; i < num_vertices; i++) {
+        unsigned int root = sets.find(i);
+        if(root_label[root] == unlabeled)
+            root_label[root] = next++;
+        labels[i] = root_label[root];
+    }
+
+    // keep the edges between different sets, pointing from the lower label to the higher one so parallel edges sort together
+    contracted.clear();
+    for(auto & arc : arcs) {
+        unsigned int one = labels[arc.source], two = labels[arc.target];
+        if(one != two)
+            contracted.push_back(WeightedArc{std::min(one, two), std::max(one, two), arc.weight});
+    }
+
+    std::sort(contracted.begin(), contracted.end(), [](const WeightedArc & a, const WeightedArc & b) {
+        return a.source < b.source || (a.source == b.source && a.target < b.target);
+    });
+
+    unsigned int kept = 0;
+    for(unsigned int i = 0; i < contracted.size(); i++) {
+        if(kept && contracted[kept-1].source == contracted[i].source && contracted[kept-1].target == contracted[i].target)
+            contracted[kept-1].weight += contracted[i].weight;
+        else
+            contracted[kept++] = contracted[i];
+    }
+
+    contracted.resize(kept);
+}
@@ -0,0 +1,89 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - MinimumCut.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This file declares the options that select how the graph classes find a global minimum cut, along with the
+*               Stoer-Wagner and Karger-Stein algorithms that they share.
+*
+*   @Details  - Like the spanning forest algorithms, the cut algorithms only care about which dense vertex ids are joined by
+*               how much weight, so each graph hands them an array of WeightedArcs and maps the ids back to its vertices
+*               afterwards. The direction of an arc is ignored, a cut is measured over the undirected graph.
+**/
+
+#ifndef MINIMUM_CUT_H
+#define MINIMUM_CUT_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <cmath>
+#include <random>
+#include <thread>
+
+#include "../SpanningTree/SpanningTree.h"
+#include "../PriorityQueue/IndexedHeap.h"
+#include "../UnionFind/UnionFind.h"
+
+// @enum - MinimumCutAlgorithm
+// @info - StoerWagner - Deterministic and exact, O(V*E + V^2 log V). The default.
+//         KargerStein - Randomized recursive contraction, O(E log E + V^2 log V) per trial, and the trials are independent so
+//                       they run in parallel. Finds the minimum cut with high probability.
+enum class MinimumCutAlgorithm { StoerWagner, KargerStein };
+
+// @struct - MinimumCutOptions
+// @info   - The second argument to minimumCut, trials, threads and seed are only used by Karger-Stein. trials is the number
+//           of independent runs, 0 picks log2(V)*ln(V) which makes the chance of missing the minimum cut about 1/V. threads
+//           is the number of worker threads the trials are split between, 0 means one per hardware thread. seed makes the
+//           result repeatable, 0 seeds every thread from a std::random_device.
+struct MinimumCutOptions
+{
+    MinimumCutOptions(MinimumCutAlgorithm alg = MinimumCutAlgorithm::StoerWagner, unsigned int num_trials = 0,
+                      unsigned int num_threads = 0, unsigned long long rng_seed = 0) :
+        algorithm(alg), trials(num_trials), threads(num_threads), seed(rng_seed) {}
+
+    MinimumCutAlgorithm algorithm;
+    unsigned int trials;
+    unsigned int threads;
+    unsigned long long seed;
+};
+
+// @func   - stoerWagnerCut
+// @args   - #1 The number of vertices, #2 the edges of the graph, #3 output, side[i] is true for the vertices on one side of
+//           the cut and false for the rest
+// @return - The total weight of the edges that cross the cut, 0 if the graph isn't connected
+// @info   - Deterministic, O(V*E + V^2 log V). Every phase orders the vertices by maximum adjacency with an IndexedHeap, the last
+//           vertex of the order is cut off from everything else as cheaply as anything can cut it from the one before it, so
+//           that is a candidate cut and the two are then merged. Parallel arcs are summed, self loops are ignored. Throws a
+//           logic_error if any weight is negative. Graphs with fewer than two vertices have no cut and return 0 with
+//           every side false.
+double stoerWagnerCut(unsigned int, const std::vector<WeightedArc> &, std::vector<bool> &);
+
+// @func   - kargerSteinCut
+// @args   - #1 The number of vertices, #2 the edges of the graph, #3 output, the side of the cut each vertex is on, #4 the
+//           number of trials, #5 the number of worker threads, #6 the seed (see MinimumCutOptions for what 0 means in each)
+// @return - The weight of the lightest cut any trial found
+// @info   - Each trial contracts the graph down to V/sqrt(2) vertices twice independently and recurses on both, keeping the
+//           better cut. A contraction gives every edge a random exponential key scaled by its weight and unites the ends of
+//           the edges in key order on a UnionFind until enough vertices are left, which picks each edge with probability
+//           proportional to its weight. The surviving edges are relabeled into a flat array with the parallel edges summed.
+//           Graphs of 32 vertices or less are finished off with stoerWagnerCut. Throws on negative weights like stoerWagnerCut.
+double kargerSteinCut(unsigned int, const std::vector<WeightedArc> &, std::vector<bool> &, unsigned int = 0,
+                      unsigned int = 0, unsigned long long = 0);
+
+// @func - contractArcs
+// @args - #1 The number of vertices, #2 the edges of the graph, #3 how many vertices to contract down to, #4 the random
+//         generator to draw the contraction from, #5 output, the vertex each old vertex was contracted into, #6 output, the
+//         edges of the contracted graph
+// @info - One random contraction step of kargerSteinCut. The graph has to be connected.
+void contractArcs(unsigned int, const std::vector<WeightedArc> &, unsigned int, std::mt19937_64 &, std::vector<unsigned int> &,
+                  std::vector<WeightedArc> &);
+
+// @func - kargerSteinTrial
+// @info - One recursive trial of kargerSteinCut, the graph has to be connected
+double kargerSteinTrial(unsigned int, const std::vector<WeightedArc> &, std::mt19937_64 &, std::vector<bool> &);
+
+#include "MinimumCut.cpp"
+#endif
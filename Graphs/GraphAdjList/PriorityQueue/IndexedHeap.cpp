@@ -0,0 +1,226 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - IndexedHeap.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the IndexedHeap class, see IndexedHeap.h for the details of the layout.
+**/
+
+#include "IndexedHeap.h"
+
+// @func - Constructor
+// @args - #1 The number of keys the heap can hold, the keys must be in the range [0, capacity)
+template <class PriorityType, unsigned int Arity>
+IndexedHeap<PriorityType, Arity>::IndexedHeap(unsigned int cap) : position(cap, -1), priority(cap) {
+    static_assert(Arity >= 2, "IndexedHeap needs an arity of at least 2");
+}
+
+// @func   - resize
+// @args   - #1 The new capacity of the heap
+// @info   - Empties the heap and makes room for keys in the range [0, capacity)
+template <class PriorityType, unsigned int Arity>
+void IndexedHeap<PriorityType, Arity>::resize(unsigned int cap) {
+    heap.clear();
+    position.assign(cap, -1);
+    priority.resize(cap);
+}
+
+// @func   - push
+// @args   - #1 The key to insert, #2 the priority associated with that key
+// @return - Bool indicating success, false if the key is already in the heap
+template <class PriorityType, unsigned int Arity>
+bool IndexedHeap<PriorityType, Arity>::push(unsigned int key, const PriorityType & prio) {
+
+    if(key >= position.size())
+        throw std::logic_error("Key Out of Range of Heap\n");
+
+    if(position[key] != -1)
+        return false;
+
+    priority[key] = prio;
+    position[key] = heap.size();
+    heap.push_back(key);
+    siftUp(heap.size()-1);
+
+    return true;
+}
+
+// @func   - decreaseKey
+// @args   - #1 The key to update, #2 the new priority associated with that key
+// @return - Bool indicating success, false if the key is not in the heap or the new priority is not lower than the old one
+template <class PriorityType, unsigned int Arity>
+bool IndexedHeap<PriorityType, Arity>::decreaseKey(unsigned int key, const PriorityType & prio) {
+
+    if(!contains(key) || !(prio < priority[key]))
+        return false;
+
+    priority[key] = prio;
+    siftUp(position[key]);
+
+    return true;
+}
+
+// @func   - pushOrDecrease
+// @args   - #1 The key to insert or update, #2 the priority associated with that key
+// @return - Bool indicating if the heap was changed, false if the key was already in the heap with a lower priority
+template <class PriorityType, unsigned int Arity>
+bool IndexedHeap<PriorityType, Arity>::pushOrDecrease(unsigned int key, const PriorityType & prio) {
+
+    if(contains(key))
+        return decreaseKey(key, prio);
+
+    return push(key, prio);
+}
+
+// @func   - pop
+// @args   - none
+// @return - The key with the lowest priority, which is removed from the heap.
+template <class PriorityType, unsigned int Arity>
+unsigned int IndexedHeap<PriorityType, Arity>::pop() {
+
+    if(heap.empty())
+        throw std::logic_error("Pop Called on Empty Heap\n");
+
+    unsigned int ret = heap[0];
+    position[ret] = -1;
+
+    // move the last element to the root and let it sink back down to where it belongs
+    unsigned int last = heap.back();
+    heap.pop_back();
+
+    if(!heap.empty()) {
+        heap[0] = last;
+        position[last] = 0;
+        siftDown(0);
+    }
+
+    return ret;
+}
+
+// @func   - top
+// @args   - none
+// @return - The key with the lowest priority.
+template <class PriorityType, unsigned int Arity>
+unsigned int IndexedHeap<PriorityType, Arity>::top() const {
+
+    if(heap.empty())
+        throw std::logic_error("Top Called on Empty Heap\n");
+
+    return heap[0];
+}
+
+// @func   - topPriority
+// @args   - none
+// @return - The priority of the key at the top of the heap.
+template <class PriorityType, unsigned int Arity>
+PriorityType IndexedHeap<PriorityType, Arity>::topPriority() const {
+    return priority[top()];
+}
+
+// @func   - contains
+// @args   - #1 The key to search for
+// @return - True if the key is currently in the heap
+template <class PriorityType, unsigned int Arity>
+bool IndexedHeap<PriorityType, Arity>::contains(unsigned int key) const {
+    return key < position.size() && position[key] != -1;
+}
+
+// @func   - getPriority
+// @args   - #1 A key that is currently in the heap
+// @return - The priority associated with that key.
+template <class PriorityType, unsigned int Arity>
+PriorityType IndexedHeap<PriorityType, Arity>::getPriority(unsigned int key) const {
+
+    if(!contains(key))
+        throw std::logic_error("Key Not in Heap\n");
+
+    return priority[key];
+}
+
+// @func   - clear
+// @args   - none
+// @info   - Only the keys that are actually in the heap need their positions reset.
+template <class PriorityType, unsigned int Arity>
+void IndexedHeap<PriorityType, Arity>::clear() {
+    for(auto key : heap)
+        position[key] = -1;
+
+    heap.clear();
+}
+
+// @func   - empty
+// @return - True if there are no keys in the heap
+template <class PriorityType, unsigned int Arity>
+bool IndexedHeap<PriorityType, Arity>::empty() const {
+    return heap.empty();
+}
+
+// @func   - size
+// @return - The number of keys in the heap
+template <class PriorityType, unsigned int Arity>
+unsigned int IndexedHeap<PriorityType, Arity>::size() const {
+    return heap.size();
+}
+
+// @func   - capacity
+// @return - One more than the largest key the heap can hold
+template <class PriorityType, unsigned int Arity>
+unsigned int IndexedHeap<PriorityType, Arity>::capacity() const {
+    return position.size();
+}
+
+// @func - siftUp
+// @args - #1 Position in the heap array of the element to move towards the root
+// @info - Rather than swapping at every level we hold on to the moving key and shift the parents down into the hole.
+template <class PriorityType, unsigned int Arity>
+void IndexedHeap<PriorityType, Arity>::siftUp(unsigned int pos) {
+
+    unsigned int key = heap[pos];
+
+    while(pos > 0) {
+        unsigned int parent = (pos-1)/Arity;
+
+        if(!(priority[key] < priority[heap[parent]]))
+            break;
+
+        heap[pos] = heap[parent];
+        position[heap[pos]] = pos;
+        pos = parent;
+    }
+
+    heap[pos] = key;
+    position[key] = pos;
+}
+
+// @func - siftDown
+// @args - #1 Position in the heap array of the element to move towards the leaves
+template <class PriorityType, unsigned int Arity>
+void IndexedHeap<PriorityType, Arity>::siftDown(unsigned int pos) {
+
+    unsigned int key = heap[pos];
+    unsigned int count = heap.size();
+
+    while(true) {
+        unsigned int first = pos*Arity+1;
+
+        if(first >= count)
+            break;
+
+        // find the smallest of the (up to) Arity children
+        unsigned int last = first+Arity < count ? first+Arity : count;
+        unsigned int best = first;
+        for(unsigned int child = first+1; child < last; child++)
+            if(priority[heap[child]] < priority[heap[best]])
+                best = child;
+
+        if(!(priority[heap[best]] < priority[key]))
+            break;
+
+        heap[pos] = heap[best];
+        position[heap[pos]] = pos;
+        pos = best;
+    }
+
+    heap[pos] = key;
+    position[key] = pos;
+}
@@ -0,0 +1,119 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - IndexedHeap.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the declaration of the IndexedHeap class, an indexed d-ary min heap that the graph classes use as the
+*               priority queue for their path-finding and spanning tree algorithms. The elements of the heap are integer keys
+*               in the range [0, capacity), usually the id of a vertex, and each key has a priority associated with it.
+*
+*   @Details  - The heap is stored as a flat array of keys, where the children of the element at position i are stored at
+*               positions [i*Arity+1, i*Arity+Arity]. Alongside the heap we keep a position array that maps each key back to
+*               where it currently lives in the heap (or -1 if it is not in the heap), which is what lets us support
+*               decreaseKey in O(log n) time instead of having to insert a second copy of the key. Using an arity of 4
+*               instead of 2 makes the tree shallower, which makes decreaseKey (the operation Dijkstra's performs the
+*               most) cheaper and keeps the children of a node on the same cache line when we sift down.
+**/
+
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+#include <stdexcept>
+#include <vector>
+
+template <class PriorityType = double, unsigned int Arity = 4>
+class IndexedHeap
+{
+public:
+
+    // @func - Constructor
+    // @args - #1 The number of keys the heap can hold, the keys must be in the range [0, capacity)
+    IndexedHeap(unsigned int = 0);
+
+    // @func   - resize
+    // @args   - #1 The new capacity of the heap
+    // @info   - Empties the heap and makes room for keys in the range [0, capacity)
+    void resize(unsigned int);
+
+    // @func   - push
+    // @args   - #1 The key to insert, #2 the priority associated with that key
+    // @return - Bool indicating success, false if the key is already in the heap
+    // @info   - Throws a logic_error if the key is out of the range of the heap.
+    bool push(unsigned int, const PriorityType &);
+
+    // @func   - decreaseKey
+    // @args   - #1 The key to update, #2 the new priority associated with that key
+    // @return - Bool indicating success, false if the key is not in the heap or the new priority is not lower than the old one
+    bool decreaseKey(unsigned int, const PriorityType &);
+
+    // @func   - pushOrDecrease
+    // @args   - #1 The key to insert or update, #2 the priority associated with that key
+    // @return - Bool indicating if the heap was changed, false if the key was already in the heap with a lower priority
+    // @info   - This is the operation that Dijkstra's algorithm wants when it relaxes an edge.
+    bool pushOrDecrease(unsigned int, const PriorityType &);
+
+    // @func   - pop
+    // @args   - none
+    // @return - The key with the lowest priority, which is removed from the heap. Throws a logic_error if the heap is empty
+    unsigned int pop();
+
+    // @func   - top
+    // @args   - none
+    // @return - The key with the lowest priority. Throws a logic_error if the heap is empty
+    unsigned int top() const;
+
+    // @func   - topPriority
+    // @args   - none
+    // @return - The priority of the key at the top of the heap. Throws a logic_error if the heap is empty
+    PriorityType topPriority() const;
+
+    // @func   - contains
+    // @args   - #1 The key to search for
+    // @return - True if the key is currently in the heap
+    bool contains(unsigned int) const;
+
+    // @func   - getPriority
+    // @args   - #1 A key that is currently in the heap
+    // @return - The priority associated with that key. Throws a logic_error if the key is not in the heap
+    PriorityType getPriority(unsigned int) const;
+
+    // @func   - clear
+    // @args   - none
+    // @info   - Removes every key from the heap, this is linear in the number of keys in the heap, not the capacity.
+    void clear();
+
+    // @func   - empty
+    // @return - True if there are no keys in the heap
+    bool empty() const;
+
+    // @func   - size
+    // @return - The number of keys in the heap
+    unsigned int size() const;
+
+    // @func   - capacity
+    // @return - One more than the largest key the heap can hold
+    unsigned int capacity() const;
+
+private:
+
+    // @func - siftUp
+    // @args - #1 Position in the heap array of the element to move towards the root
+    void siftUp(unsigned int);
+
+    // @func - siftDown
+    // @args - #1 Position in the heap array of the element to move towards the leaves
+    void siftDown(unsigned int);
+
+    // @info - The heap itself, an array of keys ordered by their priority
+    std::vector<unsigned int> heap;
+
+    // @info - Maps each key to its position in the heap array, -1 if the key is not in the heap
+    std::vector<int> position;
+
+    // @info - Maps each key to its priority, only meaningful for keys that are in the heap
+    std::vector<PriorityType> priority;
+
+};
+
+#include "IndexedHeap.cpp"
+#endif
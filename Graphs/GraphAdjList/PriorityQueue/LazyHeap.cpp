@@ -0,0 +1,89 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - LazyHeap.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the LazyHeap class, see LazyHeap.h for how it is meant to be used.
+**/
+
+#include "LazyHeap.h"
+
+// @func - Constructor
+// @args - #1 The number of entries to reserve space for
+template <class ItemType, class PriorityType>
+LazyHeap<ItemType, PriorityType>::LazyHeap(unsigned int reserve) {
+    heap.reserve(reserve);
+}
+
+// @func   - push
+// @args   - #1 The item to insert, #2 the priority associated with that item
+template <class ItemType, class PriorityType>
+void LazyHeap<ItemType, PriorityType>::push(const ItemType & item, const PriorityType & prio) {
+    heap.push_back(entry(prio, item));
+    std::push_heap(heap.begin(), heap.end(), compare);
+}
+
+// @func   - pop
+// @args   - none
+// @info   - Removes the entry with the lowest priority.
+template <class ItemType, class PriorityType>
+void LazyHeap<ItemType, PriorityType>::pop() {
+
+    if(heap.empty())
+        throw std::logic_error("Pop Called on Empty Heap\n");
+
+    std::pop_heap(heap.begin(), heap.end(), compare);
+    heap.pop_back();
+}
+
+// @func   - top
+// @args   - none
+// @return - The item with the lowest priority.
+template <class ItemType, class PriorityType>
+const ItemType & LazyHeap<ItemType, PriorityType>::top() const {
+
+    if(heap.empty())
+        throw std::logic_error("Top Called on Empty Heap\n");
+
+    return heap.front().second;
+}
+
+// @func   - topPriority
+// @args   - none
+// @return - The priority of the entry at the top of the heap.
+template <class ItemType, class PriorityType>
+const PriorityType & LazyHeap<ItemType, PriorityType>::topPriority() const {
+
+    if(heap.empty())
+        throw std::logic_error("Top Called on Empty Heap\n");
+
+    return heap.front().first;
+}
+
+// @func   - clear
+// @args   - none
+template <class ItemType, class PriorityType>
+void LazyHeap<ItemType, PriorityType>::clear() {
+    heap.clear();
+}
+
+// @func   - empty
+// @return - True if there are no entries in the heap
+template <class ItemType, class PriorityType>
+bool LazyHeap<ItemType, PriorityType>::empty() const {
+    return heap.empty();
+}
+
+// @func   - size
+// @return - The number of entries in the heap, stale entries included
+template <class ItemType, class PriorityType>
+unsigned int LazyHeap<ItemType, PriorityType>::size() const {
+    return heap.size();
+}
+
+// @func - compare
+// @info - Orders the entries by priority only, greater-than so the std heap functions give us a min heap.
+template <class ItemType, class PriorityType>
+bool LazyHeap<ItemType, PriorityType>::compare(const entry & a, const entry & b) {
+    return b.first < a.first;
+}
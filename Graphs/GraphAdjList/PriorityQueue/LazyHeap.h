@@ -0,0 +1,82 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - LazyHeap.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the declaration of the LazyHeap class, a binary min heap of (priority, item) pairs that is meant to be
+*               used with lazy deletion. It is the companion of the IndexedHeap class for when the items can't be mapped to
+*               a dense range of integer keys, e.g. when the items are the data stored in the vertices of a graph.
+*
+*   @Details  - A LazyHeap has no decreaseKey operation. Instead the same item is simply pushed again with its new, lower
+*               priority and the old copy is left in the heap. When the old copy eventually makes it to the top the caller
+*               recognizes it as stale (in Dijkstra's, because its priority is larger than the best known distance to the
+*               item) and pops it without processing it. The heap can therefore grow to the number of relaxations instead
+*               of the number of items, but each push and pop is just a sift in a flat std::vector.
+**/
+
+#ifndef LAZY_HEAP_H
+#define LAZY_HEAP_H
+
+#include <stdexcept>
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+template <class ItemType, class PriorityType = double>
+class LazyHeap
+{
+public:
+
+    // @func - Constructor
+    // @args - #1 The number of entries to reserve space for
+    LazyHeap(unsigned int = 0);
+
+    // @func   - push
+    // @args   - #1 The item to insert, #2 the priority associated with that item
+    // @info   - The item may already be in the heap, the old copy is not removed.
+    void push(const ItemType &, const PriorityType &);
+
+    // @func   - pop
+    // @args   - none
+    // @info   - Removes the entry with the lowest priority. Throws a logic_error if the heap is empty
+    void pop();
+
+    // @func   - top
+    // @args   - none
+    // @return - The item with the lowest priority. Throws a logic_error if the heap is empty
+    const ItemType & top() const;
+
+    // @func   - topPriority
+    // @args   - none
+    // @return - The priority of the entry at the top of the heap. Throws a logic_error if the heap is empty
+    const PriorityType & topPriority() const;
+
+    // @func   - clear
+    // @args   - none
+    // @info   - Removes every entry from the heap, but keeps the memory around for the next use.
+    void clear();
+
+    // @func   - empty
+    // @return - True if there are no entries in the heap
+    bool empty() const;
+
+    // @func   - size
+    // @return - The number of entries in the heap, stale entries included
+    unsigned int size() const;
+
+private:
+
+    typedef std::pair<PriorityType, ItemType> entry;
+
+    // @func - compare
+    // @info - Orders the entries by priority only, so the items don't have to be comparable. The std heap functions build a
+    //         max heap, so this is a greater-than comparison to turn it into a min heap.
+    static bool compare(const entry &, const entry &);
+
+    // @info - The heap itself, maintained with std::push_heap and std::pop_heap
+    std::vector<entry> heap;
+
+};
+
+#include "LazyHeap.cpp"
+#endif
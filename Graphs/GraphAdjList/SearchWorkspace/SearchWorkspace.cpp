@@ -0,0 +1,142 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - SearchWorkspace.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the SearchWorkspace class, see SearchWorkspace.h for how the generations work.
+**/
+
+#include "SearchWorkspace.h"
+
+// @func - Constructor
+// @args - #1 The number of vertices to make room for up front
+template <class VertexType>
+SearchWorkspace<VertexType>::SearchWorkspace(unsigned int num_vertices) : generation(0) {
+    begin(num_vertices);
+}
+
+// @func - begin
+// @args - #1 The number of vertices in the graph about to be searched
+// @info - A stamp of 0 never matches a live generation, so the new slots of a grown workspace start out unreached.
+template <class VertexType>
+void SearchWorkspace<VertexType>::begin(unsigned int num_vertices) {
+
+    if(num_vertices > reached.size()) {
+        reached.resize(num_vertices, 0);
+        scanned.resize(num_vertices, 0);
+        dist.resize(num_vertices);
+        prev.resize(num_vertices);
+        edges.resize(num_vertices);
+        arcs.resize(num_vertices);
+        heap.resize(num_vertices);
+    }
+    else
+        heap.clear();
+
+    if(++generation == 0) {
+        std::fill(reached.begin(), reached.end(), 0);
+        std::fill(scanned.begin(), scanned.end(), 0);
+        generation = 1;
+    }
+
+    frontier.clear();
+}
+
+// @func   - isReached
+// @args   - #1 The dense id of a vertex
+// @return - True if the current search has reached the vertex
+template <class VertexType>
+bool SearchWorkspace<VertexType>::isReached(unsigned int id) const {
+    return reached[id] == generation;
+}
+
+// @func - reach
+// @args - #1 The dense id of a vertex, #2 the vertex it was reached from, #3 its distance
+// @info - The edge and arc are only cleared the first time, a search that improves a vertex sets them again itself.
+template <class VertexType>
+void SearchWorkspace<VertexType>::reach(unsigned int id, int from, double distance) {
+
+    if(reached[id] != generation) {
+        reached[id] = generation;
+        edges[id] = nullptr;
+        arcs[id] = -1;
+    }
+
+    prev[id] = from;
+    dist[id] = distance;
+}
+
+// @func   - isScanned
+// @args   - #1 The dense id of a vertex
+// @return - True if the current search has finished with the vertex
+template <class VertexType>
+bool SearchWorkspace<VertexType>::isScanned(unsigned int id) const {
+    return scanned[id] == generation;
+}
+
+// @func - scan
+// @args - #1 The dense id of a vertex
+template <class VertexType>
+void SearchWorkspace<VertexType>::scan(unsigned int id) {
+    scanned[id] = generation;
+}
+
+// @func   - getDistance
+// @args   - #1 The dense id of a vertex
+// @return - The distance the current search gave the vertex, infinity if it hasn't reached it
+template <class VertexType>
+double SearchWorkspace<VertexType>::getDistance(unsigned int id) const {
+    return reached[id] == generation ? dist[id] : std::numeric_limits<double>::infinity();
+}
+
+// @func   - getPrevious
+// @args   - #1 The dense id of a vertex
+// @return - The id of the vertex it was reached from, -1 if there isn't one
+template <class VertexType>
+int SearchWorkspace<VertexType>::getPrevious(unsigned int id) const {
+    return reached[id] == generation ? prev[id] : -1;
+}
+
+// @func   - getEdge
+// @args   - #1 The dense id of a vertex
+// @return - The edge it was reached along, null if there isn't one
+template <class VertexType>
+Edge<VertexType> * SearchWorkspace<VertexType>::getEdge(unsigned int id) const {
+    return reached[id] == generation ? edges[id] : nullptr;
+}
+
+// @func - setEdge
+// @args - #1 The dense id of a reached vertex, #2 the edge it was reached along
+template <class VertexType>
+void SearchWorkspace<VertexType>::setEdge(unsigned int id, Edge<VertexType> * edge) {
+    edges[id] = edge;
+}
+
+// @func   - getArc
+// @args   - #1 The dense id of a vertex
+// @return - The index of the arc it was reached along, -1 if there isn't one
+template <class VertexType>
+int SearchWorkspace<VertexType>::getArc(unsigned int id) const {
+    return reached[id] == generation ? arcs[id] : -1;
+}
+
+// @func - setArc
+// @args - #1 The dense id of a reached vertex, #2 the index of the arc it was reached along
+template <class VertexType>
+void SearchWorkspace<VertexType>::setArc(unsigned int id, int arc) {
+    arcs[id] = arc;
+}
+
+// @func   - getFrontier
+// @return - The stack or queue of the search
+template <class VertexType>
+std::vector<unsigned int> & SearchWorkspace<VertexType>::getFrontier() {
+    return frontier;
+}
+
+// @func   - getHeap
+// @return - The priority queue of the search
+template <class VertexType>
+IndexedHeap<double> & SearchWorkspace<VertexType>::getHeap() {
+    return heap;
+}
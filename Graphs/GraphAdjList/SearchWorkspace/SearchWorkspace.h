@@ -0,0 +1,115 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - SearchWorkspace.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the declaration of the SearchWorkspace class, the per-vertex bookkeeping of a graph search (which
+*               vertices have been reached, their distances and how they were reached) along with the stack, queue and heap
+*               the search runs on. A caller that runs one query after another hands the same workspace to every search, so
+*               the arrays are allocated once instead of once per query.
+*
+*   @Details  - Getting a workspace ready for the next search is O(1). Every vertex carries the generation of the search that
+*               last reached it, and begin() just starts a new generation, so every vertex that was reached by an older search
+*               reads as unreached without the arrays being touched. Only when the generation counter wraps around are the
+*               stamps actually cleared. The workspace grows to fit the largest graph it has been used on and never shrinks.
+*
+*               A workspace can only be used by one search at a time, give every thread a workspace of its own.
+**/
+
+#ifndef SEARCH_WORKSPACE_H
+#define SEARCH_WORKSPACE_H
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include "../Edge/Edge.h"
+#include "../PriorityQueue/IndexedHeap.h"
+
+template <class VertexType>
+class SearchWorkspace
+{
+public:
+
+    // @func - Constructor
+    // @args - #1 The number of vertices to make room for up front
+    SearchWorkspace(unsigned int = 0);
+
+    // @func - begin
+    // @args - #1 The number of vertices in the graph about to be searched
+    // @info - Marks every vertex as unreached and empties the frontier and the heap, O(1) unless the workspace has to grow.
+    void begin(unsigned int);
+
+    // @func   - isReached
+    // @args   - #1 The dense id of a vertex
+    // @return - True if the current search has reached the vertex
+    bool isReached(unsigned int) const;
+
+    // @func - reach
+    // @args - #1 The dense id of a vertex, #2 the id of the vertex it was reached from (-1 for none), #3 its distance
+    // @info - Marks the vertex as reached, or updates it if it already was.
+    void reach(unsigned int, int = -1, double = std::numeric_limits<double>::infinity());
+
+    // @func   - isScanned
+    // @args   - #1 The dense id of a vertex
+    // @return - True if the current search has finished with the vertex (settled it, for Dijkstra's algorithm)
+    bool isScanned(unsigned int) const;
+
+    // @func - scan
+    // @args - #1 The dense id of a vertex
+    void scan(unsigned int);
+
+    // @func   - getDistance
+    // @args   - #1 The dense id of a vertex
+    // @return - The distance the current search gave the vertex, infinity if it hasn't reached it
+    double getDistance(unsigned int) const;
+
+    // @func   - getPrevious
+    // @args   - #1 The dense id of a vertex
+    // @return - The id of the vertex it was reached from, -1 for the start of the search and for unreached vertices
+    int getPrevious(unsigned int) const;
+
+    // @func   - getEdge
+    // @args   - #1 The dense id of a vertex
+    // @return - The edge it was reached along, null if the search didn't record one
+    Edge<VertexType> * getEdge(unsigned int) const;
+
+    // @func - setEdge
+    // @args - #1 The dense id of a reached vertex, #2 the edge it was reached along
+    void setEdge(unsigned int, Edge<VertexType> *);
+
+    // @func   - getArc
+    // @args   - #1 The dense id of a vertex
+    // @return - The index of the arc it was reached along in a compressed graph, -1 if the search didn't record one
+    int getArc(unsigned int) const;
+
+    // @func - setArc
+    // @args - #1 The dense id of a reached vertex, #2 the index of the arc it was reached along
+    void setArc(unsigned int, int);
+
+    // @func   - getFrontier
+    // @return - The stack or queue of the search, empty at the start of every search
+    std::vector<unsigned int> & getFrontier();
+
+    // @func   - getHeap
+    // @return - The priority queue of the search, empty and big enough for every vertex at the start of every search
+    IndexedHeap<double> & getHeap();
+
+private:
+
+    // the generation of the current search, a vertex whose stamp doesn't match it hasn't been reached yet
+    unsigned int generation;
+
+    std::vector<unsigned int> reached;
+    std::vector<unsigned int> scanned;
+    std::vector<double> dist;
+    std::vector<int> prev;
+    std::vector<Edge<VertexType> *> edges;
+    std::vector<int> arcs;
+
+    std::vector<unsigned int> frontier;
+    IndexedHeap<double> heap;
+};
+
+#include "SearchWorkspace.cpp"
+
+#endif
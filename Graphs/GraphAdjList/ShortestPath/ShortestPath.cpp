@@ -0,0 +1,381 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - ShortestPath.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the shared parallel shortest path searches. Most of it isn't a template, so those
+*               functions are marked inline to keep the header-only layout the rest of the project uses.
+**/
+
+// @func - deltaSteppingSearch
+// @args - #1 The number of vertices, #2 out-arcs, #3 the source, #4 delta and threads, #5 dist output, #6 prev output
+// @info - A delta so small that a heavy arc could jump more than 2^16 buckets ahead is rounded up, which keeps the cyclic
+//         bucket arrays small without changing the answer.
+inline void deltaSteppingSearch(unsigned int num_vertices, const AdjacencyView & out, unsigned int source, const DeltaSteppingOptions & options,
+                                std::vector<double> & dist, std::vector<int> & prev) {
+
+    const double infinity = std::numeric_limits<double>::infinity();
+    const uint64_t none = std::numeric_limits<uint64_t>::max();
+
+    dist.assign(num_vertices, infinity);
+    prev.assign(num_vertices, -1);
+
+    unsigned int num_arcs = out.offsets[num_vertices];
+    double max_weight = requireNonNegative(num_vertices, out);
+
+    double delta = options.delta;
+
+    if(delta <= 0)
+        delta = max_weight / std::max(1.0, (double) num_arcs / num_vertices);
+
+    delta = std::max(delta, max_weight / 65536);
+
+    if(delta <= 0)
+        delta = 1;
+
+    unsigned int threads = options.threads;
+
+    if(!threads)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    threads = std::min(threads, num_vertices);
+
+    // no arc reaches more than max_weight/delta buckets past the one being settled, so the buckets can live in a cyclic
+    // array with one more slot than that, and an entry whose vertex has moved to another bucket is simply skipped
+    std::size_t num_slots = (std::size_t) (max_weight / delta) + 2;
+
+    auto bucket_of = [delta](double distance) { return (uint64_t) (distance / delta); };
+
+    struct Request
+    {
+        unsigned int target;
+        unsigned int source;
+        double distance;
+    };
+
+    std::vector<std::vector<std::vector<unsigned int> > > buckets(threads, std::vector<std::vector<unsigned int> >(num_slots));
+    std::vector<std::vector<Request> > requests(threads * threads);
+    std::vector<double> expanded(num_vertices, infinity);
+    std::vector<char> settled(num_vertices, 0);
+    std::vector<uint64_t> next_bucket(threads, none);
+    std::vector<char> pending(threads, 0);
+    uint64_t current = 0;
+
+    LevelBarrier barrier(threads);
+
+    dist[source] = 0;
+    buckets[source % threads][0].push_back(source);
+
+    auto worker = [&](unsigned int id) {
+
+        auto & mine = buckets[id];
+        std::vector<unsigned int> frontier, removed;
+
+        // writes a request for every light (or every heavy) arc leaving v into the box of the thread that owns its target
+        auto send = [&](unsigned int v, bool light) {
+            for(unsigned int j = out.offsets[v]; j < out.offsets[v+1]; j++) {
+                // an infinite arc can never relax anything, and would land past the end of the cyclic bucket array
+                if(out.weights[j] != infinity && (out.weights[j] <= delta) == light) {
+                    unsigned int target = out.targets[j];
+                    requests[id * threads + target % threads].push_back(Request{target, v, dist[v] + out.weights[j]});
+                }
+            }
+        };
+
+        // applies the requests the other threads addressed to us
+        auto receive = [&]() {
+            for(unsigned int from = 0; from < threads; from++) {
+                for(auto & request : requests[from * threads + id]) {
+                    if(request.distance < dist[request.target]) {
+                        dist[request.target] = request.distance;
+                        prev[request.target] = request.source;
+                        mine[bucket_of(request.distance) % num_slots].push_back(request.target);
+                    }
+                }
+                requests[from * threads + id].clear();
+            }
+        };
+
+        while(true) {
+
+            uint64_t index = current;
+            auto & slot = mine[index % num_slots];
+            removed.clear();
+
+            // relax the light arcs of the bucket until no thread puts anything back into it
+            while(true) {
+
+                frontier.clear();
+
+                for(auto v : slot) {
+                    if(bucket_of(dist[v]) == index && expanded[v] != dist[v]) {
+                        expanded[v] = dist[v];
+                        frontier.push_back(v);
+                    }
+                }
+
+                slot.clear();
+
+                for(auto v : frontier) {
+                    send(v, true);
+                    if(!settled[v]) {
+                        settled[v] = 1;
+                        removed.push_back(v);
+                    }
+                }
+
+                barrier.wait();
+                receive();
+                pending[id] = !slot.empty();
+                barrier.wait();
+
+                bool more = false;
+                for(auto flag : pending)
+                    more |= flag != 0;
+
+                if(!more)
+                    break;
+            }
+
+            // the bucket is settled, a heavy arc always lands in a later bucket so these are relaxed once
+            for(auto v : removed)
+                send(v, false);
+
+            barrier.wait();
+            receive();
+
+            next_bucket[id] = none;
+            for(std::size_t k = 1; k < num_slots; k++) {
+                if(!mine[(index + k) % num_slots].empty()) {
+                    next_bucket[id] = index + k;
+                    break;
+                }
+            }
+
+            barrier.wait();
+
+            if(id == 0)
+                current = *std::min_element(next_bucket.begin(), next_bucket.end());
+
+            barrier.wait();
+
+            if(current == none)
+                return;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for(unsigned int id = 1; id < threads; id++)
+        workers.push_back(std::thread(worker, id));
+
+    worker(0);
+
+    for(auto & thread : workers)
+        thread.join();
+}
+
+// @func - reset
+// @info - Only the vertices the last search reached need to be put back
+inline void DijkstraScratch::reset() {
+
+    for(auto v : touched) {
+        dist[v] = std::numeric_limits<double>::infinity();
+        prev[v] = -1;
+    }
+
+    touched.clear();
+    queue.clear();
+}
+
+// @func - dijkstraSearch
+// @args - #1 out-arcs, #2 the source, #3 the scratch to search in, #4 the stopping condition
+// @info - With non-negative weights a settled vertex can never be improved again, so no scanned flags are needed.
+template<class StopFunction>
+void dijkstraSearch(const AdjacencyView & out, unsigned int source, DijkstraScratch & scratch, StopFunction stop) {
+
+    scratch.dist[source] = 0;
+    scratch.touched.push_back(source);
+    scratch.queue.push(source, 0.0);
+
+    while(!scratch.queue.empty()) {
+
+        unsigned int current = scratch.queue.pop();
+
+        if(stop(current))
+            return;
+
+        for(unsigned int j = out.offsets[current]; j < out.offsets[current+1]; j++) {
+
+            unsigned int target = out.targets[j];
+            double temp_weight = scratch.dist[current] + out.weights[j];
+
+            if(temp_weight < scratch.dist[target]) {
+
+                if(scratch.dist[target] == std::numeric_limits<double>::infinity())
+                    scratch.touched.push_back(target);
+
+                scratch.dist[target] = temp_weight;
+                scratch.prev[target] = current;
+                scratch.queue.pushOrDecrease(target, temp_weight);
+            }
+        }
+    }
+}
+
+// @func - batchShortestPaths
+// @args - #1 The number of vertices, #2 out-arcs, #3 the queries, #4 the number of threads, #5 output
+// @info - Each thread writes its paths into a buffer of its own, they are stitched together in query order at the end.
+inline void batchShortestPaths(unsigned int num_vertices, const AdjacencyView & out, const std::vector<std::pair<unsigned int, unsigned int> > & queries,
+                               unsigned int threads, ShortestPathBatch & result) {
+
+    requireNonNegative(num_vertices, out);
+
+    unsigned int num_queries = queries.size();
+    result.distance.assign(num_queries, std::numeric_limits<double>::infinity());
+    result.path_offsets.assign(num_queries+1, 0);
+    result.path.clear();
+
+    // queries that share a source are answered by the same search
+    std::vector<unsigned int> order(num_queries), groups;
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&queries](unsigned int a, unsigned int b) { return queries[a].first < queries[b].first; });
+
+    for(unsigned int i = 0; i < num_queries; i++)
+        if(i == 0 || queries[order[i]].first != queries[order[i-1]].first)
+            groups.push_back(i);
+
+    unsigned int num_groups = groups.size();
+    groups.push_back(num_queries);
+
+    if(!threads)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    threads = std::max(1u, std::min(threads, num_groups));
+
+    std::vector<std::vector<unsigned int> > paths(threads);
+    std::vector<unsigned int> owner(num_queries), start(num_queries);
+
+    fanOut(num_groups, threads, [&](unsigned int id, std::function<unsigned int()> next) {
+
+        DijkstraScratch scratch(num_vertices);
+        std::vector<unsigned int> wanted(num_vertices, 0);
+        auto & local = paths[id];
+
+        for(unsigned int group = next(); group < num_groups; group = next()) {
+
+            unsigned int first = groups[group], last = groups[group+1], remaining = 0;
+
+            for(unsigned int k = first; k < last; k++)
+                if(!wanted[queries[order[k]].second]++)
+                    remaining++;
+
+            dijkstraSearch(out, queries[order[first]].first, scratch, [&](unsigned int v) {
+                return wanted[v] && --remaining == 0;
+            });
+
+            for(unsigned int k = first; k < last; k++) {
+
+                unsigned int query = order[k], target = queries[query].second;
+                wanted[target] = 0;
+
+                result.distance[query] = scratch.dist[target];
+                owner[query] = id;
+                start[query] = local.size();
+
+                if(scratch.dist[target] == std::numeric_limits<double>::infinity())
+                    continue;
+
+                // walk the path back from the destination, then flip it around
+                for(int v = target; v != -1; v = scratch.prev[v])
+                    local.push_back(v);
+
+                std::reverse(local.begin() + start[query], local.end());
+                result.path_offsets[query+1] = local.size() - start[query];
+            }
+
+            scratch.reset();
+        }
+    });
+
+    for(unsigned int q = 0; q < num_queries; q++)
+        result.path_offsets[q+1] += result.path_offsets[q];
+
+    result.path.resize(result.path_offsets[num_queries]);
+
+    for(unsigned int q = 0; q < num_queries; q++) {
+        auto from = paths[owner[q]].begin() + start[q];
+        std::copy(from, from + (result.path_offsets[q+1] - result.path_offsets[q]), result.path.begin() + result.path_offsets[q]);
+    }
+}
+
+// @func - batchShortestPathTrees
+// @args - #1 The number of vertices, #2 out-arcs, #3 the sources, #4 the number of threads, #5 output
+// @info - The rows start out unreached, so a search only has to copy out the vertices it touched.
+inline void batchShortestPathTrees(unsigned int num_vertices, const AdjacencyView & out, const std::vector<unsigned int> & sources,
+                                   unsigned int threads, ShortestPathTrees & result) {
+
+    requireNonNegative(num_vertices, out);
+
+    result.num_vertices = num_vertices;
+    result.dist.assign((std::size_t) sources.size() * num_vertices, std::numeric_limits<double>::infinity());
+    result.prev.assign((std::size_t) sources.size() * num_vertices, -1);
+
+    fanOut(sources.size(), threads, [&](unsigned int, std::function<unsigned int()> next) {
+
+        DijkstraScratch scratch(num_vertices);
+
+        for(unsigned int s = next(); s < sources.size(); s = next()) {
+
+            dijkstraSearch(out, sources[s], scratch, [](unsigned int) { return false; });
+
+            std::size_t row = (std::size_t) s * num_vertices;
+            for(auto v : scratch.touched) {
+                result.dist[row + v] = scratch.dist[v];
+                result.prev[row + v] = scratch.prev[v];
+            }
+
+            scratch.reset();
+        }
+    });
+}
+
+// @func - requireNonNegative
+// @args - #1 The number of vertices, #2 out-arcs
+// @return - The largest finite arc weight
+inline double requireNonNegative(unsigned int num_vertices, const AdjacencyView & out) {
+
+    double max_weight = 0;
+
+    for(unsigned int j = 0; j < out.offsets[num_vertices]; j++) {
+        if(out.weights[j] < 0)
+            throw std::logic_error("Shortest Path Search Needs Non-Negative Edge Weights\n");
+        if(out.weights[j] != std::numeric_limits<double>::infinity())
+            max_weight = std::max(max_weight, out.weights[j]);
+    }
+
+    return max_weight;
+}
+
+// @func - fanOut
+// @args - #1 The number of jobs, #2 the number of threads, #3 the worker
+// @info - The calling thread does its share as worker 0, there is never more than one thread per job.
+template<class Worker>
+void fanOut(unsigned int num_jobs, unsigned int threads, Worker worker) {
+
+    if(!threads)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    threads = std::max(1u, std::min(threads, num_jobs));
+
+    std::atomic<unsigned int> cursor(0);
+    std::function<unsigned int()> next = [&cursor, num_jobs]() { return std::min(cursor.fetch_add(1), num_jobs); };
+
+    std::vector<std::thread> workers;
+    for(unsigned int id = 1; id < threads; id++)
+        workers.push_back(std::thread(worker, id, next));
+
+    worker(0, next);
+
+    for(auto & thread : workers)
+        thread.join();
+}
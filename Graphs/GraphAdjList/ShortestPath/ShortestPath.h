@@ -0,0 +1,135 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - ShortestPath.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This file declares the parallel shortest path searches that the graph classes share, along with the options
+*               that control them and the structures they return their answers in.
+*
+*   @Details  - Delta-stepping (Meyer and Sanders) groups the tentative distances into buckets of width delta and settles a
+*               whole bucket at a time instead of one vertex at a time. An arc no heavier than delta is light, relaxing it can
+*               put its target back into the bucket being settled, so the light arcs of a bucket are relaxed over and over
+*               until the bucket stays empty. The heavy arcs can only reach later buckets, so they are relaxed once, after the
+*               bucket is settled. Every vertex of a bucket can be relaxed at the same time, which is where the parallelism
+*               comes from.
+*
+*               Every vertex is owned by one thread (vertex v belongs to thread v % threads), and only that thread ever reads or
+*               writes its distance, its predecessor and its bucket. A thread expanding one of its own vertices doesn't relax
+*               the arcs itself, it writes a request (target, distance, source) into a buffer meant for the owner of the target.
+*               After a barrier each thread applies the requests addressed to it, so the distances need no atomics and the
+*               predecessors always agree with them.
+*
+*               The batched searches answer a large number of independent queries at once. Each worker thread pulls queries off
+*               a shared cursor and runs Dijkstra's algorithm in a DijkstraScratch of its own, whose arrays are sized once and
+*               then reset by walking back over the vertices the last search touched, so a query costs what it searches rather
+*               than O(V) plus a round of allocations. Queries that share a source are handed out together and answered by one
+*               search that stops once all of their destinations are settled.
+**/
+
+#ifndef SHORTEST_PATH_H
+#define SHORTEST_PATH_H
+
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <stdexcept>
+#include <numeric>
+#include <utility>
+#include <functional>
+#include "../BreadthFirst/BreadthFirst.h"
+#include "../PriorityQueue/IndexedHeap.h"
+
+// @struct - DeltaSteppingOptions
+// @info   - The last argument to deltaStepping. A delta of 0 picks the largest arc weight divided by the average out degree,
+//           0 threads means one per hardware thread.
+struct DeltaSteppingOptions
+{
+    DeltaSteppingOptions(double d = 0, unsigned int num_threads = 0) : delta(d), threads(num_threads) {}
+
+    double delta;
+    unsigned int threads;
+};
+
+// @func - deltaSteppingSearch
+// @args - #1 The number of vertices, #2 the arcs leaving every vertex, #3 the id of the source, #4 the bucket width and number
+//         of threads to use, #5 output, the length of the shortest path from the source to each vertex (infinity if it can't
+//         be reached), #6 output, the vertex before each vertex on its shortest path (-1 for the source and for the vertices
+//         that can't be reached)
+// @info - Throws a std::logic_error if any arc has a negative weight.
+void deltaSteppingSearch(unsigned int, const AdjacencyView &, unsigned int, const DeltaSteppingOptions &, std::vector<double> &, std::vector<int> &);
+
+// @struct - ShortestPathBatch
+// @info   - The answers to a batch of (source, destination) queries, in the order the queries were given. distance[q] is the
+//           length of the shortest path of query q (infinity if there isn't one), and the path itself is the dense vertex ids
+//           path[path_offsets[q]] through path[path_offsets[q+1]-1], from the source to the destination. A query without a
+//           path has an empty one.
+struct ShortestPathBatch
+{
+    std::vector<double> distance;
+    std::vector<unsigned int> path_offsets;
+    std::vector<unsigned int> path;
+};
+
+// @struct - ShortestPathTrees
+// @info   - One whole shortest path tree per source, in the order the sources were given. Row s of dist and prev holds the
+//           answer for source s, so the distance from source s to vertex v is dist[s*num_vertices + v] (infinity if it can't
+//           be reached) and prev[s*num_vertices + v] is the vertex before v on that path (-1 for the source and the
+//           vertices that can't be reached).
+struct ShortestPathTrees
+{
+    unsigned int num_vertices;
+    std::vector<double> dist;
+    std::vector<int> prev;
+};
+
+// @struct - DijkstraScratch
+// @info   - The arrays one run of Dijkstra's algorithm needs, kept between runs. touched lists every vertex whose distance is
+//           no longer infinity, which is all reset has to put back.
+struct DijkstraScratch
+{
+    DijkstraScratch(unsigned int num_vertices = 0) :
+        dist(num_vertices, std::numeric_limits<double>::infinity()), prev(num_vertices, -1), queue(num_vertices) {}
+
+    // @func - reset
+    // @info - Gets the scratch ready for the next search, O(number of vertices the last search touched)
+    void reset();
+
+    std::vector<double> dist;
+    std::vector<int> prev;
+    std::vector<unsigned int> touched;
+    IndexedHeap<double> queue;
+};
+
+// @func - dijkstraSearch
+// @args - #1 The arcs leaving every vertex, #2 the id of the source, #3 a reset scratch to search in, #4 called with every
+//         vertex as it is settled, the search stops as soon as it returns true
+template<class StopFunction>
+void dijkstraSearch(const AdjacencyView &, unsigned int, DijkstraScratch &, StopFunction);
+
+// @func - batchShortestPaths
+// @args - #1 The number of vertices, #2 the arcs leaving every vertex, #3 the (source, destination) pairs to answer, #4 the
+//         number of threads (0 for one per hardware thread), #5 output, the answers
+// @info - Throws a std::logic_error if any arc has a negative weight.
+void batchShortestPaths(unsigned int, const AdjacencyView &, const std::vector<std::pair<unsigned int, unsigned int> > &, unsigned int, ShortestPathBatch &);
+
+// @func - batchShortestPathTrees
+// @args - #1 The number of vertices, #2 the arcs leaving every vertex, #3 the sources to build trees from, #4 the number of
+//         threads (0 for one per hardware thread), #5 output, the trees
+// @info - Throws a std::logic_error if any arc has a negative weight.
+void batchShortestPathTrees(unsigned int, const AdjacencyView &, const std::vector<unsigned int> &, unsigned int, ShortestPathTrees &);
+
+// @func - requireNonNegative
+// @args - #1 The number of vertices, #2 the arcs leaving every vertex
+// @return - The largest arc weight, leaving out infinite arcs
+// @info - Throws a std::logic_error if any arc has a negative weight.
+double requireNonNegative(unsigned int, const AdjacencyView &);
+
+// @func - fanOut
+// @args - #1 The number of jobs, #2 the number of threads (0 for one per hardware thread), #3 called as worker(thread id, next)
+//         on every thread, where next() hands out the job ids one at a time and returns the number of jobs once they're gone
+template<class Worker>
+void fanOut(unsigned int, unsigned int, Worker);
+
+#include "ShortestPath.cpp"
+
+#endif
@@ -0,0 +1,165 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - SmallVector.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the SmallVector class declared in SmallVector.h.
+**/
+
+#include "SmallVector.h"
+
+// @func - Constructor
+// @args - None
+// @info - Starts out empty, using the inline array
+template <class T, unsigned int InlineCount>
+SmallVector<T, InlineCount>::SmallVector() : elements(local), count(0), space(InlineCount) {}
+
+// @func - Copy Constructor
+// @args - #1 The vector to copy the elements of
+template <class T, unsigned int InlineCount>
+SmallVector<T, InlineCount>::SmallVector(const SmallVector & other) : elements(local), count(0), space(InlineCount) {
+    *this = other;
+}
+
+// @func - Destructor
+// @info - Frees the heap array, if there is one
+template <class T, unsigned int InlineCount>
+SmallVector<T, InlineCount>::~SmallVector() {
+    if(elements != local)
+        delete [] elements;
+}
+
+// @func   - operator=
+// @args   - #1 The vector to copy the elements of
+// @return - This vector
+template <class T, unsigned int InlineCount>
+SmallVector<T, InlineCount> & SmallVector<T, InlineCount>::operator=(const SmallVector & other) {
+
+    if(this == &other)
+        return *this;
+
+    count = 0;
+    grow(other.count);
+    std::copy(other.begin(), other.end(), elements);
+    count = other.count;
+
+    return *this;
+}
+
+template <class T, unsigned int InlineCount>
+typename SmallVector<T, InlineCount>::iterator SmallVector<T, InlineCount>::begin() {
+    return elements;
+}
+
+template <class T, unsigned int InlineCount>
+typename SmallVector<T, InlineCount>::iterator SmallVector<T, InlineCount>::end() {
+    return elements + count;
+}
+
+template <class T, unsigned int InlineCount>
+typename SmallVector<T, InlineCount>::const_iterator SmallVector<T, InlineCount>::begin() const {
+    return elements;
+}
+
+template <class T, unsigned int InlineCount>
+typename SmallVector<T, InlineCount>::const_iterator SmallVector<T, InlineCount>::end() const {
+    return elements + count;
+}
+
+// @func   - size
+// @return - The number of elements in the vector
+template <class T, unsigned int InlineCount>
+unsigned int SmallVector<T, InlineCount>::size() const {
+    return count;
+}
+
+// @func   - empty
+// @return - True if the vector has no elements
+template <class T, unsigned int InlineCount>
+bool SmallVector<T, InlineCount>::empty() const {
+    return count == 0;
+}
+
+// @func   - capacity
+// @return - The number of elements the vector can hold before it has to grow
+template <class T, unsigned int InlineCount>
+unsigned int SmallVector<T, InlineCount>::capacity() const {
+    return space;
+}
+
+// @func   - isInline
+// @return - True if the elements are still stored inside the object itself
+template <class T, unsigned int InlineCount>
+bool SmallVector<T, InlineCount>::isInline() const {
+    return elements == local;
+}
+
+template <class T, unsigned int InlineCount>
+T & SmallVector<T, InlineCount>::operator[](unsigned int i) {
+    return elements[i];
+}
+
+template <class T, unsigned int InlineCount>
+const T & SmallVector<T, InlineCount>::operator[](unsigned int i) const {
+    return elements[i];
+}
+
+template <class T, unsigned int InlineCount>
+T & SmallVector<T, InlineCount>::back() {
+    return elements[count-1];
+}
+
+template <class T, unsigned int InlineCount>
+const T & SmallVector<T, InlineCount>::back() const {
+    return elements[count-1];
+}
+
+// @func - push_back
+// @args - #1 The element to add to the end of the vector
+// @info - Moves the elements to a heap array twice the size of the old one if there's no room left.
+template <class T, unsigned int InlineCount>
+void SmallVector<T, InlineCount>::push_back(const T & value) {
+
+    if(count == space)
+        grow(2*space);
+
+    elements[count++] = value;
+}
+
+// @func - pop_back
+// @info - Removes the last element, the vector has to have one
+template <class T, unsigned int InlineCount>
+void SmallVector<T, InlineCount>::pop_back() {
+    count--;
+}
+
+// @func - clear
+// @info - Removes every element and frees the heap array, so the vector goes back to using its inline array.
+template <class T, unsigned int InlineCount>
+void SmallVector<T, InlineCount>::clear() {
+
+    if(elements != local)
+        delete [] elements;
+
+    elements = local;
+    count = 0;
+    space = InlineCount;
+}
+
+// @func - grow
+// @args - #1 The number of elements the vector needs room for
+template <class T, unsigned int InlineCount>
+void SmallVector<T, InlineCount>::grow(unsigned int needed) {
+
+    if(needed <= space)
+        return;
+
+    T * bigger = new T[needed];
+    std::copy(begin(), end(), bigger);
+
+    if(elements != local)
+        delete [] elements;
+
+    elements = bigger;
+    space = needed;
+}
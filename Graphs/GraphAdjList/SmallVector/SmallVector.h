@@ -0,0 +1,115 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - SmallVector.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the declaration of the SmallVector class, a vector that keeps its first few elements inside of the
+*               object itself and only goes to the heap once it outgrows them. AdjList keeps its edges in one, since most
+*               vertices only have a handful of edges and a std::vector would make a separate allocation for every vertex
+*               that has any at all.
+*
+*   @Details  - The first InlineCount elements live in an array inside the object, after that the elements are moved to a
+*               heap array that doubles in size whenever it fills up. clear() hands the heap array back and goes back to
+*               the inline array. The elements are copied around with plain assignment and are never destroyed one by one,
+*               so the class is only meant for small trivially copyable types like pointers and numbers.
+**/
+
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include <algorithm>
+#include <type_traits>
+
+template <class T, unsigned int InlineCount>
+class SmallVector
+{
+    static_assert(std::is_trivially_copyable<T>::value, "SmallVector only holds trivially copyable types");
+    static_assert(InlineCount > 0, "SmallVector needs room for at least one inline element");
+
+public:
+
+    typedef T value_type;
+    typedef T * iterator;
+    typedef const T * const_iterator;
+
+    // @func - Constructor
+    // @args - None
+    // @info - Starts out empty, using the inline array
+    SmallVector();
+
+    // @func - Copy Constructor
+    // @args - #1 The vector to copy the elements of
+    SmallVector(const SmallVector &);
+
+    // @func - Destructor
+    // @info - Frees the heap array, if there is one
+    ~SmallVector();
+
+    // @func   - operator=
+    // @args   - #1 The vector to copy the elements of
+    // @return - This vector
+    SmallVector & operator=(const SmallVector &);
+
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // @func   - size
+    // @return - The number of elements in the vector
+    unsigned int size() const;
+
+    // @func   - empty
+    // @return - True if the vector has no elements
+    bool empty() const;
+
+    // @func   - capacity
+    // @return - The number of elements the vector can hold before it has to grow
+    unsigned int capacity() const;
+
+    // @func   - isInline
+    // @return - True if the elements are still stored inside the object itself
+    bool isInline() const;
+
+    T & operator[](unsigned int);
+    const T & operator[](unsigned int) const;
+
+    T & back();
+    const T & back() const;
+
+    // @func - push_back
+    // @args - #1 The element to add to the end of the vector
+    // @info - Moves the elements to a heap array twice the size of the old one if there's no room left.
+    void push_back(const T &);
+
+    // @func - pop_back
+    // @info - Removes the last element, the vector has to have one
+    void pop_back();
+
+    // @func - clear
+    // @info - Removes every element and frees the heap array, so the vector goes back to using its inline array.
+    void clear();
+
+private:
+
+    // @func - grow
+    // @args - #1 The number of elements the vector needs room for
+    void grow(unsigned int);
+
+    // @member - elements
+    // @info   - Points at either local or the heap array.
+    T * elements;
+
+    // @member - count, space
+    // @info   - The number of elements in the vector, and how many fit in the array elements points at.
+    unsigned int count;
+    unsigned int space;
+
+    // @member - local
+    // @info   - The inline array, used until the vector has more than InlineCount elements.
+    T local[InlineCount];
+};
+
+#include "SmallVector.cpp"
+
+#endif
@@ -0,0 +1,167 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - SpanningTree.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the shared spanning forest algorithms. They aren't templates, so everything in
+*               here is marked inline to keep the header-only layout the rest of the project uses.
+**/
+
+#include "SpanningTree.h"
+
+// @func - kruskalForest
+// @args - #1 The edges of the graph, sorted by weight in place, #2 a UnionFind with one element per vertex, #3 output, the
+//         edges of the forest in the order they were added
+inline void kruskalForest(std::vector<WeightedArc> & arcs, UnionFind & sets, std::vector<WeightedArc> & tree) {
+
+    std::stable_sort(arcs.begin(), arcs.end(), [](const WeightedArc & a, const WeightedArc & b) { return a.weight < b.weight; });
+
+    for(auto & arc : arcs) {
+
+        // a forest over V vertices can't have more than V-1 edges, so stop looking once every tree has been joined
+        if(sets.getNumSets() == 1)
+            break;
+
+        if(sets.unite(arc.source, arc.target))
+            tree.push_back(arc);
+    }
+}
+
+// @func - boruvkaForest
+// @args - #1 The edges of the graph, #2 a UnionFind with one element per vertex, #3 output, the edges of the forest in the
+//         order they were added
+// @info - Each round finds the lightest edge leaving every tree and adds all of them at once, which at least halves the
+//         number of trees. Edges that end up inside of a tree are dropped from the working list as we go.
+inline void boruvkaForest(const std::vector<WeightedArc> & arcs, UnionFind & sets, std::vector<WeightedArc> & tree) {
+
+    std::vector<unsigned int> live(arcs.size());
+    std::vector<int> cheapest(sets.size(), -1);
+
+    for(unsigned int i = 0; i < arcs.size(); i++)
+        live[i] = i;
+
+    // strict order on the edges, equal weights fall back on the position in the array
+    auto lighter = [&arcs](unsigned int a, unsigned int b) {
+        return arcs[a].weight < arcs[b].weight || (arcs[a].weight == arcs[b].weight && a < b);
+    };
+
+    while(live.size()) {
+
+        unsigned int kept = 0;
+
+        for(unsigned int i = 0; i < live.size(); i++) {
+
+            unsigned int a = sets.find(arcs[live[i]].source);
+            unsigned int b = sets.find(arcs[live[i]].target);
+
+            if(a == b)
+                continue;
+
+            if(cheapest[a] == -1 || lighter(live[i], cheapest[a])) cheapest[a] = live[i];
+            if(cheapest[b] == -1 || lighter(live[i], cheapest[b])) cheapest[b] = live[i];
+
+            live[kept++] = live[i];
+        }
+
+        live.resize(kept);
+
+        for(unsigned int i = 0; i < cheapest.size(); i++) {
+
+            if(cheapest[i] == -1)
+                continue;
+
+            const WeightedArc & arc = arcs[cheapest[i]];
+
+            // two trees may have picked the same edge, only the first one adds it
+            if(sets.unite(arc.source, arc.target))
+                tree.push_back(arc);
+
+            cheapest[i] = -1;
+        }
+    }
+}
+
+// @func - parallelBoruvkaForest
+// @args - #1 The edges of the graph, #2 a ConcurrentUnionFind with one element per vertex, #3 output, the edges of the forest,
+//         #4 the number of worker threads (0 for one per hardware thread)
+// @info - The lightest edge leaving each tree is kept in an atomic per tree and lowered with a compare-and-swap, the edges
+//         are totally ordered (weight, then position) so every thread agrees on which one wins. Each thread keeps its own
+//         list of surviving edges and of tree edges, they are stitched together between the phases.
+inline void parallelBoruvkaForest(const std::vector<WeightedArc> & arcs, ConcurrentUnionFind & sets, std::vector<WeightedArc> & tree, unsigned int threads) {
+
+    const unsigned int none = std::numeric_limits<unsigned int>::max();
+
+    if(threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    unsigned int num_vertices = sets.size();
+    std::unique_ptr<std::atomic<unsigned int>[]> cheapest(new std::atomic<unsigned int>[num_vertices]);
+    std::vector<unsigned int> live(arcs.size());
+    std::vector<std::vector<unsigned int> > kept(threads);
+    std::vector<std::vector<WeightedArc> > joined(threads);
+
+    for(unsigned int i = 0; i < num_vertices; i++)
+        cheapest[i].store(none, std::memory_order_relaxed);
+
+    for(unsigned int i = 0; i < arcs.size(); i++)
+        live[i] = i;
+
+    auto lighter = [&arcs](unsigned int a, unsigned int b) {
+        return arcs[a].weight < arcs[b].weight || (arcs[a].weight == arcs[b].weight && a < b);
+    };
+
+    // lowers cheapest[root] to the given edge if it is lighter than what's there
+    auto offer = [&](unsigned int root, unsigned int arc) {
+        unsigned int current = cheapest[root].load(std::memory_order_relaxed);
+        while((current == none || lighter(arc, current)) &&
+              !cheapest[root].compare_exchange_weak(current, arc, std::memory_order_relaxed));
+    };
+
+    // runs work(thread, begin, end) over [0, count) split into one contiguous block per thread
+    auto run = [threads](unsigned int count, const std::function<void(unsigned int, unsigned int, unsigned int)> & work) {
+        std::vector<std::thread> workers;
+        unsigned int block = (count + threads - 1) / threads;
+        for(unsigned int t = 1; t < threads; t++)
+            workers.push_back(std::thread(work, t, std::min(count, t*block), std::min(count, (t+1)*block)));
+        work(0, 0, std::min(count, block));
+        for(auto & worker : workers)
+            worker.join();
+    };
+
+    while(live.size()) {
+
+        // phase one, every edge that still joins two trees is offered to both of them
+        run(live.size(), [&](unsigned int t, unsigned int begin, unsigned int end) {
+            kept[t].clear();
+            for(unsigned int i = begin; i < end; i++) {
+                unsigned int a = sets.find(arcs[live[i]].source);
+                unsigned int b = sets.find(arcs[live[i]].target);
+                if(a == b)
+                    continue;
+                offer(a, live[i]);
+                offer(b, live[i]);
+                kept[t].push_back(live[i]);
+            }
+        });
+
+        live.clear();
+        for(auto & part : kept)
+            live.insert(live.end(), part.begin(), part.end());
+
+        // phase two, every tree is joined along its lightest edge. Only the thread whose unite succeeds records the edge,
+        // so an edge picked by both of its trees is only added once.
+        run(num_vertices, [&](unsigned int t, unsigned int begin, unsigned int end) {
+            for(unsigned int i = begin; i < end; i++) {
+                unsigned int arc = cheapest[i].load(std::memory_order_relaxed);
+                if(arc == none)
+                    continue;
+                if(sets.unite(arcs[arc].source, arcs[arc].target))
+                    joined[t].push_back(arcs[arc]);
+                cheapest[i].store(none, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    for(auto & part : joined)
+        tree.insert(tree.end(), part.begin(), part.end());
+}
@@ -0,0 +1,82 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - SpanningTree.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This file declares the options that select how the graph classes build a minimum spanning tree, along with
+*               the Kruskal and Boruvka spanning forest algorithms that they share.
+*
+*   @Details  - Prim's algorithm grows one tree out of a vertex by walking the adjacency lists, so each graph class runs it
+*               over its own adjacency lists. Kruskal's and Boruvka's algorithms only ever look at the edges as one flat list,
+*               so the graphs hand them an array of WeightedArcs (edges between dense vertex ids) and they are written once
+*               here. Both work on a UnionFind, which tells the caller which tree every vertex ended up in when they return.
+**/
+
+#ifndef SPANNING_TREE_H
+#define SPANNING_TREE_H
+
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <limits>
+#include <memory>
+#include <functional>
+
+#include "../UnionFind/UnionFind.h"
+#include "../UnionFind/ConcurrentUnionFind.h"
+
+// @enum - SpanningTreeAlgorithm
+// @info - Prim    - Grows the tree out of one vertex with an IndexedHeap, O(E log V). Follows the direction of the edges in a dGraph.
+//         Kruskal - Adds the edges from lightest to heaviest whenever they join two trees, O(E log E).
+//         Boruvka - Every tree adds its lightest outgoing edge each round, O(E log V). The rounds are easy to run in parallel.
+//         Kruskal and Boruvka ignore the direction of the edges in a dGraph. Boruvka runs on more than one thread when
+//         SpanningTreeOptions::threads asks it to.
+enum class SpanningTreeAlgorithm { Prim, Kruskal, Boruvka };
+
+// @struct - SpanningTreeOptions
+// @info   - The second argument to minimumSpanningTree. When forest is false a graph that isn't connected has no spanning
+//           tree, when it is true every connected component gets a tree of its own (a minimum spanning forest). threads is
+//           the number of worker threads Boruvka's algorithm uses, 0 means one per hardware thread. The other algorithms
+//           always run on the calling thread.
+struct SpanningTreeOptions
+{
+    SpanningTreeOptions(SpanningTreeAlgorithm alg = SpanningTreeAlgorithm::Prim, bool span_forest = false, unsigned int num_threads = 1) :
+        algorithm(alg), forest(span_forest), threads(num_threads) {}
+
+    SpanningTreeAlgorithm algorithm;
+    bool forest;
+    unsigned int threads;
+};
+
+// @struct - WeightedArc
+// @info   - An edge between two dense vertex ids
+struct WeightedArc
+{
+    unsigned int source;
+    unsigned int target;
+    double weight;
+};
+
+// @func - kruskalForest
+// @args - #1 The edges of the graph, sorted by weight in place, #2 a UnionFind with one element per vertex, #3 output, the
+//         edges of the forest in the order they were added
+void kruskalForest(std::vector<WeightedArc> &, UnionFind &, std::vector<WeightedArc> &);
+
+// @func - boruvkaForest
+// @args - #1 The edges of the graph, #2 a UnionFind with one element per vertex, #3 output, the edges of the forest in the
+//         order they were added
+// @info - Ties between edges of equal weight are broken by their position in the edge array, which keeps the rounds from
+//         ever picking a cycle.
+void boruvkaForest(const std::vector<WeightedArc> &, UnionFind &, std::vector<WeightedArc> &);
+
+// @func - parallelBoruvkaForest
+// @args - #1 The edges of the graph, #2 a ConcurrentUnionFind with one element per vertex, #3 output, the edges of the forest,
+//         #4 the number of worker threads (0 for one per hardware thread)
+// @info - The same rounds as boruvkaForest, but each round splits the edges between the threads to find the lightest edge
+//         leaving every tree, then splits the trees between the threads to join them along those edges. The forest has
+//         the same weight as the sequential one, the edges just come out in a different order.
+void parallelBoruvkaForest(const std::vector<WeightedArc> &, ConcurrentUnionFind &, std::vector<WeightedArc> &, unsigned int = 0);
+
+#include "SpanningTree.cpp"
+#endif
@@ -0,0 +1,126 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - ObjectPoolTest.cpp
+*   @Data     - 10/18/2026
+*   @Purpose  - This file contains the tests for the ObjectPool slab allocator that the graph classes allocate their Edge and AdjList
+*               objects from, along with a few tests that check the graphs keep their pools in order.
+**/
+
+#include "../../Allocator/ObjectPool.h"
+#include "../../DirectedGraph/dGraph.h"
+#include "../../UndirectedGraph/uGraph.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <set>
+
+
+TEST(ObjectPoolTest, create_and_destroy) {
+
+    ObjectPool<std::string> pool(4, 16);
+    std::vector<std::string *> strings;
+
+    for(int i = 0; i < 100; i++)
+        strings.push_back(pool.create(std::to_string(i)));
+
+    for(int i = 0; i < 100; i++)
+        ASSERT_EQ(std::to_string(i), *strings[i]);
+
+    PoolStats stats = pool.getStats();
+    ASSERT_EQ(100, stats.allocations);
+    ASSERT_EQ(100, stats.live);
+    ASSERT_EQ(true, stats.capacity >= 100);
+
+    // slabs grow 4, 8, 16, 16, ... so 100 objects fit in 8 slabs
+    ASSERT_EQ(8, stats.slabs);
+
+    for(auto str : strings)
+        pool.destroy(str);
+
+    stats = pool.getStats();
+    ASSERT_EQ(0, stats.live);
+    ASSERT_EQ(100, stats.deallocations);
+}
+
+TEST(ObjectPoolTest, slots_are_reused) {
+
+    ObjectPool<double> pool(8);
+    std::set<double *> first;
+
+    for(int i = 0; i < 8; i++)
+        first.insert(pool.create(i));
+
+    for(auto ptr : first)
+        pool.destroy(ptr);
+
+    // everything we create now should come off of the free list instead of a new slab
+    for(int i = 0; i < 8; i++)
+        ASSERT_EQ(1, first.count(pool.create(i*2.0)));
+
+    ASSERT_EQ(1, pool.getStats().slabs);
+
+    pool.release();
+    ASSERT_EQ(0, pool.getStats().slabs);
+    ASSERT_EQ(0, pool.getStats().live);
+}
+
+TEST(ObjectPoolTest, graph_pools) {
+
+    dGraph<int> graph;
+    int num_vertices = 300;
+
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+
+    graph.makeGraphDense();
+
+    ASSERT_EQ(num_vertices, graph.getVertexPoolStats().live);
+    ASSERT_EQ(graph.getNumEdges(), graph.getEdgePoolStats().live);
+
+    // rejected edges are no longer allocated at all
+    unsigned long allocations = graph.getEdgePoolStats().allocations;
+    ASSERT_FALSE(graph.insertEdge(0, 1));
+    ASSERT_EQ(allocations, graph.getEdgePoolStats().allocations);
+
+    // the edges of a deleted vertex go back to the pool and get reused
+    unsigned long capacity = graph.getEdgePoolStats().capacity;
+    ASSERT_EQ(true, graph.deleteVertex(0));
+    ASSERT_EQ(graph.getNumEdges(), graph.getEdgePoolStats().live);
+
+    ASSERT_EQ(true, graph.insertVertex(0));
+    for(int i = 1; i < num_vertices; i++) {
+        graph.insertEdge(0, i);
+        graph.insertEdge(i, 0);
+    }
+    ASSERT_EQ(capacity, graph.getEdgePoolStats().capacity);
+
+    graph.destroyGraph();
+    ASSERT_EQ(0, graph.getEdgePoolStats().slabs);
+    ASSERT_EQ(0, graph.getVertexPoolStats().live);
+}
+
+TEST(ObjectPoolTest, undirected_graph_pools) {
+
+    uGraph<std::string> graph;
+
+    for(int i = 0; i < 100; i++)
+        graph.insertVertex(std::to_string(i));
+
+    graph.makeGraphDense();
+
+    // every undirected edge is stored once in each direction
+    ASSERT_EQ(2*graph.getNumEdges(), graph.getEdgePoolStats().live);
+
+    uGraph<std::string> copy = graph;
+    ASSERT_EQ(graph.getNumEdges(), copy.getNumEdges());
+
+    graph.destroyGraph();
+    ASSERT_EQ(0, graph.getEdgePoolStats().live);
+    ASSERT_EQ(2*copy.getNumEdges(), copy.getEdgePoolStats().live);
+}
+
+
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,459 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - GraphIOTest.cpp
+*   @Data     - 10/18/2026
+*   @Purpose  - This file contains the tests for the EdgeListReader, the file-loading constructors of the graph classes, and
+*               the GraphSnapshot binary format. Each test
+*               writes the file it needs into the current directory and removes it when it is done.
+**/
+
+#include "../../GraphIO/EdgeListReader.h"
+#include "../../GraphIO/GraphSnapshot.h"
+#include "../../DirectedGraph/dGraph.h"
+#include "../../UndirectedGraph/uGraph.h"
+#include <gtest/gtest.h>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <cstddef>
+#include <limits>
+#include <string>
+
+
+// @func - writeFile
+// @info - Writes the given contents to the file with the given name
+void writeFile(const std::string & fn, const std::string & contents) {
+    std::ofstream out(fn.c_str(), std::ios::binary);
+    out << contents;
+}
+
+
+TEST(EdgeListReaderTest, tokens_and_comments) {
+
+    writeFile("reader_test.txt", "# a comment\n% another one\n\n1 2\n  3\t4   2.5\r\n7\n8 9 -1e2");
+
+    EdgeListReader reader("reader_test.txt");
+    EdgeListRecord record;
+
+    ASSERT_EQ(EdgeListFormat::EdgeList, reader.getFormat());
+
+    ASSERT_EQ(true, reader.next(record));
+    ASSERT_EQ(1, parseVertex<int>(record.source));
+    ASSERT_EQ(2, parseVertex<int>(record.target));
+    ASSERT_FALSE(record.has_weight);
+    ASSERT_EQ(1.0, record.weight);
+
+    ASSERT_EQ(true, reader.next(record));
+    ASSERT_EQ("3", parseVertex<std::string>(record.source));
+    ASSERT_EQ(4L, parseVertex<long>(record.target));
+    ASSERT_EQ(2.5, record.weight);
+
+    // a vertex on its own
+    ASSERT_EQ(true, reader.next(record));
+    ASSERT_FALSE(record.has_target);
+    ASSERT_EQ(7, parseVertex<int>(record.source));
+
+    // the last line has no newline
+    ASSERT_EQ(true, reader.next(record));
+    ASSERT_EQ(-100.0, record.weight);
+
+    ASSERT_FALSE(reader.next(record));
+    std::remove("reader_test.txt");
+}
+
+TEST(EdgeListReaderTest, tiny_buffer) {
+
+    // a buffer smaller than a line forces the reader to refill and grow on almost every line
+    std::string contents;
+    for(int i = 0; i < 500; i++)
+        contents += std::to_string(i*1000003) + " " + std::to_string(i+1) + " " + std::to_string(i) + ".25\n";
+
+    writeFile("reader_buffer_test.txt", contents);
+
+    EdgeListReader reader("reader_buffer_test.txt", EdgeListFormat::SNAP, 4);
+    EdgeListRecord record;
+    int count = 0;
+
+    while(reader.next(record)) {
+        ASSERT_EQ(count*1000003L, parseVertex<long>(record.source));
+        ASSERT_EQ(count+1, parseVertex<int>(record.target));
+        ASSERT_EQ(count+0.25, record.weight);
+        count++;
+    }
+
+    ASSERT_EQ(500, count);
+    std::remove("reader_buffer_test.txt");
+}
+
+TEST(EdgeListReaderTest, errors) {
+
+    ASSERT_THROW(EdgeListReader("this_file_does_not_exist.txt"), std::logic_error);
+
+    writeFile("reader_error_test.txt", "1 2\n1 2 abc\n");
+
+    EdgeListReader reader("reader_error_test.txt");
+    EdgeListRecord record;
+
+    ASSERT_EQ(true, reader.next(record));
+    ASSERT_THROW(reader.next(record), std::logic_error);
+    ASSERT_EQ(2, reader.getLineNumber());
+
+    EdgeListToken token;
+    std::string bad = "12x";
+    token.begin = bad.c_str(); token.end = bad.c_str() + bad.size();
+    ASSERT_THROW(parseVertex<int>(token), std::logic_error);
+
+    std::remove("reader_error_test.txt");
+}
+
+TEST(EdgeListReaderTest, integer_range) {
+
+    auto parse = [](const std::string & text) {
+        return EdgeListToken{ text.c_str(), text.c_str() + text.size() };
+    };
+
+    std::string max = "2147483647", min = "-2147483648", above = "2147483648", below = "-2147483649", huge = "3000000000";
+
+    ASSERT_EQ(std::numeric_limits<int>::max(), parseVertex<int>(parse(max)));
+    ASSERT_EQ(std::numeric_limits<int>::min(), parseVertex<int>(parse(min)));
+    ASSERT_THROW(parseVertex<int>(parse(above)), std::logic_error);
+    ASSERT_THROW(parseVertex<int>(parse(below)), std::logic_error);
+    ASSERT_THROW(parseVertex<int>(parse(huge)), std::logic_error);
+    ASSERT_EQ(3000000000u, parseVertex<unsigned int>(parse(huge)));
+
+    std::string byte = "255", past_byte = "256";
+    ASSERT_EQ(255, parseVertex<unsigned char>(parse(byte)));
+    ASSERT_THROW(parseVertex<unsigned char>(parse(past_byte)), std::logic_error);
+
+    // a vertex that doesn't fit is reported with the line it was on instead of wrapping around
+    writeFile("reader_range_test.txt", "1 2\n3000000000 1\n");
+
+    try {
+        dGraph<int> graph("reader_range_test.txt");
+        FAIL();
+    }
+    catch(const std::logic_error & e) {
+        ASSERT_NE(std::string::npos, std::string(e.what()).find("reader_range_test.txt:2"));
+    }
+
+    // and so is a DIMACS header whose counts don't fit
+    writeFile("reader_range_test.gr", "p sp 99999999999999999999 1\n");
+    ASSERT_THROW(dGraph<int>("reader_range_test.gr"), std::logic_error);
+
+    std::remove("reader_range_test.txt");
+    std::remove("reader_range_test.gr");
+}
+
+TEST(GraphLoadTest, directed_edge_list) {
+
+    writeFile("load_test.txt", "1 2 0.5\n2 3 1.5\n3 1 2.5\n1 2 9.0\n4 4\n5\n");
+
+    dGraph<int> graph("load_test.txt");
+
+    // the duplicate 1->2 and the self loop 4->4 are dropped
+    ASSERT_EQ(5, graph.getNumVertices());
+    ASSERT_EQ(3, graph.getNumEdges());
+    ASSERT_EQ(0.5, graph.getEdgeWeight(1, 2));
+    ASSERT_FALSE(graph.containsEdge(2, 1));
+    ASSERT_EQ(true, graph.containsVertex(5));
+
+    std::remove("load_test.txt");
+}
+
+TEST(GraphLoadTest, undirected_dimacs) {
+
+    writeFile("load_test.gr", "c a tiny road network\np sp 4 5\na 1 2 7\na 2 1 7\na 2 3 1\na 3 4 2\na 4 1 3\n");
+
+    uGraph<int> graph("load_test.gr");
+
+    ASSERT_EQ(4, graph.getNumVertices());
+    ASSERT_EQ(4, graph.getNumEdges());
+    ASSERT_EQ(true, graph.containsEdge(1, 2));
+    ASSERT_EQ(true, graph.containsEdge(1, 4));
+
+    auto tree = graph.dijkstrasMinimumTree(1);
+    ASSERT_EQ(6.0, tree->second.at(2));
+    delete(tree);
+
+    std::remove("load_test.gr");
+}
+
+TEST(GraphLoadTest, dimacs_isolated_vertices) {
+
+    // the header declares vertices 1 to 5, only two of which have an arc
+    writeFile("load_test.gr", "p sp 5 1\na 1 2 3\n");
+
+    dGraph<int> directed("load_test.gr");
+    uGraph<std::string> undirected("load_test.gr");
+
+    ASSERT_EQ(5, directed.getNumVertices());
+    ASSERT_EQ(1, directed.getNumEdges());
+    ASSERT_EQ(5, undirected.getNumVertices());
+    ASSERT_EQ(1, undirected.getNumEdges());
+
+    for(int i = 1; i <= 5; i++) {
+        ASSERT_EQ(i-1, directed.getVertexId(i));
+        ASSERT_EQ(true, undirected.containsVertex(std::to_string(i)));
+    }
+
+    ASSERT_EQ(3.0, directed.getEdgeWeight(1, 2));
+
+    // a header with no arcs at all still declares its vertices
+    writeFile("load_test.gr", "c nothing but vertices\np sp 3 0\n");
+    ASSERT_EQ(3, dGraph<int>("load_test.gr").getNumVertices());
+
+    std::remove("load_test.gr");
+}
+
+TEST(GraphLoadTest, clean_snap_strings) {
+
+    std::string contents = "# Directed graph: test.txt\n# FromNodeId\tToNodeId\n";
+    for(int i = 0; i < 1000; i++)
+        contents += "v" + std::to_string(i) + "\tv" + std::to_string((i+1)%1000) + "\n";
+
+    writeFile("load_snap_test.txt", contents);
+
+    dGraph<std::string> graph("load_snap_test.txt", EdgeListFormat::SNAP, true);
+    uGraph<std::string> ugraph("load_snap_test.txt", EdgeListFormat::SNAP, true);
+
+    ASSERT_EQ(1000, graph.getNumVertices());
+    ASSERT_EQ(1000, graph.getNumEdges());
+    ASSERT_EQ(true, graph.isConnected());
+    ASSERT_EQ(true, graph.containsEdge("v999", "v0"));
+
+    ASSERT_EQ(1000, ugraph.getNumEdges());
+    ASSERT_EQ(true, ugraph.containsEdge("v0", "v999"));
+
+    // loading adds to what's already there
+    ASSERT_EQ(true, graph.loadFile("load_snap_test.txt"));
+    ASSERT_EQ(1000, graph.getNumEdges());
+
+    std::remove("load_snap_test.txt");
+}
+
+
+TEST(GraphSnapshotTest, directed_int_round_trip) {
+
+    dGraph<int> graph;
+    for(int i = 0; i < 200; i++)
+        graph.insertVertex(i*7 - 300);
+    for(int i = 0; i < 200; i++) {
+        graph.insertEdge(i*7 - 300, ((i*13)%200)*7 - 300, i + 0.5);
+        graph.insertEdge(i*7 - 300, ((i+1)%200)*7 - 300, 2*i);
+    }
+
+    ASSERT_EQ(true, GraphSnapshot<int>::write(graph, "snapshot_test.bin"));
+
+    GraphSnapshot<int> snap("snapshot_test.bin");
+
+    ASSERT_EQ(true, snap.isDirected());
+    ASSERT_EQ(graph.getNumVertices(), snap.getNumVertices());
+    ASSERT_EQ(graph.getNumEdges(), snap.getNumEdges());
+    ASSERT_EQ(-1, snap.getVertexId(5));
+    ASSERT_FALSE(snap.containsVertex(-301));
+
+    for(int i = 0; i < 200; i++) {
+        int data = i*7 - 300;
+        int id = snap.getVertexId(data);
+        ASSERT_EQ(data, snap.getVertexData(id));
+        ASSERT_EQ(graph.getIncidentEdges(data).size(), snap.getDegree(id));
+
+        for(auto & edge : graph.getIncidentEdges(data)) {
+            ASSERT_EQ(true, snap.containsEdge(data, edge.getTarget()->getData()));
+            ASSERT_EQ(edge.getWeight(), snap.getEdgeWeight(data, edge.getTarget()->getData()));
+        }
+    }
+
+    ASSERT_THROW(snap.getEdgeWeight(-300, -300), std::logic_error);
+    ASSERT_THROW(snap.getVertexData(200), std::logic_error);
+
+    dGraph<int> loaded;
+    snap.load(loaded);
+    ASSERT_EQ(graph.getNumEdges(), loaded.getNumEdges());
+    ASSERT_EQ(graph.getEdgeWeight(-300, -293), loaded.getEdgeWeight(-300, -293));
+
+    csrGraph<int> frozen;
+    snap.load(frozen);
+    ASSERT_EQ(graph.getNumEdges(), frozen.getNumEdges());
+    ASSERT_EQ(graph.isConnected(), frozen.isConnected());
+
+    std::remove("snapshot_test.bin");
+}
+
+TEST(GraphSnapshotTest, undirected_strings) {
+
+    uGraph<std::string> graph;
+    graph.insertVertices({"a", "b", "c", "with space", ""});
+    graph.insertEdge("a", "b", 1.5);
+    graph.insertEdge("b", "c", 2.5);
+    graph.insertEdge("c", "with space", 3.5);
+
+    ASSERT_EQ(true, GraphSnapshot<std::string>::write(graph, "snapshot_string_test.bin"));
+
+    GraphSnapshot<std::string> snap("snapshot_string_test.bin");
+
+    ASSERT_FALSE(snap.isDirected());
+    ASSERT_EQ(5, snap.getNumVertices());
+    ASSERT_EQ(3, snap.getNumEdges());
+    ASSERT_EQ(true, snap.containsVertex(""));
+    ASSERT_EQ(true, snap.containsEdge("with space", "c"));
+    ASSERT_EQ(2.5, snap.getEdgeWeight("c", "b"));
+
+    uGraph<std::string> loaded;
+    snap.load(loaded);
+    ASSERT_EQ(3, loaded.getNumEdges());
+    ASSERT_EQ(true, loaded.containsEdge("b", "a"));
+
+    std::remove("snapshot_string_test.bin");
+}
+
+TEST(GraphSnapshotTest, double_round_trip) {
+
+    // vertices that only differ past the sixth digit have to stay apart
+    std::vector<double> values = { 0.1234567, 0.1234568, 1.0/3, -2.5e-300, 1e300 };
+
+    dGraph<double> graph;
+    for(auto value : values)
+        graph.insertVertex(value);
+    graph.insertEdge(values[0], values[1], 1.0);
+    graph.insertEdge(values[1], values[2], 2.0);
+    graph.insertEdge(values[3], values[4], 3.0);
+
+    ASSERT_EQ(true, GraphSnapshot<double>::write(graph, "snapshot_double_test.bin"));
+
+    GraphSnapshot<double> snap("snapshot_double_test.bin");
+
+    ASSERT_EQ(5, snap.getNumVertices());
+    for(unsigned int i = 0; i < values.size(); i++) {
+        ASSERT_EQ(true, snap.containsVertex(values[i]));
+        ASSERT_EQ(values[i], snap.getVertexData(i));
+    }
+    ASSERT_EQ(true, snap.containsEdge(values[1], values[2]));
+
+    dGraph<double> loaded;
+    snap.load(loaded);
+
+    ASSERT_EQ(5, loaded.getNumVertices());
+    ASSERT_EQ(3, loaded.getNumEdges());
+    ASSERT_EQ(2.0, loaded.getEdgeWeight(values[1], values[2]));
+
+    std::remove("snapshot_double_test.bin");
+}
+
+TEST(GraphSnapshotTest, bad_files) {
+
+    ASSERT_THROW(GraphSnapshot<int>("this_file_does_not_exist.bin"), std::logic_error);
+
+    writeFile("snapshot_bad_test.bin", std::string(200, 'x'));
+    ASSERT_THROW(GraphSnapshot<int>("snapshot_bad_test.bin"), std::logic_error);
+
+    // a snapshot over ints can't be opened as a snapshot over strings or longs
+    dGraph<int> graph;
+    graph.insertVertex(1);
+    ASSERT_EQ(true, GraphSnapshot<int>::write(graph, "snapshot_bad_test.bin"));
+    ASSERT_THROW(GraphSnapshot<std::string>("snapshot_bad_test.bin"), std::logic_error);
+    ASSERT_THROW(GraphSnapshot<long long>("snapshot_bad_test.bin"), std::logic_error);
+
+    std::ifstream in("snapshot_bad_test.bin", std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    writeFile("snapshot_bad_test.bin", contents.substr(0, contents.size()-4));
+    ASSERT_THROW(GraphSnapshot<int>("snapshot_bad_test.bin"), std::logic_error);
+
+    std::remove("snapshot_bad_test.bin");
+}
+
+// @func - patchSnapshot
+// @info - Overwrites the 64 bit header field at the given offset of a snapshot file's contents, and writes them back out
+void patchSnapshot(const std::string & fn, std::string contents, size_t field, uint64_t value) {
+    std::memcpy(&contents[field], &value, sizeof(value));
+    writeFile(fn, contents);
+}
+
+TEST(GraphSnapshotTest, corrupt_sections) {
+
+    dGraph<int> graph;
+    uGraph<std::string> strings;
+
+    for(int i = 0; i < 10; i++) {
+        graph.insertVertex(i);
+        strings.insertVertex(std::to_string(i));
+    }
+
+    for(int i = 0; i < 9; i++) {
+        graph.insertEdge(i, i+1, 1.0);
+        strings.insertEdge(std::to_string(i), std::to_string(i+1), 1.0);
+    }
+
+    ASSERT_EQ(true, GraphSnapshot<int>::write(graph, "snapshot_ints_test.bin"));
+    ASSERT_EQ(true, GraphSnapshot<std::string>::write(strings, "snapshot_strings_test.bin"));
+
+    std::ifstream int_in("snapshot_ints_test.bin", std::ios::binary);
+    std::string ints((std::istreambuf_iterator<char>(int_in)), std::istreambuf_iterator<char>());
+    int_in.close();
+
+    std::ifstream string_in("snapshot_strings_test.bin", std::ios::binary);
+    std::string text((std::istreambuf_iterator<char>(string_in)), std::istreambuf_iterator<char>());
+    string_in.close();
+
+    // every count and section offset that points past the end of the file has to be refused before it is followed
+    std::vector<size_t> fields = { offsetof(SnapshotHeader, num_vertices), offsetof(SnapshotHeader, num_arcs),
+        offsetof(SnapshotHeader, vertex_offset), offsetof(SnapshotHeader, index_offset),
+        offsetof(SnapshotHeader, offsets_offset), offsetof(SnapshotHeader, targets_offset),
+        offsetof(SnapshotHeader, weights_offset) };
+
+    for(auto field : fields) {
+        for(uint64_t value : {(uint64_t) ints.size() - 8, (uint64_t) 1 << 40, std::numeric_limits<uint64_t>::max()}) {
+            patchSnapshot("snapshot_ints_test.bin", ints, field, value);
+            ASSERT_THROW(GraphSnapshot<int>("snapshot_ints_test.bin"), std::logic_error);
+        }
+    }
+
+    for(auto field : {offsetof(SnapshotHeader, num_vertices), offsetof(SnapshotHeader, vertex_offset)}) {
+        for(uint64_t value : {(uint64_t) text.size() - 8, (uint64_t) 1 << 40, std::numeric_limits<uint64_t>::max()}) {
+            patchSnapshot("snapshot_strings_test.bin", text, field, value);
+            ASSERT_THROW(GraphSnapshot<std::string>("snapshot_strings_test.bin"), std::logic_error);
+        }
+    }
+
+    // a section that isn't on an 8 byte boundary is refused too
+    patchSnapshot("snapshot_ints_test.bin", ints, offsetof(SnapshotHeader, offsets_offset), 4);
+    ASSERT_THROW(GraphSnapshot<int>("snapshot_ints_test.bin"), std::logic_error);
+
+    // so is a section whose contents point outside of the graph, the header says where each one is
+    SnapshotHeader head;
+    std::memcpy(&head, ints.data(), sizeof(head));
+
+    std::string corrupt = ints;
+    uint64_t backwards = 5;
+    std::memcpy(&corrupt[head.offsets_offset + 3*sizeof(uint64_t)], &backwards, sizeof(backwards));
+    writeFile("snapshot_ints_test.bin", corrupt);
+    ASSERT_THROW(GraphSnapshot<int>("snapshot_ints_test.bin"), std::logic_error);
+
+    corrupt = ints;
+    uint32_t bad_id = 10;
+    std::memcpy(&corrupt[head.targets_offset + 4*sizeof(uint32_t)], &bad_id, sizeof(bad_id));
+    writeFile("snapshot_ints_test.bin", corrupt);
+    ASSERT_THROW(GraphSnapshot<int>("snapshot_ints_test.bin"), std::logic_error);
+
+    corrupt = ints;
+    std::memcpy(&corrupt[head.index_offset + 7*sizeof(uint32_t)], &bad_id, sizeof(bad_id));
+    writeFile("snapshot_ints_test.bin", corrupt);
+    ASSERT_THROW(GraphSnapshot<int>("snapshot_ints_test.bin"), std::logic_error);
+
+    // and the untouched files still open
+    writeFile("snapshot_ints_test.bin", ints);
+    writeFile("snapshot_strings_test.bin", text);
+    ASSERT_EQ(10, GraphSnapshot<int>("snapshot_ints_test.bin").getNumVertices());
+    ASSERT_EQ(10, GraphSnapshot<std::string>("snapshot_strings_test.bin").getNumVertices());
+
+    std::remove("snapshot_ints_test.bin");
+    std::remove("snapshot_strings_test.bin");
+}
+
+
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,110 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - PriorityQueueTest.cpp
+*   @Data     - 10/18/2026
+*   @Purpose  - This file contains the tests for the priority queues (IndexedHeap and LazyHeap) that the graph algorithms are built
+*               on top of. Both heaps are checked against std::priority_queue on random input.
+**/
+
+#include "../../PriorityQueue/IndexedHeap.h"
+#include "../../PriorityQueue/LazyHeap.h"
+#include <gtest/gtest.h>
+#include <queue>
+#include <string>
+#include <functional>
+
+
+TEST(IndexedHeapTest, push_pop_order) {
+
+    IndexedHeap<double> heap(1000);
+    std::priority_queue<double, std::vector<double>, std::greater<double> > expected;
+
+    for(unsigned int i = 0; i < 1000; i++) {
+        double prio = rand()%5000/7.0;
+        ASSERT_EQ(true, heap.push(i, prio));
+        expected.push(prio);
+    }
+
+    ASSERT_FALSE(heap.push(10, 0.0));
+    ASSERT_EQ(1000, heap.size());
+
+    while(!expected.empty()) {
+        ASSERT_EQ(expected.top(), heap.topPriority());
+        heap.pop();
+        expected.pop();
+    }
+
+    ASSERT_EQ(true, heap.empty());
+    ASSERT_THROW(heap.pop(), std::logic_error);
+    ASSERT_THROW(heap.push(1000, 1.0), std::logic_error);
+}
+
+TEST(IndexedHeapTest, decrease_key) {
+
+    IndexedHeap<int, 2> heap(100);
+
+    for(unsigned int i = 0; i < 100; i++)
+        heap.push(i, 1000+i);
+
+    // reverse the order of the keys through decreaseKey only
+    for(unsigned int i = 0; i < 100; i++)
+        ASSERT_EQ(true, heap.decreaseKey(i, 100-i));
+
+    ASSERT_FALSE(heap.decreaseKey(5, 1000));
+    ASSERT_EQ(95, heap.getPriority(5));
+
+    for(int i = 99; i >= 0; i--) {
+        ASSERT_EQ(true, heap.contains(i));
+        ASSERT_EQ(i, heap.pop());
+        ASSERT_FALSE(heap.contains(i));
+    }
+
+    ASSERT_FALSE(heap.decreaseKey(5, 0));
+}
+
+TEST(IndexedHeapTest, clear_and_reuse) {
+
+    IndexedHeap<double, 8> heap(50);
+
+    for(unsigned int i = 0; i < 50; i += 2)
+        heap.pushOrDecrease(i, i);
+
+    ASSERT_EQ(true, heap.pushOrDecrease(48, -1.0));
+    ASSERT_FALSE(heap.pushOrDecrease(48, 3.0));
+    ASSERT_EQ(48, heap.top());
+
+    heap.clear();
+    ASSERT_EQ(true, heap.empty());
+    ASSERT_FALSE(heap.contains(48));
+
+    ASSERT_EQ(true, heap.push(48, 1.0));
+    ASSERT_EQ(48, heap.pop());
+}
+
+TEST(LazyHeapTest, push_pop_order) {
+
+    LazyHeap<std::string> heap;
+    std::priority_queue<int, std::vector<int>, std::greater<int> > expected;
+
+    for(int i = 0; i < 1000; i++) {
+        int prio = rand()%300;
+        heap.push(std::to_string(prio), prio);
+        expected.push(prio);
+    }
+
+    while(!expected.empty()) {
+        ASSERT_EQ(expected.top(), heap.topPriority());
+        ASSERT_EQ(std::to_string(expected.top()), heap.top());
+        heap.pop();
+        expected.pop();
+    }
+
+    ASSERT_THROW(heap.top(), std::logic_error);
+}
+
+
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,132 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - UnionFindTest.cpp
+*   @Data     - 10/18/2026
+*   @Purpose  - This file contains the tests for the UnionFind and ConcurrentUnionFind classes and the shared spanning forest
+*               algorithms built on top of them.
+**/
+
+#include "../../UnionFind/UnionFind.h"
+#include "../../UnionFind/ConcurrentUnionFind.h"
+#include "../../SpanningTree/SpanningTree.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <thread>
+
+
+TEST(UnionFindTest, unite_and_find) {
+
+    UnionFind sets(10);
+
+    ASSERT_EQ(10u, sets.size());
+    ASSERT_EQ(10u, sets.getNumSets());
+
+    ASSERT_EQ(true, sets.unite(0, 1));
+    ASSERT_EQ(true, sets.unite(2, 3));
+    ASSERT_EQ(true, sets.unite(1, 3));
+    ASSERT_FALSE(sets.unite(0, 2));
+
+    ASSERT_EQ(7u, sets.getNumSets());
+    ASSERT_EQ(true, sets.connected(0, 3));
+    ASSERT_FALSE(sets.connected(0, 4));
+    ASSERT_EQ(4u, sets.getSetSize(2));
+    ASSERT_EQ(1u, sets.getSetSize(9));
+
+    sets.reset(3);
+    ASSERT_EQ(3u, sets.getNumSets());
+    ASSERT_FALSE(sets.connected(0, 1));
+
+    ASSERT_EQ(3u, sets.add());
+    ASSERT_EQ(4u, sets.size());
+    ASSERT_EQ(4u, sets.getNumSets());
+    ASSERT_EQ(true, sets.unite(3, 0));
+    ASSERT_EQ(2u, sets.getSetSize(0));
+}
+
+TEST(UnionFindTest, long_chain) {
+
+    // unite a long chain in the worst order for a naive forest and make sure every element ends up in one set
+    unsigned int n = 200000;
+    UnionFind sets(n);
+
+    for(unsigned int i = 1; i < n; i++)
+        ASSERT_EQ(true, sets.unite(i-1, i));
+
+    ASSERT_EQ(1u, sets.getNumSets());
+    ASSERT_EQ(n, sets.getSetSize(0));
+
+    for(unsigned int i = 0; i < n; i += 997)
+        ASSERT_EQ(sets.find(0), sets.find(i));
+}
+
+TEST(ConcurrentUnionFindTest, threads_agree) {
+
+    // every thread unites the same chain from a different starting point, exactly n-1 of the unites can succeed
+    unsigned int n = 100000, num_threads = 8;
+    ConcurrentUnionFind sets(n);
+    std::vector<unsigned int> successes(num_threads, 0);
+    std::vector<std::thread> workers;
+
+    for(unsigned int t = 0; t < num_threads; t++) {
+        workers.push_back(std::thread([&sets, &successes, n, t, num_threads]() {
+            for(unsigned int k = 0; k < n-1; k++) {
+                unsigned int i = (k + t*(n/num_threads)) % (n-1);
+                if(sets.unite(i, i+1))
+                    successes[t]++;
+            }
+        }));
+    }
+
+    for(auto & worker : workers)
+        worker.join();
+
+    unsigned int total = 0;
+    for(auto count : successes)
+        total += count;
+
+    ASSERT_EQ(n-1, total);
+    ASSERT_EQ(0u, sets.find(n-1));
+    ASSERT_EQ(true, sets.connected(17, n/2));
+}
+
+TEST(SpanningForestTest, kruskal_and_boruvka) {
+
+    unsigned int n = 5000;
+    std::vector<WeightedArc> arcs;
+
+    for(unsigned int i = 0; i < 6*n; i++)
+        arcs.push_back(WeightedArc{(unsigned int) rand()%n, (unsigned int) rand()%n, (double) (rand()%50)});
+
+    std::vector<WeightedArc> kruskal_tree, boruvka_tree, parallel_tree, copy = arcs;
+    UnionFind kruskal_sets(n), boruvka_sets(n);
+    ConcurrentUnionFind parallel_sets(n);
+
+    kruskalForest(copy, kruskal_sets, kruskal_tree);
+    boruvkaForest(arcs, boruvka_sets, boruvka_tree);
+    parallelBoruvkaForest(arcs, parallel_sets, parallel_tree, 4);
+
+    double kruskal_weight = 0, boruvka_weight = 0, parallel_weight = 0;
+    for(auto & arc : kruskal_tree) kruskal_weight += arc.weight;
+    for(auto & arc : boruvka_tree) boruvka_weight += arc.weight;
+    for(auto & arc : parallel_tree) parallel_weight += arc.weight;
+
+    // lots of ties between the weights, but every minimum spanning forest has the same weight and the same number of trees
+    ASSERT_EQ(kruskal_sets.getNumSets(), boruvka_sets.getNumSets());
+    ASSERT_EQ(kruskal_tree.size(), boruvka_tree.size());
+    ASSERT_EQ(n - kruskal_sets.getNumSets(), kruskal_tree.size());
+    ASSERT_EQ(kruskal_weight, boruvka_weight);
+    ASSERT_EQ(kruskal_tree.size(), parallel_tree.size());
+    ASSERT_EQ(kruskal_weight, parallel_weight);
+
+    // every edge the parallel version picked has to join two different trees
+    UnionFind check(n);
+    for(auto & arc : parallel_tree)
+        ASSERT_EQ(true, check.unite(arc.source, arc.target));
+}
+
+
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,827 @@
+#include "../../../CompressedGraph/csrGraph.h"
+#include "../../../DirectedGraph/dGraph.h"
+#include "../../../UndirectedGraph/uGraph.h"
+#include "../../../../GraphTraveler/dTraveler.hpp"
+#include "../../../../GraphTraveler/uTraveler.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <chrono>
+#include <thread>
+
+
+double csrSetWeight(int & one, int & two) {
+    return (rand()%177+3*one+two)/((rand()+1)%125+1.0)*(one*13.0+two*17.0)/(one+two+2.0)*27.0+0.5;
+}
+
+// @func - makeRandomGraph
+// @info - Fills in the given graph with num_vertices vertices and num_edges random weighted edges, plus a ring so that it's connected.
+template<class GraphType>
+void makeRandomGraph(GraphType & graph, int num_vertices, int num_edges) {
+
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertEdge(i, (i+1)%num_vertices, (rand()%1000+1)/10.0);
+
+    for(int i = 0; i < num_edges; i++)
+        graph.insertEdge(rand()%num_vertices, rand()%num_vertices, (rand()%1000+1)/10.0);
+}
+
+
+////////////////////////////////////////////////////
+///////////////// ALGORITHM TESTS //////////////////
+////////////////////////////////////////////////////
+
+TEST(CSRAlgorithmTest, traversal_reaches_same_vertices) {
+
+    dGraph<int> graph;
+    makeRandomGraph(graph, 500, 2000);
+    graph.insertVertex(1000); // unreachable from everything
+
+    csrGraph<int> frozen(graph);
+
+    dTraveler<int> bfs, dfs;
+    ASSERT_EQ(true, frozen.breadthFirst(7, &bfs));
+    ASSERT_EQ(true, frozen.depthFirst(7, &dfs));
+    ASSERT_FALSE(frozen.breadthFirst(-1));
+
+    ASSERT_EQ(500, bfs.graph.getNumVertices());
+    ASSERT_EQ(500, dfs.graph.getNumVertices());
+
+    // the traversed edges form a tree rooted at the start vertex
+    ASSERT_EQ(499, bfs.graph.getNumEdges());
+    ASSERT_EQ(499, dfs.graph.getNumEdges());
+
+    ASSERT_FALSE(frozen.isConnected());
+    frozen.deleteVertex(1000);
+    ASSERT_EQ(true, frozen.isConnected());
+}
+
+TEST(CSRAlgorithmTest, directed_connectivity) {
+
+    csrGraph<int> graph;
+    for(int i = 0; i < 4; i++)
+        graph.insertVertex(i);
+
+    graph.insertEdge(0, 1);
+    graph.insertEdge(1, 2);
+    graph.insertEdge(2, 3);
+
+    // everything is reachable from 0, but 0 is not reachable from anything
+    ASSERT_FALSE(graph.isConnected());
+
+    graph.insertEdge(3, 0);
+    ASSERT_EQ(true, graph.isConnected());
+}
+
+TEST(CSRAlgorithmTest, dijkstras_matches_dGraph) {
+
+    dGraph<int> graph;
+    int num_vertices = 400;
+    makeRandomGraph(graph, num_vertices, 4000);
+
+    csrGraph<int> frozen(graph);
+
+    for(int k = 0; k < 5; k++) {
+        int src = rand()%num_vertices;
+
+        auto expected = graph.dijkstrasMinimumTree(src);
+        auto actual = frozen.dijkstrasMinimumTree(src);
+
+        for(int i = 0; i < num_vertices; i++)
+            ASSERT_NEAR(expected->second.at(i), actual->second.at(i), 1e-9);
+
+        delete(expected);
+        delete(actual);
+    }
+}
+
+TEST(CSRAlgorithmTest, shortest_path_traveler) {
+
+    uGraph<int> graph;
+    int num_vertices = 300;
+    makeRandomGraph(graph, num_vertices, 1500);
+
+    csrGraph<int> frozen(graph);
+
+    for(int k = 0; k < 10; k++) {
+        int src = rand()%num_vertices, dest = rand()%num_vertices;
+
+        auto tree = frozen.dijkstrasMinimumTree(src);
+        double expected = tree->second.at(dest);
+        delete(tree);
+
+        dTraveler<int> trav;
+        ASSERT_EQ(true, frozen.dijkstrasShortestPath(src, dest, &trav));
+
+        // add up the weights along the path the traveler was handed
+        double total = 0.0;
+        for(auto & edge : trav.graph.getAllEdges())
+            total += edge.getWeight();
+
+        ASSERT_NEAR(expected, total, 1e-9);
+    }
+}
+
+TEST(CSRAlgorithmTest, minimum_spanning_tree) {
+
+    uGraph<int> graph;
+    int num_vertices = 300;
+
+    for(int i = 1; i <= num_vertices; i++)
+        graph.insertVertex(i);
+
+    double (*fptr)(int &, int &) = csrSetWeight;
+    graph.makeGraphDense(fptr);
+
+    csrGraph<int> frozen(graph);
+
+    uTraveler<int> expected, actual;
+    ASSERT_EQ(true, graph.minimumSpanningTree(&expected));
+    ASSERT_EQ(true, frozen.minimumSpanningTree(&actual));
+
+    ASSERT_EQ(num_vertices, actual.graph.getNumVertices());
+    ASSERT_EQ(num_vertices-1, actual.graph.getNumEdges());
+
+    double expected_weight = 0.0, actual_weight = 0.0;
+    for(auto & edge : expected.graph.getAllEdges()) expected_weight += edge.getWeight();
+    for(auto & edge : actual.graph.getAllEdges()) actual_weight += edge.getWeight();
+
+    ASSERT_NEAR(expected_weight, actual_weight, 1e-6);
+}
+
+TEST(CSRAlgorithmTest, bipartite) {
+
+    uGraph<int> graph;
+    for(int i = 1; i < 7; i++)
+        graph.insertVertex(i);
+
+    graph.insertEdge(1, 2);
+    graph.insertEdge(2, 3);
+    graph.insertEdge(3, 4);
+    graph.insertEdge(4, 5);
+    graph.insertEdge(5, 6);
+    graph.insertEdge(6, 1);
+
+    csrGraph<int> frozen(graph);
+    ASSERT_EQ(true, frozen.isBipartite());
+
+    frozen.insertEdge(1, 3);
+    ASSERT_FALSE(frozen.isBipartite());
+}
+
+/////////////////////////////////////////////////
+////////////////    SPEED TESTS /////////////////
+/////////////////////////////////////////////////
+
+TEST(CSRAlgorithmTest, a_star_matches_dijkstras) {
+
+    dGraph<int> graph;
+    makeRandomGraph(graph, 2000, 10000);
+    csrGraph<int> frozen(graph);
+
+    auto tree = frozen.dijkstrasMinimumTree(0);
+    auto none = [](int &, int &) { return 0.0; };
+
+    for(int goal = 1; goal < 2000; goal += 37) {
+
+        unsigned int expanded = 0;
+        auto path = frozen.aStar(0, std::vector<int>{goal}, none, &expanded);
+        double total = 0;
+
+        for(unsigned int i = 0; i < path.size(); i++)
+            total += frozen.getEdgeWeight(i ? path[i-1] : 0, path[i]);
+
+        ASSERT_DOUBLE_EQ(tree->second.at(goal), total);
+        ASSERT_EQ(goal, path.back());
+        ASSERT_GT(expanded, 0u);
+    }
+
+    delete(tree);
+}
+
+TEST(CSRSpeedTests, large_bfs_compare) {
+
+    dGraph<int> graph;
+    int num_vertices = 20000;
+    makeRandomGraph(graph, num_vertices, 200000);
+
+    csrGraph<int> frozen(graph);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    graph.breadthFirst(0);
+    auto elapsed = std::chrono::high_resolution_clock::now() - start;
+    long long list_time = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    frozen.breadthFirst(0);
+    elapsed = std::chrono::high_resolution_clock::now() - start;
+    long long csr_time = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+    std::cout << "[   INFO   ] BFS dGraph : " << list_time << "us  --  csrGraph : " << csr_time << "us\n";
+}
+
+TEST(CSRAlgorithmTest, minimum_cut_matches) {
+
+    // a directed cut counts the edges that cross it either way, so every graph below has to agree on the weight
+    dGraph<int> graph;
+    makeRandomGraph(graph, 200, 1500);
+
+    csrGraph<int> frozen(graph);
+
+    double list_weight = -1, csr_weight = -1;
+    auto list_cut = graph.minimumCut(&list_weight);
+    auto csr_cut = frozen.minimumCut(&csr_weight);
+
+    ASSERT_EQ(2, csr_cut.size());
+    ASSERT_EQ(graph.getNumVertices(), csr_cut[0].size() + csr_cut[1].size());
+    ASSERT_NEAR(list_weight, csr_weight, 1e-9);
+
+    double crossing = 0;
+    for(auto one : csr_cut[0]) {
+        for(auto two : csr_cut[1]) {
+            if(graph.containsEdge(one, two)) crossing += graph.getEdgeWeight(one, two);
+            if(graph.containsEdge(two, one)) crossing += graph.getEdgeWeight(two, one);
+        }
+    }
+
+    ASSERT_NEAR(csr_weight, crossing, 1e-9);
+}
+
+// @class - LevelTraveler
+// @info  - Works out the depth of every vertex from the tree edges of a breadth first search, and counts the tree edges
+//          whose source hadn't been reached yet when they were handed over (there shouldn't be any)
+class LevelTraveler : public GraphTraveler<int>
+{
+public:
+    LevelTraveler() : out_of_order(0) {}
+    void discover_vertex(const int &) {}
+    void examine_edge(const Edge<int> &) {}
+    void traverse_edge(const Edge<int> & edge) {
+        auto source = depth.find(edge.getSource()->getData());
+        if(source == depth.end() || depth.count(edge.getTarget()->getData()))
+            out_of_order++;
+        else
+            depth[edge.getTarget()->getData()] = source->second + 1;
+    }
+    void starting_vertex(const int & root) { depth[root] = 0; }
+    void finished_traversal() {}
+    std::unordered_map<int, int> depth;
+    int out_of_order;
+};
+
+// @func - checkDirectionOptimizing
+// @info - Runs the direction-optimizing search with thresholds that force it to stay top-down, to go bottom-up as soon as
+//         it can, and with the default thresholds, and checks every one against the depths of a plain top-down search
+template<class GraphType>
+void checkDirectionOptimizing(GraphType & graph, int root) {
+
+    LevelTraveler expected;
+    ASSERT_EQ(true, graph.breadthFirst(root, &expected));
+
+    std::vector<BreadthFirstOptions> configs = {
+        BreadthFirstOptions(BreadthFirstStrategy::DirectionOptimizing, 0, 24),
+        BreadthFirstOptions(BreadthFirstStrategy::DirectionOptimizing, 1000000, 1000000),
+        BreadthFirstOptions(BreadthFirstStrategy::DirectionOptimizing) };
+
+    for(auto & options : configs) {
+
+        LevelTraveler trav;
+        ASSERT_EQ(true, graph.breadthFirst(root, &trav, options));
+        ASSERT_EQ(0, trav.out_of_order);
+        ASSERT_EQ(expected.depth, trav.depth);
+    }
+
+    ASSERT_EQ(false, graph.breadthFirst(-1, nullptr, configs[2]));
+}
+
+TEST(CSRAlgorithmTest, direction_optimizing_bfs) {
+
+    srand(15);
+
+    // a sparse directed graph with a long ring, and a denser undirected one with a small diameter
+    dGraph<int> directed;
+    makeRandomGraph(directed, 2000, 3000);
+    directed.insertVertex(-5);
+
+    uGraph<int> undirected;
+    makeRandomGraph(undirected, 2000, 30000);
+    undirected.insertVertex(-5);
+
+    csrGraph<int> frozen_directed(directed), frozen_undirected(undirected);
+
+    for(int root : {0, 777}) {
+        checkDirectionOptimizing(directed, root);
+        checkDirectionOptimizing(undirected, root);
+        checkDirectionOptimizing(frozen_directed, root);
+        checkDirectionOptimizing(frozen_undirected, root);
+    }
+}
+
+TEST(CSRSpeedTests, direction_optimizing_bfs_compare) {
+
+    uGraph<int> graph;
+    int num_vertices = 50000;
+    makeRandomGraph(graph, num_vertices, 400000);
+
+    csrGraph<int> frozen(graph);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    frozen.breadthFirst(0);
+    auto elapsed = std::chrono::high_resolution_clock::now() - start;
+    long long top_down_time = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    frozen.breadthFirst(0, nullptr, BreadthFirstOptions(BreadthFirstStrategy::DirectionOptimizing));
+    elapsed = std::chrono::high_resolution_clock::now() - start;
+    long long optimizing_time = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+    std::cout << "[   INFO   ] BFS top-down : " << top_down_time << "us  --  direction-optimizing : " << optimizing_time << "us\n";
+}
+
+// @func - checkParallelBreadthFirst
+// @info - Runs the multi-threaded search with a few thread counts, checks the distances against the depths of a plain
+//         top-down search and makes sure every parent is one level up and has an edge to its child
+template<class GraphType>
+void checkParallelBreadthFirst(GraphType & graph, int root) {
+
+    LevelTraveler expected;
+    ASSERT_EQ(true, graph.breadthFirst(root, &expected));
+
+    for(unsigned int threads : {1u, 4u, 0u}) {
+
+        std::vector<int> distance, parent;
+        ASSERT_EQ(true, graph.parallelBreadthFirst(root, distance, parent, threads));
+        ASSERT_EQ((unsigned int) graph.getNumVertices(), distance.size());
+
+        int reached = 0;
+        for(unsigned int v = 0; v < distance.size(); v++) {
+
+            if(distance[v] == -1) {
+                ASSERT_EQ(0u, expected.depth.count(graph.getVertexData(v)));
+                ASSERT_EQ(-1, parent[v]);
+                continue;
+            }
+
+            reached++;
+            ASSERT_EQ(expected.depth[graph.getVertexData(v)], distance[v]);
+
+            if(distance[v] == 0) {
+                ASSERT_EQ((int) v, parent[v]);
+                continue;
+            }
+
+            ASSERT_EQ(distance[v]-1, distance[parent[v]]);
+
+            bool has_edge = false;
+            for(auto & edge : graph.getIncidentEdges(graph.getVertexData(parent[v])))
+                has_edge |= edge.getTarget()->getData() == graph.getVertexData(v);
+            ASSERT_EQ(true, has_edge);
+        }
+
+        ASSERT_EQ((int) expected.depth.size(), reached);
+    }
+
+    std::vector<int> distance, parent;
+    ASSERT_EQ(false, graph.parallelBreadthFirst(-1, distance, parent));
+}
+
+TEST(CSRAlgorithmTest, parallel_bfs) {
+
+    srand(16);
+
+    dGraph<int> directed;
+    makeRandomGraph(directed, 2000, 3000);
+    directed.insertVertex(-5);
+
+    uGraph<int> undirected;
+    makeRandomGraph(undirected, 2000, 30000);
+    undirected.insertVertex(-5);
+
+    csrGraph<int> frozen_directed(directed), frozen_undirected(undirected);
+
+    for(int root : {0, 777}) {
+        checkParallelBreadthFirst(directed, root);
+        checkParallelBreadthFirst(undirected, root);
+        checkParallelBreadthFirst(frozen_directed, root);
+        checkParallelBreadthFirst(frozen_undirected, root);
+    }
+}
+
+TEST(CSRSpeedTests, parallel_bfs_compare) {
+
+    uGraph<int> graph;
+    int num_vertices = 50000;
+    makeRandomGraph(graph, num_vertices, 400000);
+
+    csrGraph<int> frozen(graph);
+    std::vector<int> distance, parent;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    frozen.parallelBreadthFirst(0, distance, parent, 1);
+    auto elapsed = std::chrono::high_resolution_clock::now() - start;
+    long long single_time = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    frozen.parallelBreadthFirst(0, distance, parent);
+    elapsed = std::chrono::high_resolution_clock::now() - start;
+    long long parallel_time = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+    std::cout << "[   INFO   ] BFS one thread : " << single_time << "us  --  " << std::thread::hardware_concurrency() << " threads : " << parallel_time << "us\n";
+}
+
+// @func - checkDeltaStepping
+// @info - Runs delta-stepping with a few bucket widths and thread counts and checks the distances against Dijkstra's, and
+//         that every predecessor is the end of an edge that a shortest path can take
+template<class GraphType>
+void checkDeltaStepping(GraphType & graph, int source) {
+
+    auto expected = graph.dijkstrasMinimumTree(source);
+
+    std::vector<DeltaSteppingOptions> configs = {
+        DeltaSteppingOptions(), DeltaSteppingOptions(0, 1), DeltaSteppingOptions(0.5, 4), DeltaSteppingOptions(1e9, 3) };
+
+    for(auto & options : configs) {
+
+        std::vector<double> dist;
+        std::vector<int> prev;
+        ASSERT_EQ(true, graph.deltaStepping(source, dist, prev, options));
+        ASSERT_EQ((unsigned int) graph.getNumVertices(), dist.size());
+
+        for(unsigned int v = 0; v < dist.size(); v++) {
+
+            int data = graph.getVertexData(v);
+
+            if(!expected->second.count(data) || expected->second.at(data) == std::numeric_limits<double>::infinity()) {
+                ASSERT_EQ(std::numeric_limits<double>::infinity(), dist[v]);
+                ASSERT_EQ(-1, prev[v]);
+                continue;
+            }
+
+            ASSERT_NEAR(expected->second.at(data), dist[v], 1e-9);
+
+            if(data == source) {
+                ASSERT_EQ(-1, prev[v]);
+                continue;
+            }
+
+            bool on_path = false;
+            for(auto & edge : graph.getIncidentEdges(graph.getVertexData(prev[v])))
+                on_path |= edge.getTarget()->getData() == data && std::fabs(dist[prev[v]] + edge.getWeight() - dist[v]) < 1e-9;
+            ASSERT_EQ(true, on_path);
+        }
+    }
+
+    delete(expected);
+
+    std::vector<double> dist;
+    std::vector<int> prev;
+    ASSERT_EQ(false, graph.deltaStepping(-1, dist, prev));
+}
+
+TEST(CSRAlgorithmTest, delta_stepping_matches_dijkstras) {
+
+    srand(17);
+
+    dGraph<int> directed;
+    makeRandomGraph(directed, 1000, 1500);
+    directed.insertVertex(-5);
+
+    uGraph<int> undirected;
+    makeRandomGraph(undirected, 1000, 8000);
+    undirected.insertVertex(-5);
+
+    // a few zero weight edges, which are light no matter how narrow the buckets are
+    for(int i = 0; i < 50; i++) {
+        directed.insertEdge(rand()%1000, rand()%1000, 0.0);
+        undirected.insertEdge(rand()%1000, rand()%1000, 0.0);
+    }
+
+    csrGraph<int> frozen_directed(directed), frozen_undirected(undirected);
+
+    for(int source : {0, 555}) {
+        checkDeltaStepping(directed, source);
+        checkDeltaStepping(undirected, source);
+        checkDeltaStepping(frozen_directed, source);
+        checkDeltaStepping(frozen_undirected, source);
+    }
+
+    dGraph<int> negative;
+    negative.insertVertex(1);
+    negative.insertVertex(2);
+    negative.insertEdge(1, 2, -1.0);
+
+    std::vector<double> dist;
+    std::vector<int> prev;
+    ASSERT_THROW(negative.deltaStepping(1, dist, prev), std::logic_error);
+}
+
+TEST(CSRAlgorithmTest, delta_stepping_infinite_edges) {
+
+    // an infinite edge used to make the bucket width infinite (or the bucket count overflow), it has to be ignored instead
+    dGraph<int> directed;
+    uGraph<int> undirected;
+
+    for(int i = 0; i < 5; i++) {
+        directed.insertVertex(i);
+        undirected.insertVertex(i);
+    }
+
+    for(int i = 0; i < 3; i++) {
+        directed.insertEdge(i, i+1, 1.0 + i);
+        undirected.insertEdge(i, i+1, 1.0 + i);
+    }
+
+    directed.insertEdge(0, 4, std::numeric_limits<double>::infinity());
+    undirected.insertEdge(0, 4, std::numeric_limits<double>::infinity());
+    undirected.insertEdge(1, 3, std::numeric_limits<double>::infinity());
+
+    csrGraph<int> frozen_directed(directed), frozen_undirected(undirected);
+
+    checkDeltaStepping(directed, 0);
+    checkDeltaStepping(undirected, 0);
+    checkDeltaStepping(frozen_directed, 0);
+    checkDeltaStepping(frozen_undirected, 0);
+
+    // a graph with nothing but infinite edges
+    uGraph<int> dense;
+    for(int i = 0; i < 5; i++)
+        dense.insertVertex(i);
+    dense.makeGraphDense(nullptr);
+    checkDeltaStepping(dense, 2);
+}
+
+TEST(CSRAlgorithmTest, batched_shortest_paths) {
+
+    srand(18);
+
+    uGraph<int> graph;
+    makeRandomGraph(graph, 1000, 3000);
+    graph.insertVertex(-5);
+
+    csrGraph<int> frozen(graph);
+
+    std::vector<std::pair<int, int> > queries;
+    for(int k = 0; k < 200; k++)
+        queries.push_back(std::make_pair(rand()%20, k%50 == 0 ? -5 : rand()%1000));
+
+    ShortestPathBatch expected, actual;
+    ASSERT_EQ(true, graph.shortestPaths(queries, expected, 1));
+    ASSERT_EQ(true, frozen.shortestPaths(queries, actual, 4));
+
+    for(unsigned int q = 0; q < queries.size(); q++) {
+
+        auto tree = graph.dijkstrasMinimumTree(queries[q].first);
+        double dist = tree->second.at(queries[q].second);
+        delete(tree);
+
+        if(dist == std::numeric_limits<double>::infinity()) {
+            ASSERT_EQ(dist, expected.distance[q]);
+            ASSERT_EQ(dist, actual.distance[q]);
+            ASSERT_EQ(actual.path_offsets[q], actual.path_offsets[q+1]);
+            continue;
+        }
+
+        ASSERT_NEAR(dist, expected.distance[q], 1e-9);
+        ASSERT_NEAR(dist, actual.distance[q], 1e-9);
+        ASSERT_EQ(queries[q].second, frozen.getVertexData(actual.path[actual.path_offsets[q+1]-1]));
+    }
+
+    std::vector<int> sources = {0, 7, -5};
+    ShortestPathTrees trees;
+    ASSERT_EQ(true, frozen.shortestPathTrees(sources, trees));
+    ASSERT_EQ(3*trees.num_vertices, trees.dist.size());
+    ASSERT_EQ(0.0, trees.dist[frozen.getVertexId(0)]);
+    ASSERT_EQ(std::numeric_limits<double>::infinity(), trees.dist[frozen.getVertexId(-5)]);
+    ASSERT_EQ(0.0, trees.dist[2*trees.num_vertices + frozen.getVertexId(-5)]);
+
+    sources.push_back(12345);
+    ASSERT_FALSE(frozen.shortestPathTrees(sources, trees));
+}
+
+// @func - checkWorkspaceReuse
+// @info - Runs every kind of search from a few roots through one shared workspace and checks that each answer matches the
+//         one a search with a workspace of its own gives, so nothing is left over from the search before it
+template<class GraphType>
+void checkWorkspaceReuse(GraphType & graph, SearchWorkspace<int> & workspace) {
+
+    for(int k = 0; k < 4; k++) {
+
+        int root = rand()%1000;
+
+        LevelTraveler expected, actual;
+        ASSERT_EQ(true, graph.breadthFirst(root, &expected));
+        ASSERT_EQ(true, graph.breadthFirst(root, &actual, workspace));
+        ASSERT_EQ(expected.depth, actual.depth);
+
+        for(auto & entry : expected.depth)
+            ASSERT_EQ(entry.second, workspace.getDistance(graph.getVertexId(entry.first)));
+
+        LevelTraveler fresh_dfs, reused_dfs;
+        ASSERT_EQ(true, graph.depthFirst(root, &fresh_dfs));
+        ASSERT_EQ(true, graph.depthFirst(root, &reused_dfs, workspace));
+        ASSERT_EQ(fresh_dfs.depth, reused_dfs.depth);
+
+        auto tree = graph.dijkstrasMinimumTree(root);
+        graph.dijkstrasMinimumTree(root, workspace);
+
+        for(auto & entry : tree->second) {
+            unsigned int id = graph.getVertexId(entry.first);
+            ASSERT_EQ(entry.second, workspace.getDistance(id));
+            ASSERT_EQ(tree->first.count(entry.first) ? graph.getVertexId(tree->first.at(entry.first)) : -1, workspace.getPrevious(id));
+        }
+
+        delete(tree);
+
+        int dest = rand()%1000;
+        LevelTraveler fresh_path, reused_path;
+        ASSERT_EQ(graph.dijkstrasShortestPath(root, dest, &fresh_path), graph.dijkstrasShortestPath(root, dest, &reused_path, workspace));
+        ASSERT_EQ(fresh_path.depth, reused_path.depth);
+    }
+
+    ASSERT_EQ(false, graph.breadthFirst(-1, nullptr, workspace));
+    ASSERT_THROW(graph.dijkstrasMinimumTree(-1, workspace), std::logic_error);
+}
+
+TEST(CSRAlgorithmTest, reused_search_workspace) {
+
+    srand(19);
+
+    dGraph<int> directed;
+    makeRandomGraph(directed, 1000, 2000);
+
+    uGraph<int> undirected;
+    makeRandomGraph(undirected, 1000, 4000);
+
+    csrGraph<int> frozen_directed(directed), frozen_undirected(undirected);
+
+    // start the workspace off too small so it has to grow, then keep handing it from graph to graph
+    SearchWorkspace<int> workspace(10);
+
+    checkWorkspaceReuse(directed, workspace);
+    checkWorkspaceReuse(frozen_undirected, workspace);
+    checkWorkspaceReuse(undirected, workspace);
+    checkWorkspaceReuse(frozen_directed, workspace);
+}
+
+// @struct - DepthVisitor
+// @info   - Keeps the same depths as LevelTraveler without deriving from GraphTraveler, and counts the edges it examined
+struct DepthVisitor
+{
+    DepthVisitor() : examined(0), finished(false) {}
+    void starting_vertex(const int & root) { depth[root] = 0; }
+    void examine_edge(const Edge<int> &) { examined++; }
+    void traverse_edge(const Edge<int> & edge) { depth[edge.getTarget()->getData()] = depth.at(edge.getSource()->getData()) + 1; }
+    void finished_traversal() { finished = true; }
+    std::unordered_map<int, int> depth;
+    int examined;
+    bool finished;
+};
+
+// @class - ExamineTraveler
+// @info  - A LevelTraveler that also counts the edges it examined
+class ExamineTraveler : public LevelTraveler
+{
+public:
+    ExamineTraveler() : examined(0) {}
+    void examine_edge(const Edge<int> &) { examined++; }
+    int examined;
+};
+
+// @func - checkStaticVisitors
+// @info - Runs every search with a plain visitor, a lambda and no callbacks at all, and checks each against the same search
+//         run with a GraphTraveler
+template<class GraphType>
+void checkStaticVisitors(GraphType & graph) {
+
+    static_assert(!HasExamineEdge<TreeEdgeVisitor<void (*)(const Edge<int> &)>, Edge<int> >::value, "a lambda visitor has one callback");
+    static_assert(HasTraverseEdge<TravelerAdapter<int>, Edge<int> >::value, "the adapter has every callback");
+    static_assert(!IsVisitor<LevelTraveler *>::value && !IsVisitor<std::nullptr_t>::value, "pointers go to the traveler versions");
+
+    SearchWorkspace<int> workspace;
+
+    for(int k = 0; k < 4; k++) {
+
+        int root = rand()%1000;
+
+        ExamineTraveler traveler;
+        DepthVisitor visitor;
+        ASSERT_EQ(true, graph.breadthFirst(root, &traveler));
+        ASSERT_EQ(true, graph.breadthFirst(root, visitor));
+        ASSERT_EQ(traveler.depth, visitor.depth);
+        ASSERT_EQ(traveler.examined, visitor.examined);
+        ASSERT_EQ(true, visitor.finished);
+
+        // a lambda only sees the tree edges, and a search without callbacks still leaves its answer in the workspace
+        std::unordered_map<int, int> depth;
+        depth[root] = 0;
+        ASSERT_EQ(true, graph.breadthFirst(root, onTreeEdge([&depth](const Edge<int> & edge) {
+            depth[edge.getTarget()->getData()] = depth.at(edge.getSource()->getData()) + 1;
+        })));
+        ASSERT_EQ(traveler.depth, depth);
+
+        ASSERT_EQ(true, graph.breadthFirst(root, NullVisitor(), workspace));
+        for(auto & entry : traveler.depth)
+            ASSERT_EQ(entry.second, workspace.getDistance(graph.getVertexId(entry.first)));
+
+        ExamineTraveler dfs_traveler;
+        int examined = 0;
+        ASSERT_EQ(true, graph.depthFirst(root, &dfs_traveler));
+        ASSERT_EQ(true, graph.depthFirst(root, onExamineEdge([&examined](const Edge<int> &) { examined++; }), workspace));
+        ASSERT_EQ(dfs_traveler.examined, examined);
+
+        int dest = rand()%1000;
+        LevelTraveler path_traveler;
+        double length = 0;
+        bool found = graph.dijkstrasShortestPath(root, dest, &path_traveler);
+        ASSERT_EQ(found, graph.dijkstrasShortestPath(root, dest, onTreeEdge([&length](const Edge<int> & edge) {
+            length += edge.getWeight();
+        }), workspace));
+
+        if(found) {
+            ASSERT_NEAR(workspace.getDistance(graph.getVertexId(dest)), length, 1e-6);
+        }
+    }
+
+    ASSERT_EQ(false, graph.depthFirst(-1, NullVisitor()));
+}
+
+TEST(CSRAlgorithmTest, static_visitors) {
+
+    srand(20);
+
+    dGraph<int> directed;
+    makeRandomGraph(directed, 1000, 2000);
+
+    uGraph<int> undirected;
+    makeRandomGraph(undirected, 1000, 4000);
+
+    csrGraph<int> frozen_directed(directed), frozen_undirected(undirected);
+
+    checkStaticVisitors(directed);
+    checkStaticVisitors(undirected);
+    checkStaticVisitors(frozen_directed);
+    checkStaticVisitors(frozen_undirected);
+}
+
+// @class - TreeEdgeCounter
+// @info  - Counts the tree edges of a search through the virtual GraphTraveler callbacks
+class TreeEdgeCounter : public GraphTraveler<int>
+{
+public:
+    TreeEdgeCounter() : count(0) {}
+    void discover_vertex(const int &) {}
+    void examine_edge(const Edge<int> &) {}
+    void traverse_edge(const Edge<int> &) { count++; }
+    void starting_vertex(const int &) {}
+    void finished_traversal() {}
+    int count;
+};
+
+TEST(CSRSpeedTests, static_visitor_compare) {
+
+    dGraph<int> graph;
+    makeRandomGraph(graph, 20000, 200000);
+
+    csrGraph<int> frozen(graph);
+
+    TreeEdgeCounter traveler;
+    auto start = std::chrono::high_resolution_clock::now();
+    frozen.breadthFirst(0, &traveler);
+    auto elapsed = std::chrono::high_resolution_clock::now() - start;
+    long long virtual_time = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+    int count = 0;
+    start = std::chrono::high_resolution_clock::now();
+    frozen.breadthFirst(0, onTreeEdge([&count](const Edge<int> &) { count++; }));
+    elapsed = std::chrono::high_resolution_clock::now() - start;
+    long long static_time = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+    ASSERT_EQ(traveler.count, count);
+
+    std::cout << "[   INFO   ] BFS GraphTraveler : " << virtual_time << "us  --  tree edge lambda : " << static_time << "us\n";
+}
+
+TEST(CSRSpeedTests, delta_stepping_compare) {
+
+    uGraph<int> graph;
+    int num_vertices = 50000;
+    makeRandomGraph(graph, num_vertices, 400000);
+
+    csrGraph<int> frozen(graph);
+    std::vector<double> dist;
+    std::vector<int> prev;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    delete(frozen.dijkstrasMinimumTree(0));
+    auto elapsed = std::chrono::high_resolution_clock::now() - start;
+    long long dijkstra_time = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    frozen.deltaStepping(0, dist, prev);
+    elapsed = std::chrono::high_resolution_clock::now() - start;
+    long long delta_time = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+    std::cout << "[   INFO   ] SSSP Dijkstra : " << dijkstra_time << "us  --  delta-stepping, " << std::thread::hardware_concurrency() << " threads : " << delta_time << "us\n";
+}
@@ -0,0 +1,146 @@
+#include "../../../CompressedGraph/csrGraph.h"
+#include "../../../DirectedGraph/dGraph.h"
+#include "../../../UndirectedGraph/uGraph.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <chrono>
+
+
+//////////////////////////////////////
+////////    Build Testing     ////////
+
+// - These tests involve freezing other graphs and inserting/deleting vertices and edges in our compressed graph.
+TEST(CSRBuildTest, empty_graph) {
+    csrGraph<int> graph;
+
+    ASSERT_EQ(0, graph.getNumVertices());
+    ASSERT_EQ(0, graph.getNumEdges());
+    ASSERT_EQ(true, graph.isDirected());
+}
+
+TEST(CSRBuildTest, freeze_directed) {
+    dGraph<int> graph;
+
+    for(int i = 1; i <= 6; i++)
+        graph.insertVertex(i);
+
+    graph.insertEdge(1, 2, 1.5);
+    graph.insertEdge(1, 3, 2.5);
+    graph.insertEdge(2, 3, 3.5);
+    graph.insertEdge(3, 4, 4.5);
+    graph.insertEdge(4, 1, 5.5);
+    graph.insertEdge(6, 2, 6.5);
+
+    csrGraph<int> frozen(graph);
+
+    ASSERT_EQ(true, frozen.isDirected());
+    ASSERT_EQ(graph.getNumVertices(), frozen.getNumVertices());
+    ASSERT_EQ(graph.getNumEdges(), frozen.getNumEdges());
+
+    ASSERT_EQ(true, frozen.containsEdge(1, 2));
+    ASSERT_FALSE(frozen.containsEdge(2, 1));
+    ASSERT_FALSE(frozen.containsEdge(5, 1));
+    ASSERT_EQ(4.5, frozen.getEdgeWeight(3, 4));
+    ASSERT_EQ(6.5, frozen.getEdgeWeight(6, 2));
+    ASSERT_EQ(2, frozen.getIncidentEdges(1).size());
+    ASSERT_EQ(0, frozen.getIncidentEdges(5).size());
+    ASSERT_THROW(frozen.getEdgeWeight(2, 1), std::logic_error);
+}
+
+TEST(CSRBuildTest, freeze_undirected) {
+    uGraph<int> graph;
+
+    for(int i = 1; i <= 6; i++)
+        graph.insertVertex(i);
+
+    graph.insertEdge(1, 2, 1.5);
+    graph.insertEdge(1, 3, 2.5);
+    graph.insertEdge(2, 3, 3.5);
+    graph.insertEdge(3, 4, 4.5);
+    graph.insertEdge(6, 2, 6.5);
+
+    csrGraph<int> frozen(graph);
+
+    ASSERT_FALSE(frozen.isDirected());
+    ASSERT_EQ(6, frozen.getNumVertices());
+    ASSERT_EQ(graph.getNumEdges(), frozen.getNumEdges());
+    ASSERT_EQ(true, frozen.containsEdge(2, 1));
+    ASSERT_EQ(true, frozen.containsEdge(2, 6));
+    ASSERT_EQ(3, frozen.getIncidentEdges(2).size());
+
+    ASSERT_EQ(true, frozen.setEdgeWeight(4, 3, 9.0));
+    ASSERT_EQ(9.0, frozen.getEdgeWeight(3, 4));
+}
+
+TEST(CSRBuildTest, insert_delete_edges) {
+    csrGraph<int> graph;
+
+    for(int i = 1; i <= 6; i++)
+        graph.insertVertex(i);
+
+    ASSERT_EQ(true, graph.insertEdge(1, 2));
+    ASSERT_EQ(true, graph.insertEdge(1, 3));
+    ASSERT_EQ(true, graph.insertEdge(4, 1));
+    ASSERT_EQ(true, graph.insertEdge(6, 2));
+    ASSERT_FALSE(graph.insertEdge(1, 2)); // duplicate
+    ASSERT_FALSE(graph.insertEdge(1, 1)); // self loop
+    ASSERT_FALSE(graph.insertEdge(1, 7)); // no vertex
+
+    ASSERT_EQ(4, graph.getNumEdges());
+
+    ASSERT_EQ(true, graph.deleteEdge(1, 3));
+    ASSERT_FALSE(graph.deleteEdge(1, 3));
+    ASSERT_FALSE(graph.containsEdge(1, 3));
+    ASSERT_EQ(true, graph.containsEdge(6, 2));
+    ASSERT_EQ(3, graph.getNumEdges());
+}
+
+TEST(CSRBuildTest, vertex_and_edge_deletion) {
+    dGraph<int> source;
+    int numVertices = 200;
+
+    for(int i = 0; i < numVertices; i++)
+        source.insertVertex(i);
+
+    for(int i = 0; i < numVertices; i++) {
+        source.insertEdge(i, (i+1)%numVertices, i);
+        source.insertEdge(i, (i+7)%numVertices, i);
+    }
+
+    csrGraph<int> graph(source);
+
+    ASSERT_EQ(2*numVertices, graph.getNumEdges());
+
+    // vertex 50 has two edges out and two edges in
+    ASSERT_EQ(true, graph.deleteVertex(50));
+    ASSERT_FALSE(graph.containsVertex(50));
+    ASSERT_EQ(numVertices-1, graph.getNumVertices());
+    ASSERT_EQ(2*numVertices-4, graph.getNumEdges());
+
+    // ids above 50 were shifted, make sure lookups still line up with the right edges
+    ASSERT_EQ(true, graph.containsEdge(51, 52));
+    ASSERT_EQ(true, graph.containsEdge(199, 0));
+    ASSERT_EQ(60.0, graph.getEdgeWeight(60, 67));
+    ASSERT_FALSE(graph.containsEdge(49, 50));
+}
+
+TEST(CSRBuildTest, dense_and_invert) {
+    csrGraph<int> graph(false);
+    int numVertices = 50;
+
+    for(int i = 0; i < numVertices; i++)
+        graph.insertVertex(i);
+
+    graph.makeGraphDense();
+    ASSERT_EQ(numVertices*(numVertices-1)/2, graph.getNumEdges());
+
+    graph.invert();
+    ASSERT_EQ(0, graph.getNumEdges());
+
+    csrGraph<int> directed;
+    for(int i = 0; i < numVertices; i++)
+        directed.insertVertex(i);
+
+    directed.makeGraphDense();
+    ASSERT_EQ(numVertices*(numVertices-1), directed.getNumEdges());
+}
@@ -0,0 +1,25 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - csrGraphTestInt.cpp
+*   @Data     - 10/18/2026
+*   @Purpose  - This file contains all of the main tests for the compressed sparse row graph class. The testing framework is provided by
+*               Google via their Google Test suite for C++. Most of these tests build a dGraph or uGraph, freeze it into a csrGraph, and
+*               then check that both graphs give the same answers. The different sections of csrGraph that will be tested are as follows :
+*               1.) Build Testing     - Tests freezing other graphs, and the insertion, deletion, and lookup of vertices and edges.
+*               2.) Algorithm Testing - Tests the traversal and path-finding algorithms against the adjacency list graphs.
+**/
+
+
+#include "../../../CompressedGraph/csrGraph.h"
+#include "csrGraphBuildTesting.h"
+#include "csrGraphAlgorithmTesting.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <chrono>
+
+
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -165,3 +165,277 @@ TEST(Dijkstras, large_test_union_4) {
 
     analyzeGraphDijkstras(&graph, num_vertices, iterations);
 }
+
+
+TEST(Dijkstras, equal_weight_ring) {
+
+    // all of the edges share the same weight, which used to confuse the std::set based priority queue
+    int num_vertices = 2000;
+
+    dGraph<int> graph;
+
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertEdge(i, (i+1)%num_vertices, 1.0);
+
+    auto tree = graph.dijkstrasMinimumTree(0);
+
+    for(int i = 0; i < num_vertices; i++)
+        ASSERT_EQ((double) i, tree->second.at(i));
+
+    delete(tree);
+
+    for(int i = 1; i < num_vertices; i += 97) {
+        dTraveler<int> trav;
+        ASSERT_EQ(true, graph.dijkstrasShortestPath(0, i, &trav));
+        ASSERT_EQ(i, trav.graph.getNumEdges());
+    }
+}
+
+
+// @func - gridDistance
+// @info - Manhattan distance between two cells of the 100 wide grid used by the A* tests, never overestimates a unit grid
+double gridDistance(int & one, int & two) {
+    return std::abs(one/100 - two/100) + std::abs(one%100 - two%100);
+}
+
+TEST(AStar, grid_matches_dijkstras) {
+
+    // a 100x100 grid with unit weight edges between neighboring cells
+    int width = 100;
+    dGraph<int> graph;
+
+    for(int i = 0; i < width*width; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < width*width; i++) {
+        if(i%width != width-1) { graph.insertEdge(i, i+1, 1.0); graph.insertEdge(i+1, i, 1.0); }
+        if(i/width != width-1) { graph.insertEdge(i, i+width, 1.0); graph.insertEdge(i+width, i, 1.0); }
+    }
+
+    auto tree = graph.dijkstrasMinimumTree(0);
+
+    for(int goal = 1; goal < width*width; goal += 613) {
+
+        unsigned int expanded = 0;
+        auto path = graph.aStar(0, std::vector<int>{goal}, gridDistance, &expanded);
+
+        ASSERT_EQ(tree->second.at(goal), (double) path.size());
+        ASSERT_EQ(goal, path.back());
+
+        // every step of the path has to be a real edge
+        for(unsigned int i = 1; i < path.size(); i++)
+            ASSERT_EQ(true, graph.containsEdge(path[i-1], path[i]));
+
+        // the heuristic is exact on an open grid, so we should only expand the cells in the box between the two corners
+        ASSERT_LE(expanded, (unsigned int) (goal/width+1)*(goal%width+1));
+    }
+
+    delete(tree);
+
+    // the function pointer version with no heuristic is plain Dijkstra's
+    ASSERT_EQ(198u, graph.aStar(0, {width*width-1}, nullptr).size());
+    ASSERT_EQ(198u, graph.aStar(0, {width*width-1}, gridDistance).size());
+}
+
+TEST(AStar, multiple_goals_and_callables) {
+
+    int num_vertices = 1000;
+    dGraph<int> graph;
+
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < num_vertices-1; i++)
+        graph.insertEdge(i, i+1, 1.0);
+
+    // the closest goal wins, no matter what order the goals are given in
+    int scale = 0;
+    auto zero = [&scale](int &, int &) { return 0.0*scale; };
+    std::vector<int> goals = {900, 5, 40};
+    unsigned int expanded = 0;
+
+    auto path = graph.aStar(0, goals, zero, &expanded);
+
+    ASSERT_EQ(5u, path.size());
+    ASSERT_EQ(5, path.back());
+    ASSERT_EQ(6u, expanded);
+
+    // already there, no path, and missing vertices all give back an empty path
+    ASSERT_EQ(0u, graph.aStar(5, goals, zero).size());
+    ASSERT_EQ(0u, graph.aStar(0, std::vector<int>{-1, 5000}, zero).size());
+    ASSERT_EQ(0u, graph.aStar(-1, goals, zero).size());
+
+    graph.insertVertex(num_vertices);
+    ASSERT_EQ(0u, graph.aStar(0, std::vector<int>{num_vertices}, zero, &expanded).size());
+    ASSERT_EQ((unsigned int) num_vertices, expanded);
+}
+
+
+// @class - PathWeightTraveler
+// @info  - Adds up the weights of the edges a path-finding function traverses and checks that they line up end to end
+class PathWeightTraveler : public GraphTraveler<int>
+{
+public:
+    PathWeightTraveler() : weight(0), last(-1), connected(true) {}
+    void discover_vertex(const int &) {}
+    void examine_edge(const Edge<int> &) {}
+    void starting_vertex(const int & v) { last = v; }
+    void finished_traversal() {}
+    void traverse_edge(const Edge<int> & edge) {
+        connected = connected && edge.getSource()->getData() == last;
+        last = edge.getTarget()->getData();
+        weight += edge.getWeight();
+    }
+    double weight;
+    int last;
+    bool connected;
+};
+
+TEST(Dijkstras, bidirectional_matches_dijkstras) {
+
+    int num_vertices = 3000;
+    dGraph<int> graph;
+
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < 4*num_vertices; i++)
+        graph.insertEdge(rand()%num_vertices, rand()%num_vertices, (rand()%1000+1)/10.0);
+
+    for(int k = 0; k < 20; k++) {
+
+        // deleted vertices get reinserted with random values, so make sure we pick one that's there
+        int src = rand()%num_vertices;
+        while(!graph.containsVertex(src))
+            src = rand()%num_vertices;
+
+        auto tree = graph.dijkstrasMinimumTree(src);
+
+        for(int j = 0; j < 25; j++) {
+
+            int dest = rand()%num_vertices;
+            while(!graph.containsVertex(dest))
+                dest = rand()%num_vertices;
+
+            PathWeightTraveler trav;
+            bool found = graph.bidirectionalShortestPath(src, dest, &trav);
+
+            ASSERT_EQ(tree->second.at(dest) != std::numeric_limits<double>::infinity(), found);
+
+            if(found) {
+                ASSERT_NEAR(tree->second.at(dest), trav.weight, 1e-9);
+                ASSERT_EQ(true, trav.connected);
+                ASSERT_EQ(dest, trav.last);
+            }
+        }
+
+        delete(tree);
+
+        // change the graph between rounds so that any cached state has to be rebuilt, halfway through drop the in-edge
+        // index so the backward search has to go through the packed reverse view instead
+        if(k == 10)
+            graph.setInEdgeIndex(false);
+
+        graph.insertEdge(rand()%num_vertices, rand()%num_vertices, 0.5);
+        graph.setEdgeWeight(src, rand()%num_vertices, 1.0);
+        graph.deleteVertex(rand()%num_vertices);
+        graph.insertVertex(rand()%num_vertices);
+    }
+
+    ASSERT_THROW(graph.bidirectionalShortestPath(-1, 0), std::logic_error);
+}
+
+TEST(Dijkstras, batched_queries) {
+
+    int num_vertices = 2000;
+    dGraph<int> graph;
+
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < 3*num_vertices; i++)
+        graph.insertEdge(rand()%num_vertices, rand()%num_vertices, (rand()%1000+1)/10.0);
+
+    // a handful of sources, each asked about many destinations, including itself
+    std::vector<int> sources;
+    std::vector<std::pair<int, int> > queries;
+
+    for(int k = 0; k < 8; k++) {
+        sources.push_back(rand()%num_vertices);
+        queries.push_back(std::make_pair(sources.back(), sources.back()));
+        for(int j = 0; j < 40; j++)
+            queries.push_back(std::make_pair(sources.back(), rand()%num_vertices));
+    }
+
+    std::random_shuffle(queries.begin(), queries.end());
+
+    for(unsigned int threads : {1u, 3u, 0u}) {
+
+        ShortestPathBatch batch;
+        ShortestPathTrees trees;
+
+        ASSERT_EQ(true, graph.shortestPaths(queries, batch, threads));
+        ASSERT_EQ(true, graph.shortestPathTrees(sources, trees, threads));
+        ASSERT_EQ(queries.size(), batch.distance.size());
+        ASSERT_EQ(queries.size()+1, batch.path_offsets.size());
+
+        for(unsigned int s = 0; s < sources.size(); s++) {
+
+            auto tree = graph.dijkstrasMinimumTree(sources[s]);
+
+            const double * dist = &trees.dist[s*trees.num_vertices];
+            const int * prev = &trees.prev[s*trees.num_vertices];
+
+            for(int v = 0; v < num_vertices; v++) {
+
+                int id = graph.getVertexId(v);
+
+                if(tree->second.at(v) == std::numeric_limits<double>::infinity())
+                    ASSERT_EQ(tree->second.at(v), dist[id]);
+                else
+                    ASSERT_NEAR(tree->second.at(v), dist[id], 1e-9);
+
+                // ties can be broken either way, but the predecessor has to be the end of a shortest path
+                if(v == sources[s] || dist[id] == std::numeric_limits<double>::infinity())
+                    ASSERT_EQ(-1, prev[id]);
+                else
+                    ASSERT_NEAR(dist[id], dist[prev[id]] + graph.getEdgeWeight(graph.getVertexData(prev[id]), v), 1e-9);
+            }
+
+            for(unsigned int q = 0; q < queries.size(); q++) {
+
+                if(queries[q].first != sources[s])
+                    continue;
+
+                unsigned int first = batch.path_offsets[q], last = batch.path_offsets[q+1];
+
+                if(tree->second.at(queries[q].second) == std::numeric_limits<double>::infinity()) {
+                    ASSERT_EQ(std::numeric_limits<double>::infinity(), batch.distance[q]);
+                    ASSERT_EQ(first, last);
+                    continue;
+                }
+
+                ASSERT_NEAR(tree->second.at(queries[q].second), batch.distance[q], 1e-9);
+
+                // the path has to start and end in the right places and its edges have to add up to the distance
+                ASSERT_EQ(queries[q].first, graph.getVertexData(batch.path[first]));
+                ASSERT_EQ(queries[q].second, graph.getVertexData(batch.path[last-1]));
+
+                double weight = 0;
+                for(unsigned int i = first+1; i < last; i++)
+                    weight += graph.getEdgeWeight(graph.getVertexData(batch.path[i-1]), graph.getVertexData(batch.path[i]));
+
+                ASSERT_NEAR(batch.distance[q], weight, 1e-9);
+            }
+
+            delete(tree);
+        }
+    }
+
+    ShortestPathBatch batch;
+    queries.push_back(std::make_pair(0, -1));
+    ASSERT_FALSE(graph.shortestPaths(queries, batch));
+}
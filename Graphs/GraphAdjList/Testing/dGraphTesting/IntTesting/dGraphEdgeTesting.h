@@ -294,4 +294,210 @@ TEST(EdgesTest, vertex_and_edge_deletion) {
     ASSERT_EQ(0, graph.getNumVertices());
     ASSERT_EQ(0, graph.getNumEdges());
 
-}
\ No newline at end of file
+}
+
+// @func - checkIncomingEdges
+// @info - Checks the incoming edges and in degree of every vertex against the edges leaving every vertex
+void checkIncomingEdges(dGraph<int> & graph) {
+
+    std::map<int, std::vector<std::pair<int, double> > > expected;
+    for(auto & edge : graph.getAllEdges())
+        expected[edge.getTarget()->getData()].push_back(std::make_pair(edge.getSource()->getData(), edge.getWeight()));
+
+    for(auto vertex : graph.getAllVertices()) {
+
+        std::vector<std::pair<int, double> > incoming;
+        for(auto & edge : graph.getIncomingEdges(vertex)) {
+            ASSERT_EQ(vertex, edge.getTarget()->getData());
+            incoming.push_back(std::make_pair(edge.getSource()->getData(), edge.getWeight()));
+        }
+
+        std::sort(incoming.begin(), incoming.end());
+        std::sort(expected[vertex].begin(), expected[vertex].end());
+        ASSERT_EQ(expected[vertex], incoming);
+        ASSERT_EQ(incoming.size(), graph.inDegree(vertex));
+    }
+}
+
+TEST(EdgesTest, incoming_edges) {
+    srand(22);
+    dGraph<int> graph;
+
+    for(int i = 0; i < 300; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < 1500; i++)
+        graph.insertEdge(rand()%300, rand()%300, rand()%100+1);
+
+    ASSERT_EQ(true, graph.hasInEdgeIndex());
+    checkIncomingEdges(graph);
+
+    // the graph has to answer the same way without the index, and keep working while edges and vertices change
+    ASSERT_EQ(true, graph.setInEdgeIndex(false));
+    ASSERT_EQ(false, graph.hasInEdgeIndex());
+    checkIncomingEdges(graph);
+
+    for(int i = 0; i < 30; i++) {
+        graph.deleteVertex(rand()%300);
+        graph.insertEdge(rand()%300, rand()%300, 5);
+        graph.deleteEdge(rand()%300, rand()%300);
+    }
+
+    checkIncomingEdges(graph);
+
+    // turning it back on has to pick up everything that changed while it was off
+    ASSERT_EQ(true, graph.setInEdgeIndex(true));
+    checkIncomingEdges(graph);
+
+    for(int i = 0; i < 30; i++) {
+        graph.deleteVertex(rand()%300);
+        graph.insertVertex(rand()%300);
+        graph.insertEdge(rand()%300, rand()%300, 7);
+        graph.deleteEdge(rand()%300, rand()%300);
+    }
+
+    checkIncomingEdges(graph);
+
+    // the copy and the graph it was copied from keep separate indexes
+    dGraph<int> copy(graph);
+    ASSERT_EQ(true, copy.hasInEdgeIndex());
+    copy.deleteVertex(copy.getVertexData(0));
+    checkIncomingEdges(copy);
+    checkIncomingEdges(graph);
+
+    ASSERT_THROW(graph.getIncomingEdges(-1), std::logic_error);
+    ASSERT_THROW(graph.inDegree(-1), std::logic_error);
+}
+
+// @func - checkNeighborViews
+// @info - Checks the views of the graph against the copies handed out by getAllVertices and getIncidentEdges
+void checkNeighborViews(dGraph<int> & graph) {
+
+    auto vertices = graph.getAllVertices();
+    VertexView<int> view = graph.getVertices();
+    ASSERT_EQ(vertices.size(), view.size());
+    ASSERT_EQ(vertices.empty(), view.empty());
+
+    unsigned int i = 0;
+    for(auto vertex = view.begin(); vertex != view.end(); ++vertex, ++i) {
+        ASSERT_EQ(vertices[i], *vertex);
+        ASSERT_EQ(vertices[i], view[i]);
+        ASSERT_EQ(i, vertex.id());
+
+        auto edges = graph.getIncidentEdges(*vertex);
+        NeighborView<int> neighbors = graph.getNeighbors(*vertex);
+        ASSERT_EQ(edges.size(), neighbors.size());
+        ASSERT_EQ(edges.empty(), neighbors.empty());
+        ASSERT_EQ(neighbors.size(), vertex.neighbors().size());
+        ASSERT_EQ(neighbors.size(), view.neighbors(i).size());
+
+        unsigned int j = 0;
+        for(auto edge = neighbors.begin(); edge != neighbors.end(); ++edge, ++j) {
+            ASSERT_EQ(*vertex, edge->getSource()->getData());
+            ASSERT_EQ(edges[j].getTarget()->getData(), edge.target());
+            ASSERT_EQ(graph.getVertexId(edge.target()), edge.targetId());
+            ASSERT_EQ(edges[j].getWeight(), edge.weight());
+            ASSERT_EQ(edges[j].getWeight(), (*edge).getWeight());
+        }
+    }
+}
+
+TEST(EdgesTest, neighbor_views) {
+    // its own generator, so the tests after this one see the same rand() sequence they always have
+    std::mt19937 gen(23);
+    dGraph<int> graph;
+
+    checkNeighborViews(graph);
+    ASSERT_THROW(graph.getNeighbors(1), std::logic_error);
+
+    for(int i = 0; i < 200; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < 1000; i++)
+        graph.insertEdge(gen()%200, gen()%200, gen()%100+1);
+
+    checkNeighborViews(graph);
+
+    // a view sees weight changes made after it was taken
+    int source = graph.getAllEdges()[0].getSource()->getData();
+    NeighborView<int> neighbors = graph.getNeighbors(source);
+    graph.setEdgeWeight(source, neighbors.begin().target(), 1000);
+    ASSERT_EQ(1000, neighbors.begin().weight());
+
+    for(int i = 0; i < 20; i++) {
+        graph.deleteVertex(gen()%200);
+        graph.deleteEdge(gen()%200, gen()%200);
+    }
+
+    checkNeighborViews(graph);
+
+    // the copies are built from the views, they have to come out identical to the original
+    dGraph<int> copy(graph);
+    ASSERT_EQ(true, copy == graph);
+    checkNeighborViews(copy);
+
+    dGraph<int> assigned;
+    assigned.insertVertex(-5);
+    assigned = graph;
+    ASSERT_EQ(true, assigned == graph);
+    ASSERT_EQ(graph.getNumEdges(), assigned.getNumEdges());
+
+    copy.setEdgeWeight(source, copy.getNeighbors(source).begin().target(), 1);
+    ASSERT_EQ(false, copy == graph);
+
+    ASSERT_THROW(graph.getNeighbors(-1), std::logic_error);
+}
+
+TEST(EdgesTest, edge_slots) {
+    std::mt19937 gen(24);
+    dGraph<int> graph;
+    std::map<std::pair<int, int>, double> expected;
+
+    for(int i = 0; i < 50; i++)
+        graph.insertVertex(i);
+
+    // deletes move the last edge of a list into the freed slot, so mix them with inserts and weight changes and check
+    // that every edge can still be found with the right weight
+    for(int i = 0; i < 20000; i++) {
+        int source = gen()%50, target = gen()%50;
+        auto key = std::make_pair(source, target);
+
+        switch(gen()%3) {
+            case 0 :
+                if(graph.insertEdge(source, target, i))
+                    expected[key] = i;
+                break;
+            case 1 :
+                ASSERT_EQ(expected.erase(key) == 1, graph.deleteEdge(source, target));
+                break;
+            default :
+                ASSERT_EQ(expected.count(key) == 1, graph.setEdgeWeight(source, target, -i));
+                if(expected.count(key))
+                    expected[key] = -i;
+        }
+    }
+
+    ASSERT_EQ(expected.size(), graph.getNumEdges());
+
+    for(int source = 0; source < 50; source++) {
+        unsigned int degree = 0;
+
+        for(int target = 0; target < 50; target++) {
+            auto get = expected.find(std::make_pair(source, target));
+            ASSERT_EQ(get != expected.end(), graph.containsEdge(source, target));
+
+            if(get != expected.end()) {
+                ASSERT_EQ(get->second, graph.getEdgeWeight(source, target));
+                degree++;
+            }
+        }
+
+        NeighborView<int> neighbors = graph.getNeighbors(source);
+        ASSERT_EQ(degree, neighbors.size());
+
+        for(auto edge = neighbors.begin(); edge != neighbors.end(); ++edge)
+            ASSERT_EQ(expected.at(std::make_pair(source, edge.target())), edge.weight());
+    }
+
+    checkIncomingEdges(graph);
+}
@@ -169,4 +169,103 @@ TEST(MinTreeTests, non_connected_error) {
 
     ASSERT_FALSE(graph.minimumSpanningTree());
 
-}
\ No newline at end of file
+}
+
+
+// @class - TreeWeightTraveler
+// @info  - Counts the trees and adds up the edge weights of the spanning tree (or forest) it is handed
+class TreeWeightTraveler : public GraphTraveler<int>
+{
+public:
+    TreeWeightTraveler() : weight(0), edges(0), trees(0) {}
+    void discover_vertex(const int &) { trees++; }
+    void examine_edge(const Edge<int> &) {}
+    void traverse_edge(const Edge<int> & edge) { weight += edge.getWeight(); edges++; }
+    void starting_vertex(const int &) { trees++; }
+    void finished_traversal() {}
+    double weight;
+    int edges;
+    int trees;
+};
+
+TEST(MinTreeTests, algorithms_agree) {
+
+    dGraph<int> graph;
+    int num_vertices = 3000;
+
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+
+    // a ring in both directions keeps the graph connected, the rest of the edges are random
+    for(int i = 0; i < num_vertices; i++) {
+        graph.insertEdge(i, (i+1)%num_vertices, (rand()%1000+1)/10.0);
+        graph.insertEdge((i+1)%num_vertices, i, (rand()%1000+1)/10.0);
+    }
+
+    for(int i = 0; i < 5*num_vertices; i++)
+        graph.insertEdge(rand()%num_vertices, rand()%num_vertices, (rand()%1000+1)/10.0);
+
+    TreeWeightTraveler prim, kruskal, boruvka;
+
+    ASSERT_EQ(true, graph.minimumSpanningTree(&prim, SpanningTreeOptions(SpanningTreeAlgorithm::Prim)));
+    ASSERT_EQ(true, graph.minimumSpanningTree(&kruskal, SpanningTreeOptions(SpanningTreeAlgorithm::Kruskal)));
+    ASSERT_EQ(true, graph.minimumSpanningTree(&boruvka, SpanningTreeOptions(SpanningTreeAlgorithm::Boruvka)));
+
+    ASSERT_EQ(num_vertices-1, prim.edges);
+    ASSERT_EQ(num_vertices-1, kruskal.edges);
+    ASSERT_EQ(num_vertices-1, boruvka.edges);
+    ASSERT_NEAR(kruskal.weight, boruvka.weight, 1e-6);
+
+    // Prim's only follows edges forward, so it can only do as well as the trees that ignore the direction
+    ASSERT_GE(prim.weight + 1e-6, kruskal.weight);
+}
+
+TEST(MinTreeTests, spanning_forest) {
+
+    dGraph<int> graph;
+
+    // three paths of 100 vertices plus 5 vertices with no edges at all
+    for(int i = 0; i < 305; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < 300; i++) {
+        if(i%100 != 99) {
+            graph.insertEdge(i, i+1, 1.0 + i%7);
+            graph.insertEdge(i+1, i, 1.0 + i%7);
+        }
+    }
+
+    ASSERT_FALSE(graph.minimumSpanningTree(nullptr, SpanningTreeOptions(SpanningTreeAlgorithm::Kruskal)));
+
+    for(auto algorithm : {SpanningTreeAlgorithm::Prim, SpanningTreeAlgorithm::Kruskal, SpanningTreeAlgorithm::Boruvka}) {
+
+        TreeWeightTraveler trav;
+
+        ASSERT_EQ(true, graph.minimumSpanningTree(&trav, SpanningTreeOptions(algorithm, true)));
+        ASSERT_EQ(8, trav.trees);
+        ASSERT_EQ(297, trav.edges);
+    }
+
+    // an empty graph is trivially spanned
+    dGraph<int> empty;
+    ASSERT_EQ(true, empty.minimumSpanningTree(nullptr, SpanningTreeOptions(SpanningTreeAlgorithm::Boruvka, true)));
+}
+
+TEST(MinTreeTests, infinite_weights) {
+
+    // without a weight function makeGraphDense gives every edge infinite weight, the tree still has to span the graph
+    dGraph<int> graph;
+
+    for(int i = 0; i < 5; i++)
+        graph.insertVertex(i);
+
+    graph.makeGraphDense(nullptr);
+
+    for(auto algorithm : {SpanningTreeAlgorithm::Prim, SpanningTreeAlgorithm::Kruskal, SpanningTreeAlgorithm::Boruvka}) {
+        for(bool forest : {false, true}) {
+            TreeWeightTraveler trav;
+            ASSERT_EQ(true, graph.minimumSpanningTree(&trav, SpanningTreeOptions(algorithm, forest)));
+            ASSERT_EQ(4, trav.edges);
+        }
+    }
+}
@@ -101,6 +101,90 @@ TEST(Bipartition, simple_positive_test) {
 ////////////////    SPEED TESTS /////////////////
 /////////////////////////////////////////////////
 
+TEST(StrongComponents, simple_test) {
+
+    // two cycles {0,1,2} and {3,4} joined by the edge 2->3, plus the lone vertex 5 that only has an edge in
+    dGraph<int> graph;
+    for(int i = 0; i < 6; i++)
+        graph.insertVertex(i);
+
+    graph.insertEdge(0, 1);
+    graph.insertEdge(1, 2);
+    graph.insertEdge(2, 0);
+    graph.insertEdge(2, 3);
+    graph.insertEdge(3, 4);
+    graph.insertEdge(4, 3);
+    graph.insertEdge(4, 5);
+
+    std::vector<unsigned int> component;
+    ASSERT_EQ(3, graph.stronglyConnectedComponents(component));
+    ASSERT_EQ(false, graph.isConnected());
+
+    ASSERT_EQ(component[0], component[1]);
+    ASSERT_EQ(component[0], component[2]);
+    ASSERT_EQ(component[3], component[4]);
+
+    // reverse topological order, edges go from higher numbered components to lower ones
+    ASSERT_GT(component[2], component[3]);
+    ASSERT_GT(component[4], component[5]);
+
+    graph.insertEdge(5, 0);
+    ASSERT_EQ(1, graph.stronglyConnectedComponents(component));
+    ASSERT_EQ(true, graph.isConnected());
+}
+
+TEST(StrongComponents, matches_reachability) {
+
+    srand(4);
+
+    for(int trial = 0; trial < 10; trial++) {
+
+        int num_vertices = 60;
+        dGraph<int> graph;
+        for(int i = 0; i < num_vertices; i++)
+            graph.insertVertex(i);
+        for(int i = 0; i < 90; i++)
+            graph.insertEdge(rand()%num_vertices, rand()%num_vertices);
+
+        // two vertices share a component exactly when each can reach the other
+        std::vector<std::vector<bool> > reaches(num_vertices, std::vector<bool>(num_vertices, false));
+        for(int i = 0; i < num_vertices; i++) {
+            dTraveler<int> trav;
+            graph.breadthFirst(i, &trav);
+            for(int j = 0; j < num_vertices; j++)
+                reaches[i][j] = trav.graph.containsVertex(j);
+        }
+
+        std::vector<unsigned int> component;
+        unsigned int count = graph.stronglyConnectedComponents(component);
+
+        for(int i = 0; i < num_vertices; i++) {
+            ASSERT_LT(component[i], count);
+            for(int j = 0; j < num_vertices; j++)
+                ASSERT_EQ(reaches[i][j] && reaches[j][i], component[i] == component[j]);
+        }
+    }
+}
+
+TEST(StrongComponents, long_cycle) {
+
+    // a single cycle through every vertex, deep enough to overflow a recursive implementation
+    dGraph<int> graph;
+    int num_vertices = 200000;
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertEdge(i, (i+1) % num_vertices);
+
+    std::vector<unsigned int> component;
+    ASSERT_EQ(1, graph.stronglyConnectedComponents(component));
+    ASSERT_EQ(true, graph.isConnected());
+
+    graph.deleteEdge(num_vertices-1, 0);
+    ASSERT_EQ(num_vertices, graph.stronglyConnectedComponents(component));
+    ASSERT_EQ(false, graph.isConnected());
+}
+
 TEST(SpeedTests, large_bfs_dfs_test) { 
 
     dGraph<int> graph;
@@ -118,3 +118,93 @@ dGraph<int> graph;
 
 
 
+
+TEST(VerticesTest, dense_ids) {
+    dGraph<int> graph;
+
+    for(int i = 0; i < 100; i++)
+        graph.insertVertex(i*3);
+
+    // ids are handed out in insertion order
+    for(int i = 0; i < 100; i++) {
+        ASSERT_EQ(i, graph.getVertexId(i*3));
+        ASSERT_EQ(i*3, graph.getVertexData(i));
+    }
+
+    ASSERT_EQ(-1, graph.getVertexId(1));
+    ASSERT_THROW(graph.getVertexData(100), std::logic_error);
+
+    // deleting a vertex moves the last vertex into its id and leaves every other id alone
+    graph.insertEdge(30, 60);
+    graph.insertEdge(60, 90);
+    graph.insertEdge(297, 60);
+    ASSERT_EQ(true, graph.deleteVertex(30));
+
+    ASSERT_EQ(-1, graph.getVertexId(30));
+    ASSERT_EQ(9, graph.getVertexId(27));
+    ASSERT_EQ(11, graph.getVertexId(33));
+    ASSERT_EQ(10, graph.getVertexId(297));
+    ASSERT_EQ(98, graph.getVertexId(294));
+    ASSERT_EQ(true, graph.containsEdge(297, 60));
+
+    for(int i = 0; i < graph.getNumVertices(); i++)
+        ASSERT_EQ(i, graph.getVertexId(graph.getVertexData(i)));
+
+    dTraveler<int> trav;
+    ASSERT_EQ(true, graph.breadthFirst(60, &trav));
+    ASSERT_EQ(true, trav.graph.containsEdge(60, 90));
+}
+
+
+TEST(VerticesTest, churn_keeps_edges_consistent) {
+    srand(21);
+    dGraph<int> graph;
+
+    // every edge the graph should have, checked against the graph as vertices and edges come and go
+    std::set<std::pair<int, int> > edges;
+    int next = 0;
+
+    for(int round = 0; round < 4000; round++) {
+
+        int op = rand()%4;
+        int n = graph.getNumVertices();
+
+        if(n < 10 || op == 0) {
+            ASSERT_EQ(true, graph.insertVertex(next++));
+        }
+        else if(op == 1) {
+            int one = graph.getVertexData(rand()%n), two = graph.getVertexData(rand()%n);
+            if(graph.insertEdge(one, two, 1.0))
+                edges.insert(std::make_pair(one, two));
+        }
+        else if(op == 2) {
+            int victim = graph.getVertexData(rand()%n);
+            ASSERT_EQ(true, graph.deleteVertex(victim));
+            for(auto it = edges.begin(); it != edges.end();) {
+                if(it->first == victim || it->second == victim) it = edges.erase(it);
+                else ++it;
+            }
+        }
+        else if(edges.size()) {
+            auto edge = edges.begin();
+            std::advance(edge, rand()%edges.size());
+            ASSERT_EQ(true, graph.deleteEdge(edge->first, edge->second));
+            edges.erase(edge);
+        }
+    }
+
+    ASSERT_EQ((int)edges.size(), graph.getNumEdges());
+    ASSERT_EQ(edges.size(), graph.getAllEdges().size());
+
+    for(auto & edge : edges)
+        ASSERT_EQ(true, graph.containsEdge(edge.first, edge.second));
+
+    for(int i = 0; i < graph.getNumVertices(); i++)
+        ASSERT_EQ(i, graph.getVertexId(graph.getVertexData(i)));
+
+    // deleting everything that is left has to account for every edge
+    for(auto vertex : graph.getAllVertices())
+        ASSERT_EQ(true, graph.deleteVertex(vertex));
+
+    ASSERT_EQ(0, graph.getNumEdges());
+}
@@ -164,3 +164,181 @@ TEST(Dijkstras, large_test_union_4) {
 
     analyzeGraphDijkstras(&graph, num_vertices, iterations);
 }
+
+
+TEST(Dijkstras, equal_weight_ring) {
+
+    // all of the edges share the same weight, which used to confuse the std::set based priority queue
+    int num_vertices = 2000;
+
+    uGraph<int> graph;
+
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertEdge(i, (i+1)%num_vertices, 1.0);
+
+    auto tree = graph.dijkstrasMinimumTree(0);
+
+    for(int i = 0; i < num_vertices; i++)
+        ASSERT_EQ((double) std::min(i, num_vertices-i), tree->second.at(i));
+
+    delete(tree);
+
+    for(int i = 1; i < num_vertices; i += 97) {
+        uTraveler<int> trav;
+        ASSERT_EQ(true, graph.dijkstrasShortestPath(0, i, &trav));
+        ASSERT_EQ(std::min(i, num_vertices-i), trav.graph.getNumEdges());
+    }
+}
+
+
+// @func - gridDistance
+// @info - Manhattan distance between two cells of the 100 wide grid used by the A* tests, never overestimates a unit grid
+double gridDistance(int & one, int & two) {
+    return std::abs(one/100 - two/100) + std::abs(one%100 - two%100);
+}
+
+TEST(AStar, grid_matches_dijkstras) {
+
+    // a 100x100 grid with unit weight edges between neighboring cells
+    int width = 100;
+    uGraph<int> graph;
+
+    for(int i = 0; i < width*width; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < width*width; i++) {
+        if(i%width != width-1) { graph.insertEdge(i, i+1, 1.0); }
+        if(i/width != width-1) { graph.insertEdge(i, i+width, 1.0); }
+    }
+
+    auto tree = graph.dijkstrasMinimumTree(0);
+
+    for(int goal = 1; goal < width*width; goal += 613) {
+
+        unsigned int expanded = 0;
+        auto path = graph.aStar(0, std::vector<int>{goal}, gridDistance, &expanded);
+
+        ASSERT_EQ(tree->second.at(goal), (double) path.size());
+        ASSERT_EQ(goal, path.back());
+
+        // every step of the path has to be a real edge
+        for(unsigned int i = 1; i < path.size(); i++)
+            ASSERT_EQ(true, graph.containsEdge(path[i-1], path[i]));
+
+        // the heuristic is exact on an open grid, so we should only expand the cells in the box between the two corners
+        ASSERT_LE(expanded, (unsigned int) (goal/width+1)*(goal%width+1));
+    }
+
+    delete(tree);
+
+    // the function pointer version with no heuristic is plain Dijkstra's
+    ASSERT_EQ(198u, graph.aStar(0, {width*width-1}, nullptr).size());
+    ASSERT_EQ(198u, graph.aStar(0, {width*width-1}, gridDistance).size());
+}
+
+TEST(AStar, multiple_goals_and_callables) {
+
+    int num_vertices = 1000;
+    uGraph<int> graph;
+
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < num_vertices-1; i++)
+        graph.insertEdge(i, i+1, 1.0);
+
+    // the closest goal wins, no matter what order the goals are given in
+    int scale = 0;
+    auto zero = [&scale](int &, int &) { return 0.0*scale; };
+    std::vector<int> goals = {900, 5, 40};
+    unsigned int expanded = 0;
+
+    auto path = graph.aStar(0, goals, zero, &expanded);
+
+    ASSERT_EQ(5u, path.size());
+    ASSERT_EQ(5, path.back());
+    ASSERT_EQ(6u, expanded);
+
+    // already there, no path, and missing vertices all give back an empty path
+    ASSERT_EQ(0u, graph.aStar(5, goals, zero).size());
+    ASSERT_EQ(0u, graph.aStar(0, std::vector<int>{-1, 5000}, zero).size());
+    ASSERT_EQ(0u, graph.aStar(-1, goals, zero).size());
+
+    graph.insertVertex(num_vertices);
+    ASSERT_EQ(0u, graph.aStar(0, std::vector<int>{num_vertices}, zero, &expanded).size());
+    ASSERT_EQ((unsigned int) num_vertices, expanded);
+}
+
+
+// @class - PathWeightTraveler
+// @info  - Adds up the weights of the edges a path-finding function traverses and checks that they line up end to end
+class PathWeightTraveler : public GraphTraveler<int>
+{
+public:
+    PathWeightTraveler() : weight(0), last(-1), connected(true) {}
+    void discover_vertex(const int &) {}
+    void examine_edge(const Edge<int> &) {}
+    void starting_vertex(const int & v) { last = v; }
+    void finished_traversal() {}
+    void traverse_edge(const Edge<int> & edge) {
+        connected = connected && edge.getSource()->getData() == last;
+        last = edge.getTarget()->getData();
+        weight += edge.getWeight();
+    }
+    double weight;
+    int last;
+    bool connected;
+};
+
+TEST(Dijkstras, bidirectional_matches_dijkstras) {
+
+    int num_vertices = 3000;
+    uGraph<int> graph;
+
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < 4*num_vertices; i++)
+        graph.insertEdge(rand()%num_vertices, rand()%num_vertices, (rand()%1000+1)/10.0);
+
+    for(int k = 0; k < 20; k++) {
+
+        // deleted vertices get reinserted with random values, so make sure we pick one that's there
+        int src = rand()%num_vertices;
+        while(!graph.containsVertex(src))
+            src = rand()%num_vertices;
+
+        auto tree = graph.dijkstrasMinimumTree(src);
+
+        for(int j = 0; j < 25; j++) {
+
+            int dest = rand()%num_vertices;
+            while(!graph.containsVertex(dest))
+                dest = rand()%num_vertices;
+
+            PathWeightTraveler trav;
+            bool found = graph.bidirectionalShortestPath(src, dest, &trav);
+
+            ASSERT_EQ(tree->second.at(dest) != std::numeric_limits<double>::infinity(), found);
+
+            if(found) {
+                ASSERT_NEAR(tree->second.at(dest), trav.weight, 1e-9);
+                ASSERT_EQ(true, trav.connected);
+                ASSERT_EQ(dest, trav.last);
+            }
+        }
+
+        delete(tree);
+
+        // change the graph between rounds so that any cached state has to be rebuilt
+        graph.insertEdge(rand()%num_vertices, rand()%num_vertices, 0.5);
+        graph.setEdgeWeight(src, rand()%num_vertices, 1.0);
+        graph.deleteVertex(rand()%num_vertices);
+        graph.insertVertex(rand()%num_vertices);
+    }
+
+    ASSERT_THROW(graph.bidirectionalShortestPath(-1, 0), std::logic_error);
+}
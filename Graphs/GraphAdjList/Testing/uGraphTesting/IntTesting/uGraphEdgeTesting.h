@@ -299,3 +299,132 @@ TEST(EdgesTest, vertex_and_edge_deletion) {
     ASSERT_EQ(0, graph.getNumEdges());
 
 }
+
+// @func - checkNeighborViews
+// @info - Checks the views of the graph against the copies handed out by getAllVertices and getIncidentEdges
+void checkNeighborViews(uGraph<int> & graph) {
+
+    auto vertices = graph.getAllVertices();
+    VertexView<int> view = graph.getVertices();
+    ASSERT_EQ(vertices.size(), view.size());
+    ASSERT_EQ(vertices.empty(), view.empty());
+
+    unsigned int i = 0;
+    for(auto vertex = view.begin(); vertex != view.end(); ++vertex, ++i) {
+        ASSERT_EQ(vertices[i], *vertex);
+        ASSERT_EQ(vertices[i], view[i]);
+        ASSERT_EQ(i, vertex.id());
+
+        auto edges = graph.getIncidentEdges(*vertex);
+        NeighborView<int> neighbors = graph.getNeighbors(*vertex);
+        ASSERT_EQ(edges.size(), neighbors.size());
+        ASSERT_EQ(edges.empty(), neighbors.empty());
+        ASSERT_EQ(neighbors.size(), vertex.neighbors().size());
+        ASSERT_EQ(neighbors.size(), view.neighbors(i).size());
+
+        unsigned int j = 0;
+        for(auto edge = neighbors.begin(); edge != neighbors.end(); ++edge, ++j) {
+            ASSERT_EQ(*vertex, edge->getSource()->getData());
+            ASSERT_EQ(edges[j].getTarget()->getData(), edge.target());
+            ASSERT_EQ(graph.getVertexId(edge.target()), edge.targetId());
+            ASSERT_EQ(edges[j].getWeight(), edge.weight());
+            ASSERT_EQ(edges[j].getWeight(), (*edge).getWeight());
+        }
+    }
+}
+
+TEST(EdgesTest, neighbor_views) {
+    // its own generator, so the tests after this one see the same rand() sequence they always have
+    std::mt19937 gen(23);
+    uGraph<int> graph;
+
+    checkNeighborViews(graph);
+    ASSERT_THROW(graph.getNeighbors(1), std::logic_error);
+
+    for(int i = 0; i < 200; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < 1000; i++)
+        graph.insertEdge(gen()%200, gen()%200, gen()%100+1);
+
+    checkNeighborViews(graph);
+
+    // a view sees weight changes made after it was taken
+    int source = graph.getAllEdges()[0].getSource()->getData();
+    NeighborView<int> neighbors = graph.getNeighbors(source);
+    graph.setEdgeWeight(source, neighbors.begin().target(), 1000);
+    ASSERT_EQ(1000, neighbors.begin().weight());
+
+    for(int i = 0; i < 20; i++) {
+        graph.deleteVertex(gen()%200);
+        graph.deleteEdge(gen()%200, gen()%200);
+    }
+
+    checkNeighborViews(graph);
+
+    // the copies are built from the views, they have to come out identical to the original
+    uGraph<int> copy(graph);
+    ASSERT_EQ(true, copy == graph);
+    checkNeighborViews(copy);
+
+    uGraph<int> assigned;
+    assigned.insertVertex(-5);
+    assigned = graph;
+    ASSERT_EQ(true, assigned == graph);
+    ASSERT_EQ(graph.getNumEdges(), assigned.getNumEdges());
+
+    copy.setEdgeWeight(source, copy.getNeighbors(source).begin().target(), 1);
+    ASSERT_EQ(false, copy == graph);
+
+    ASSERT_THROW(graph.getNeighbors(-1), std::logic_error);
+}
+
+TEST(EdgesTest, small_degree_index) {
+    std::vector<Vertex<int> > targets;
+    for(int i = 1; i <= 40; i++)
+        targets.push_back(Vertex<int>(i));
+
+    AdjList<int> hub(0);
+    Vertex<int> self(0);
+    ASSERT_EQ(false, hub.addEdge(&self));
+
+    // the edges are scanned until there are more than index_threshold of them, and hashed after that
+    for(int i = 0; i < 40; i++) {
+        ASSERT_EQ(true, hub.addEdge(&targets[i], i));
+        ASSERT_EQ(false, hub.addEdge(&targets[i], i));
+        ASSERT_EQ(hub.get_num_edges() > AdjList<int>::index_threshold, hub.isIndexed());
+
+        for(int j = 0; j < 40; j++) {
+            ASSERT_EQ(j <= i, hub.containsEdge(j+1));
+            if(j <= i) {
+                ASSERT_EQ(j, hub.getEdge(j+1)->getWeight());
+            }
+        }
+    }
+
+    // deleting from the front keeps moving the last edge around, the index is only dropped at half the threshold
+    for(int i = 0; i < 40; i++) {
+        ASSERT_EQ(true, hub.deleteEdge(i+1));
+        ASSERT_EQ(false, hub.deleteEdge(i+1));
+        ASSERT_EQ(39-i, hub.get_num_edges());
+        ASSERT_EQ(hub.get_num_edges() > AdjList<int>::index_threshold/2, hub.isIndexed());
+
+        for(int j = 0; j < 40; j++) {
+            ASSERT_EQ(j > i, hub.containsEdge(j+1));
+            if(j > i) {
+                ASSERT_EQ(j, hub.getEdge(targets[j])->getWeight());
+            }
+        }
+    }
+
+    // growing back past the threshold builds the index again, deleting every edge drops it
+    for(int i = 0; i < 10; i++)
+        hub.appendEdge(&targets[i], i);
+
+    ASSERT_EQ(true, hub.isIndexed());
+    ASSERT_EQ(9, hub.getEdge(10)->getWeight());
+    ASSERT_EQ(true, hub.deleteAllEdges());
+    ASSERT_EQ(false, hub.isIndexed());
+    ASSERT_EQ(0, hub.get_num_edges());
+    ASSERT_EQ(nullptr, hub.getEdge(1));
+}
@@ -0,0 +1,243 @@
+#include "../../../UndirectedGraph/uGraph.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <chrono>
+
+
+// the weight of the cheapest cut found by trying every split of the vertices, only usable on tiny graphs
+double bruteForceCut(uGraph<int> & graph, int num_vertices) {
+
+    double best = std::numeric_limits<double>::infinity();
+
+    // vertex 0 always stays on the false side so every split is only tried once
+    for(int mask = 1; mask < (1 << (num_vertices-1)); mask++) {
+
+        double weight = 0;
+        for(int i = 0; i < num_vertices; i++)
+            for(int j = i+1; j < num_vertices; j++)
+                if(((mask << 1 >> i) & 1) != ((mask << 1 >> j) & 1) && graph.containsEdge(i, j))
+                    weight += graph.getEdgeWeight(i, j);
+
+        best = std::min(best, weight);
+    }
+
+    return best;
+}
+
+// the weight of the edges that cross the given partition
+double crossingWeight(uGraph<int> & graph, const std::vector<std::vector<int> > & cut) {
+
+    double weight = 0;
+    for(auto one : cut[0])
+        for(auto two : cut[1])
+            if(graph.containsEdge(one, two))
+                weight += graph.getEdgeWeight(one, two);
+
+    return weight;
+}
+
+TEST(MinCutTests, two_cliques) {
+
+    // two heavy cliques of 6 vertices joined by two light bridges
+    uGraph<int> graph;
+    for(int i = 0; i < 12; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < 6; i++) {
+        for(int j = i+1; j < 6; j++) {
+            graph.insertEdge(i, j, 5.0);
+            graph.insertEdge(i+6, j+6, 5.0);
+        }
+    }
+
+    graph.insertEdge(2, 9, 0.5);
+    graph.insertEdge(4, 7, 0.75);
+
+    double weight = 0;
+    auto cut = graph.minimumCut(&weight);
+
+    ASSERT_EQ(2, cut.size());
+    ASSERT_DOUBLE_EQ(1.25, weight);
+    ASSERT_EQ(6, cut[0].size());
+    ASSERT_EQ(6, cut[1].size());
+    ASSERT_DOUBLE_EQ(weight, crossingWeight(graph, cut));
+
+    // the two halves have to be the two cliques
+    std::sort(cut[0].begin(), cut[0].end());
+    std::sort(cut[1].begin(), cut[1].end());
+    ASSERT_EQ(cut[0].front() == 0 ? 5 : 11, cut[0].back());
+    ASSERT_EQ(cut[1].front() == 0 ? 5 : 11, cut[1].back());
+}
+
+TEST(MinCutTests, matches_brute_force) {
+
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<double> weights(0.0, 10.0);
+
+    for(int trial = 0; trial < 20; trial++) {
+
+        int num_vertices = 10;
+        uGraph<int> graph;
+        for(int i = 0; i < num_vertices; i++)
+            graph.insertVertex(i);
+
+        for(int i = 0; i < num_vertices; i++)
+            for(int j = i+1; j < num_vertices; j++)
+                if(gen() % 3 == 0)
+                    graph.insertEdge(i, j, weights(gen));
+
+        double weight = -1;
+        auto cut = graph.minimumCut(&weight);
+
+        ASSERT_EQ(num_vertices, cut[0].size() + cut[1].size());
+        ASSERT_GT(cut[0].size(), 0);
+        ASSERT_GT(cut[1].size(), 0);
+        ASSERT_NEAR(bruteForceCut(graph, num_vertices), weight, 1e-9);
+        ASSERT_NEAR(weight, crossingWeight(graph, cut), 1e-9);
+    }
+}
+
+TEST(MinCutTests, edge_cases) {
+
+    uGraph<int> graph;
+    double weight = -1;
+
+    ASSERT_EQ(0, graph.minimumCut(&weight).size());
+    ASSERT_EQ(0, weight);
+
+    graph.insertVertex(1);
+    ASSERT_EQ(0, graph.minimumCut().size());
+
+    // a graph that isn't connected can be cut for free
+    graph.insertVertex(2);
+    graph.insertVertex(3);
+    graph.insertEdge(1, 2, 4.0);
+
+    auto cut = graph.minimumCut(&weight);
+    ASSERT_EQ(0, weight);
+    ASSERT_EQ(3, cut[0].size() + cut[1].size());
+
+    graph.insertEdge(2, 3, -1.0);
+    ASSERT_THROW(graph.minimumCut(), std::logic_error);
+}
+
+TEST(MinCutTests, infinite_weights) {
+
+    // makeGraphDense without a weight function leaves every edge infinite, so every cut is infinite too and the first
+    // one found has to be handed back instead of nothing
+    for(int num_vertices : {5, 40}) {
+
+        uGraph<int> graph;
+        for(int i = 0; i < num_vertices; i++)
+            graph.insertVertex(i);
+        graph.makeGraphDense(nullptr);
+
+        for(auto algorithm : {MinimumCutAlgorithm::StoerWagner, MinimumCutAlgorithm::KargerStein}) {
+
+            double weight = -1;
+            auto cut = graph.minimumCut(&weight, MinimumCutOptions(algorithm, 4, 2, 5));
+
+            ASSERT_EQ(2, cut.size());
+            ASSERT_EQ(num_vertices, cut[0].size() + cut[1].size());
+            ASSERT_FALSE(cut[0].empty());
+            ASSERT_FALSE(cut[1].empty());
+            ASSERT_EQ(std::numeric_limits<double>::infinity(), weight);
+        }
+    }
+}
+
+TEST(MinCutTests, karger_stein) {
+
+    std::mt19937 gen(23);
+    std::uniform_real_distribution<double> weights(0.5, 10.0);
+
+    for(int trial = 0; trial < 10; trial++) {
+
+        int num_vertices = 10;
+        uGraph<int> graph;
+        for(int i = 0; i < num_vertices; i++)
+            graph.insertVertex(i);
+
+        for(int i = 0; i < num_vertices; i++)
+            for(int j = i+1; j < num_vertices; j++)
+                if(gen() % 2 == 0)
+                    graph.insertEdge(i, j, weights(gen));
+
+        double weight = -1;
+        auto cut = graph.minimumCut(&weight, MinimumCutOptions(MinimumCutAlgorithm::KargerStein, 0, 2, 99+trial));
+
+        ASSERT_EQ(num_vertices, cut[0].size() + cut[1].size());
+        ASSERT_NEAR(bruteForceCut(graph, num_vertices), weight, 1e-9);
+        ASSERT_NEAR(weight, crossingWeight(graph, cut), 1e-9);
+    }
+
+    // a bigger graph with a planted cut, every thread count has to agree with Stoer-Wagner
+    uGraph<int> graph;
+    int num_vertices = 150;
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+
+    for(int i = 0; i < 1500; i++) {
+        int one = gen() % num_vertices, two = gen() % num_vertices;
+        if((one < 50) == (two < 50))
+            graph.insertEdge(one, two, weights(gen));
+    }
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertEdge(i, (i+1) % num_vertices, 0.1);
+
+    double exact = 0;
+    graph.minimumCut(&exact);
+
+    for(unsigned int threads : {1u, 4u}) {
+        double weight = -1;
+        auto cut = graph.minimumCut(&weight, MinimumCutOptions(MinimumCutAlgorithm::KargerStein, 0, threads, 7));
+        ASSERT_NEAR(exact, weight, 1e-9);
+        ASSERT_NEAR(weight, crossingWeight(graph, cut), 1e-9);
+    }
+
+    // and a graph that isn't connected is cut for free without running any trials
+    graph.insertVertex(num_vertices);
+    double weight = -1;
+    auto cut = graph.minimumCut(&weight, MinimumCutOptions(MinimumCutAlgorithm::KargerStein));
+    ASSERT_EQ(0, weight);
+    ASSERT_EQ(1, std::min(cut[0].size(), cut[1].size()));
+}
+
+TEST(MinCutTests, large_graph_speed) {
+
+    std::mt19937 gen(5);
+    int num_vertices = 1000;
+
+    uGraph<int> graph;
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+
+    // a ring keeps the graph connected, the random chords make the cut worth finding
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertEdge(i, (i+1) % num_vertices, 1.0 + gen() % 5);
+    for(int i = 0; i < 4*num_vertices; i++)
+        graph.insertEdge(gen() % num_vertices, gen() % num_vertices, 1.0 + gen() % 5);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    double weight = 0;
+    auto cut = graph.minimumCut(&weight);
+    auto elapsed = std::chrono::high_resolution_clock::now() - start;
+
+    std::cout << "[   INFO   ] Stoer-Wagner on " << num_vertices << " vertices : "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << "ms\n";
+
+    ASSERT_NEAR(weight, crossingWeight(graph, cut), 1e-9);
+
+    start = std::chrono::high_resolution_clock::now();
+    double random_weight = 0;
+    cut = graph.minimumCut(&random_weight, MinimumCutOptions(MinimumCutAlgorithm::KargerStein, 4, 0, 3));
+    elapsed = std::chrono::high_resolution_clock::now() - start;
+
+    std::cout << "[   INFO   ] Karger-Stein on " << num_vertices << " vertices : "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << "ms\n";
+
+    ASSERT_NEAR(random_weight, crossingWeight(graph, cut), 1e-9);
+    ASSERT_GE(random_weight, weight - 1e-9);
+}
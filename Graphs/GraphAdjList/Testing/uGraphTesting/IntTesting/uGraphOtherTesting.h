@@ -105,6 +105,112 @@ TEST(Bipartition, simple_positive_test) {
 ////////////////    SPEED TESTS /////////////////
 /////////////////////////////////////////////////
 
+TEST(Components, incremental_test) {
+
+    uGraph<int> graph;
+    for(int i = 0; i < 6; i++)
+        graph.insertVertex(i);
+
+    ASSERT_EQ(6, graph.getNumComponents());
+    ASSERT_EQ(false, graph.isConnected());
+
+    graph.insertEdge(0, 1);
+    graph.insertEdge(1, 2);
+    graph.insertEdge(3, 4);
+
+    ASSERT_EQ(3, graph.getNumComponents());
+    ASSERT_EQ(3, graph.getComponentSize(2));
+    ASSERT_EQ(2, graph.getComponentSize(4));
+    ASSERT_EQ(1, graph.getComponentSize(5));
+    ASSERT_EQ(0, graph.getComponentSize(42));
+
+    std::vector<unsigned int> component;
+    ASSERT_EQ(3, graph.connectedComponents(component));
+    ASSERT_EQ(6, component.size());
+    ASSERT_EQ(0, component[0]);
+    ASSERT_EQ(0, component[2]);
+    ASSERT_EQ(1, component[3]);
+    ASSERT_EQ(1, component[4]);
+    ASSERT_EQ(2, component[5]);
+
+    graph.insertEdge(2, 3);
+    graph.insertEdge(4, 5);
+    ASSERT_EQ(true, graph.isConnected());
+
+    // deleting an edge or a vertex can split a component
+    graph.deleteEdge(2, 3);
+    ASSERT_EQ(2, graph.getNumComponents());
+    ASSERT_EQ(false, graph.isConnected());
+
+    graph.insertEdge(0, 5);
+    ASSERT_EQ(true, graph.isConnected());
+
+    graph.deleteVertex(0);
+    ASSERT_EQ(2, graph.getNumComponents());
+    ASSERT_EQ(2, graph.getComponentSize(1));
+    ASSERT_EQ(3, graph.getComponentSize(5));
+
+    graph.insertVertex(6);
+    ASSERT_EQ(3, graph.getNumComponents());
+
+    graph.makeGraphDense();
+    ASSERT_EQ(true, graph.isConnected());
+
+    graph.destroyGraph();
+    ASSERT_EQ(0, graph.getNumComponents());
+    ASSERT_EQ(true, graph.isConnected());
+}
+
+TEST(Components, matches_traversal) {
+
+    srand(8);
+    int num_vertices = 300;
+
+    uGraph<int> graph;
+    for(int i = 0; i < num_vertices; i++)
+        graph.insertVertex(i);
+
+    // alternate between batches of inserts and a few deletes, checking the components against a search after each
+    for(int batch = 0; batch < 10; batch++) {
+
+        for(int i = 0; i < 25; i++)
+            graph.insertEdge(rand()%num_vertices, rand()%num_vertices);
+
+        if(batch % 3 == 2) {
+            auto edges = graph.getAllEdges();
+            for(int i = 0; i < 10 && i < (int) edges.size(); i++)
+                graph.deleteEdge(edges[i].getSource()->getData(), edges[i].getTarget()->getData());
+        }
+
+        std::vector<unsigned int> component;
+        unsigned int count = graph.connectedComponents(component);
+        ASSERT_EQ(count, graph.getNumComponents());
+
+        std::vector<bool> seen(num_vertices, false);
+        unsigned int searched = 0;
+
+        for(int i = 0; i < num_vertices; i++) {
+
+            if(seen[graph.getVertexId(i)])
+                continue;
+
+            uTraveler<int> trav;
+            graph.breadthFirst(i, &trav);
+            searched++;
+
+            for(auto vertex : trav.graph.getAllVertices()) {
+                int id = graph.getVertexId(vertex);
+                seen[id] = true;
+                ASSERT_EQ(component[graph.getVertexId(i)], component[id]);
+            }
+
+            ASSERT_EQ(trav.graph.getNumVertices(), graph.getComponentSize(i));
+        }
+
+        ASSERT_EQ(searched, count);
+    }
+}
+
 TEST(SpeedTests, large_bfs_dfs_test) { 
 
     uGraph<int> graph;
@@ -17,6 +17,7 @@
 #include "../../../../GraphTraveler/uTraveler.hpp"
 #include "uGraphEdgeTesting.h"
 #include "uGraphMinTreeTesting.h"
+#include "uGraphMinCutTesting.h"
 #include "uGraphVertexTesting.h"
 #include "uGraphOtherTesting.h"
 #include "uGraphDijkstraTesting.h"
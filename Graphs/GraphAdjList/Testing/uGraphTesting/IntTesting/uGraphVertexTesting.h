@@ -116,4 +116,43 @@ TEST(VerticesTest, delete_test) {
         graph.deleteVertex(i);
 
     ASSERT_EQ((int)(numVertices-numRemove), graph.getNumVertices());
-}
\ No newline at end of file
+}
+TEST(VerticesTest, dense_ids) {
+    uGraph<int> graph;
+
+    for(int i = 0; i < 100; i++)
+        graph.insertVertex(i*3);
+
+    // ids are handed out in insertion order
+    for(int i = 0; i < 100; i++) {
+        ASSERT_EQ(i, graph.getVertexId(i*3));
+        ASSERT_EQ(i*3, graph.getVertexData(i));
+    }
+
+    ASSERT_EQ(-1, graph.getVertexId(1));
+    ASSERT_THROW(graph.getVertexData(100), std::logic_error);
+
+    // a vertex that no graph owns reports -1
+    ASSERT_EQ(-1, Vertex<int>().getIndex());
+    ASSERT_EQ(-1, Vertex<int>(5).getIndex());
+
+    // deleting a vertex moves the last vertex into its id and leaves every other id alone
+    graph.insertEdge(30, 60);
+    graph.insertEdge(60, 90);
+    graph.insertEdge(297, 60);
+    ASSERT_EQ(true, graph.deleteVertex(30));
+
+    ASSERT_EQ(-1, graph.getVertexId(30));
+    ASSERT_EQ(9, graph.getVertexId(27));
+    ASSERT_EQ(11, graph.getVertexId(33));
+    ASSERT_EQ(10, graph.getVertexId(297));
+    ASSERT_EQ(98, graph.getVertexId(294));
+    ASSERT_EQ(true, graph.containsEdge(297, 60));
+
+    for(int i = 0; i < graph.getNumVertices(); i++)
+        ASSERT_EQ(i, graph.getVertexId(graph.getVertexData(i)));
+
+    uTraveler<int> trav;
+    ASSERT_EQ(true, graph.breadthFirst(60, &trav));
+    ASSERT_EQ(true, trav.graph.containsEdge(60, 90));
+}
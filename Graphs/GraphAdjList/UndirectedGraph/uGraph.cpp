@@ -48,24 +48,31 @@
 // @args - None
 // @info - Initializes everything to empty
 template<class VertexType>
-uGraph<VertexType>::uGraph() : num_edges(0), num_vertices(0), is_multi_graph(false) {
+uGraph<VertexType>::uGraph() : num_edges(0), num_vertices(0), is_multi_graph(false), components_valid(true) {
 
 }
 
 // @func  - Constructor#2
-// @args  - #1 String that contains the filename from which to load a graph
-// @error - Can throw IO error if invalid filename or file structure to build graph is given
+// @args  - #1 String that contains the filename from which to load a graph, #2 the format of the file, #3 bool, true if the file
+//          is known to have no duplicate edges or self loops
+// @error - Throws a logic_error if the file can't be opened or a line of it can't be parsed
 template<class VertexType>
-uGraph<VertexType>::uGraph(std::string fn){
-
-// #TODO Load the file given by 'fn' into the graph.
+uGraph<VertexType>::uGraph(std::string fn, EdgeListFormat format, bool clean) : num_vertices(0), num_edges(0), is_multi_graph(false), components_valid(true) {
 
+    try {
+        loadFile(fn, format, clean);
+    }
+    catch(...) {
+        // the destructor won't run if we throw out of the constructor, so clean up what we loaded so far
+        destroyGraph();
+        throw;
+    }
 }
 
 // @func  - Copy Constructor
 // @args  - #1 uGraph object that you wish to make this a copy of
 template<class VertexType>
-uGraph<VertexType>::uGraph(const uGraph<VertexType> & toCopy) {
+uGraph<VertexType>::uGraph(const uGraph<VertexType> & toCopy) : components_valid(false) {
 
     auto ourVertices = getAllVertices();
     // Go through, delete, and clean up all vertices and edges.z
@@ -78,26 +85,15 @@ uGraph<VertexType>::uGraph(const uGraph<VertexType> & toCopy) {
     num_vertices = 0;
     num_edges = 0;
 
-    auto theirVertices = toCopy.getAllVertices();
-    for(auto i : theirVertices) {
-        auto edges = toCopy.getIncidentEdges(i);
-        insertVertex(i);
-
-        for(auto edge : edges) {
-            insertEdge(i, edge.getTarget()->getData(), edge.getWeight());
-        }
-    }
+    copyFrom(toCopy);
 }
 
 
 // @func  - Destructor
-// @info  - Cleans up the dynamically allocated AdjList objects contains in the list vector.
+// @info  - Cleans up the AdjList and Edge objects, which all live in the pools owned by this graph.
 template<class VertexType>
 uGraph<VertexType>::~uGraph() {
-    for(int i = 0; i < list.size(); i++)
-        delete(list[i]);
-
-    list.clear();
+    destroyGraph();
 }
 
 
@@ -105,15 +101,22 @@ uGraph<VertexType>::~uGraph() {
 // @info - deletes all internal vertices and edges, cleaning up memory in the process
 template<class VertexType>
 bool uGraph<VertexType>::destroyGraph() {
+
+    // The edges are trivial to destroy, so rather than handing them back to the pool one at a time we have each adj list
+    // forget about its edges and then release every edge slab at once.
     for(auto & vert : list) {
-        vert->getEdgeList()->clear();
-        delete(vert);
+        vert->releaseEdges();
+        vertex_pool.destroy(vert);
     }
 
     list.clear();
     lookup_map.clear();
+    edge_pool.release();
+    vertex_pool.release();
     num_vertices = 0;
     num_edges = 0;
+    components.reset(0);
+    components_valid = true;
 
     return true;
 }
@@ -124,22 +127,8 @@ bool uGraph<VertexType>::destroyGraph() {
 template<class VertexType>
 uGraph<VertexType> uGraph<VertexType>::operator=(const uGraph<VertexType> & toCopy) {
 
-    auto ourVertices = getAllVertices();
     destroyGraph();
-
-    auto theirVertices = toCopy.getAllVertices();
-
-    for(auto i : theirVertices) {
-        insertVertex(i);
-    }
-
-    for(auto i : theirVertices) {
-        auto edges = toCopy.getIncidentEdges(i);
-
-        for(auto edge : edges) {
-            insertEdge(i, edge.getTarget()->getData(), edge.getWeight());
-        }
-    }
+    copyFrom(toCopy);
 
     return *this;
 }
@@ -152,22 +141,27 @@ uGraph<VertexType> uGraph<VertexType>::operator=(const uGraph<VertexType> & toCo
 template<class VertexType>
 bool uGraph<VertexType>::operator==(const uGraph<VertexType> & toCopy) {
 
-    auto our_vertices = getAllVertices();
+    VertexView<VertexType> our_vertices = getVertices();
 
-    auto their_vertices = toCopy.getAllVertices();
+    VertexView<VertexType> their_vertices = toCopy.getVertices();
 
     if(our_vertices.size() != their_vertices.size())
         return false;
 
-    for(int i = 0; i < our_vertices.size(); i++) {
+    for(unsigned int i = 0; i < our_vertices.size(); i++) {
         if(our_vertices[i] != their_vertices[i])
             return false;
 
-        auto our_edges = getIncidentEdges(our_vertices[i]);
-        auto their_edges = toCopy.getIncidentEdges(their_vertices[i]);
+        NeighborView<VertexType> our_edges = our_vertices.neighbors(i);
+        NeighborView<VertexType> their_edges = their_vertices.neighbors(i);
 
-        if(our_edges != their_edges)
+        if(our_edges.size() != their_edges.size())
             return false;
+
+        for(auto ours = our_edges.begin(), theirs = their_edges.begin(); ours != our_edges.end(); ++ours, ++theirs) {
+            if(ours.target() != theirs.target() || ours.weight() != theirs.weight())
+                return false;
+        }
     }
 
     return true;
@@ -204,9 +198,9 @@ bool uGraph<VertexType>::getIntersection(const uGraph<VertexType> & other_graph)
 template<class VertexType>
 bool uGraph<VertexType>::getUnion(const uGraph<VertexType> & other_graph) {
 
-    for(auto vertex : other_graph.getAllVertices()) {
+    for(auto & vertex : other_graph.getVertices()) {
         insertVertex(vertex);
-        for(auto edge: other_graph.getIncidentEdges(vertex)) {
+        for(auto & edge : other_graph.getNeighbors(vertex)) {
             insertEdge(edge.getSource()->getData(), edge.getTarget()->getData(), edge.getWeight());
         }
     }
@@ -231,8 +225,11 @@ bool uGraph<VertexType>::insertVertex(const VertexType & data ) {
     if(!newVertex.setData(data))
         return false;
 
-    // allocate a new adjacency list on the heap for the new vertex
-    AdjList<VertexType> * newList = new AdjList<VertexType>(newVertex);
+    // the new vertex goes at the back of our list, so its id is the current size of the list
+    newVertex.setIndex(list.size());
+
+    // allocate a new adjacency list for the new vertex out of our pool, its edges will come out of our edge pool
+    AdjList<VertexType> * newList = vertex_pool.create(newVertex, &edge_pool);
 
     newList->set_is_multi_graph(is_multi_graph);
 
@@ -245,6 +242,10 @@ bool uGraph<VertexType>::insertVertex(const VertexType & data ) {
     // increment number of vertices
     num_vertices++;
 
+    // a new vertex is a component by itself
+    if(components_valid)
+        components.add();
+
     return true;
 
 }
@@ -268,18 +269,92 @@ bool uGraph<VertexType>::insertVertices(std::vector<VertexType> vertices) {
     return ret;
 }
 
+// @func   - loadFile
+// @args   - #1 The file to load, #2 the format of the file, #3 bool, true if the file is known to have no duplicate edges or self loops
+// @return - Bool indicating success
+// @info   - Streams the vertices and edges in the file into this graph. The reader hands us tokens that point into its read buffer,
+//           so the only allocations made while loading are the ones the graph needs to store the vertices and edges.
+template<class VertexType>
+bool uGraph<VertexType>::loadFile(const std::string & fn, EdgeListFormat format, bool clean) {
+
+    EdgeListReader reader(fn, format);
+    EdgeListRecord record;
+    bool declared = false;
+
+    // the DIMACS header defines the vertex set as 1..n, so the vertices that have no arcs are inserted too. They go in
+    // before anything else, which also makes DIMACS vertex k get id k-1.
+    auto declareVertices = [&]() {
+
+        if(declared || !reader.getExpectedVertices())
+            return;
+
+        list.reserve(list.size() + reader.getExpectedVertices());
+        lookup_map.reserve(lookup_map.size() + reader.getExpectedVertices());
+
+        for(unsigned long i = 1; i <= reader.getExpectedVertices(); i++) {
+            std::string name = std::to_string(i);
+            EdgeListToken token = { name.data(), name.data() + name.size() };
+            findOrInsertVertex(reader.readVertex<VertexType>(token));
+        }
+
+        declared = true;
+    };
+
+    while(reader.next(record)) {
+
+        declareVertices();
+
+        AdjList<VertexType> * src = findOrInsertVertex(reader.readVertex<VertexType>(record.source));
+
+        if(!record.has_target)
+            continue;
+
+        AdjList<VertexType> * dst = findOrInsertVertex(reader.readVertex<VertexType>(record.target));
+
+        // every undirected edge is stored in the adj lists of both of its endpoints
+        if(clean) {
+            src->appendEdge(dst->getVertex(), record.weight);
+            dst->appendEdge(src->getVertex(), record.weight);
+            num_edges++;
+        }
+        else if(src != dst && src->addEdge(dst->getVertex(), record.weight)) {
+            dst->addEdge(src->getVertex(), record.weight);
+            num_edges++;
+        }
+        else
+            continue;
+
+        if(components_valid)
+            components.unite(src->getVertex()->getIndex(), dst->getVertex()->getIndex());
+    }
+
+    // a header with no arcs after it
+    declareVertices();
+
+    return true;
+}
+
 // @func   - getAllVertices
 // @args   - none
 // @return - Vector of the data contained inside all vertices.
 template<class VertexType>
 std::vector<VertexType> uGraph<VertexType>::getAllVertices() const {
     std::vector<VertexType> ret;
+    ret.reserve(list.size());
     for(auto i : list)
         ret.push_back(i->getVertex()->getData());
 
     return ret;
 }
 
+// @func   - getVertices
+// @args   - none
+// @return - A view over the data of every vertex in id order
+template<class VertexType>
+VertexView<VertexType> uGraph<VertexType>::getVertices() const {
+    return VertexView<VertexType>(list);
+}
+
 // @func   - getAllEdges
 // @args   - none
 // @return - Vector of all of the edges in the graph
@@ -287,10 +362,11 @@ template<class VertexType>
 std::vector<Edge<VertexType> > uGraph<VertexType>::getAllEdges() const {
 
     std::vector<Edge<VertexType> > edge_list;
+    edge_list.reserve(2*num_edges);
 
     for(auto vertex : list) {
 
-        for(auto edge : vertex->getAllEdges()) {
+        for(auto edge : *vertex->getEdgeList()) {
             edge_list.push_back(*edge);
         }
     }
@@ -321,7 +397,7 @@ bool uGraph<VertexType>::deleteVertices(std::vector<VertexType> vertices) {
 // @info   - Because this is an undirected graph, we not only have to delete the vertex in question and any edges that
 //           eminate from it, but we also have to go to the other vertices and delete any edges that end at the vertex
 //           to be deleted. Thankfully, because of our use of maps and pointers this isn't difficult nor too costly. Running time
-//           should be O(n) where n is the number of edges that leave the vertex to be deleted.
+//           is O(the sum of the degrees of the vertex's neighbors), nothing else in the graph is looked at.
 template<class VertexType>
 bool uGraph<VertexType>::deleteVertex(const VertexType & data) {
 
@@ -331,24 +407,17 @@ bool uGraph<VertexType>::deleteVertex(const VertexType & data) {
     if(adjList == nullptr)
         return false;
 
-    std::vector<Edge<VertexType> *> edges = adjList->getAllEdges();
-
-    int numEdgesToDelete = edges.size();
+    int numEdgesToDelete = adjList->get_num_edges();
 
 
     // Here we go through all of the edges eminating from the vertex to be deleted, and delete the symmetric edges that
     // point back to this vertex to be deleted. The is a nuance of our implementation, an undirected graph in this implementation
     // consists of pairs of edges between abridged vertices with equal weights.
-    for(auto edge : edges) {
-
-        // locate the adjacency list of the vertex on the other end of the edge from the vertex to be deleted
-        AdjList<VertexType> * temp = findVertex(edge->getVertex()->getData());
+    for(auto edge : *adjList->getEdgeList()) {
 
-        if(temp == nullptr) // this condition shouldn't occur but just for safety it's here
-            continue;
-
-        // delete that vertices edge with the vertex to be deleted
-        temp->deleteEdge(data);
+        // the adjacency list of the vertex on the other end of the edge is at its id in our list, delete its edge back to
+        // the vertex to be deleted
+        list[edge->getTarget()->getIndex()]->deleteEdge(data);
 
 
     }
@@ -363,22 +432,20 @@ bool uGraph<VertexType>::deleteVertex(const VertexType & data) {
     else
         lookup_map.erase(get);
 
-    // here we go through our list of adj lists and erase the one corresponding to the vertex we are deleting.
-    for(auto it = list.begin() ; it != list.end(); ++it) {
-
-        AdjList<VertexType> * adj1 = *it;
-
-        if(adj1->getVertex()->getData() == data) {
-            AdjList<VertexType> * toDelete = adj1;
-            list.erase(it);
-            delete(toDelete);
-            break;
-        }
-    }
+    // the vertex knows where it is in our list, so we don't have to search for it. The last vertex in the list is moved into
+    // its slot rather than shifting everything after it down, so only that one vertex changes its id
+    unsigned int position = adjList->getVertex()->getIndex();
+    list[position] = list.back();
+    list[position]->getVertex()->setIndex(position);
+    list.pop_back();
+    vertex_pool.destroy(adjList);
 
     // decrement the number of vertices
     num_vertices--;
 
+    // removing the vertex can split its component, and the last vertex has a new id
+    components_valid = false;
+
     // decrement the number of edges by the number of edges that were attached to the vertex we just destroyed.
     num_edges -= numEdgesToDelete;
 
@@ -407,6 +474,10 @@ bool uGraph<VertexType>::insertEdge(const VertexType & v1, const VertexType & v2
     // add an edge from vertex 1 to vertex 2
     if(adj1->addEdge(adj2->getVertex(), weight) && adj2->addEdge(adj1->getVertex(), weight)) {
         num_edges++;
+
+        if(components_valid)
+            components.unite(adj1->getVertex()->getIndex(), adj2->getVertex()->getIndex());
+
         return true;
     }
 
@@ -433,6 +504,7 @@ bool uGraph<VertexType>::deleteEdge(const VertexType & v1, const VertexType & v2
     }
 
     num_edges--;
+    components_valid = false;
     return true;
 
 }
@@ -539,15 +611,71 @@ std::vector< Edge<VertexType> > uGraph<VertexType>::getIncidentEdges(const Verte
     if(adj1 == nullptr)
         throw std::logic_error("getIncidentEdges() | Error : Vertex not found in graph\n");
 
-    std::vector<Edge<VertexType> *> edgeList = adj1->getAllEdges();
+    retVector.reserve(adj1->get_num_edges());
 
-    for(auto edge : edgeList)  {
+    for(auto edge : *adj1->getEdgeList())  {
        retVector.push_back(*edge);
     }
 
     return retVector;
 }
 
+// @func   - getNeighbors
+// @args   - #1 Data contained in the vertex
+// @return - A view over the edges of the vertex, throws a logic_error if the vertex isn't in the graph
+template<class VertexType>
+NeighborView<VertexType> uGraph<VertexType>::getNeighbors(const VertexType & data) const {
+
+    AdjList<VertexType> * adj = findVertex(data);
+
+    if(adj == nullptr)
+        throw std::logic_error("getNeighbors() | Error : Vertex not found in graph\n");
+
+    return NeighborView<VertexType>(adj);
+}
+
+// @func   - getVertexId
+// @args   - #1 Data contained in the vertex whose id you want
+// @return - The dense id of the vertex, in the range [0, getNumVertices()), -1 if the vertex isn't in the graph
+template<class VertexType>
+int uGraph<VertexType>::getVertexId(const VertexType & data) const {
+
+    AdjList<VertexType> * adj = findVertex(data);
+
+    if(adj == nullptr)
+        return -1;
+
+    return adj->getVertex()->getIndex();
+}
+
+// @func   - getVertexData
+// @args   - #1 The dense id of a vertex
+// @return - The data contained in the vertex with the given id, throws a logic_error if the id is out of range
+template<class VertexType>
+const VertexType & uGraph<VertexType>::getVertexData(unsigned int id) const {
+
+    if(id >= list.size())
+        throw std::logic_error("Vertex Id Out of Range\n");
+
+    return list[id]->getVertex()->getData();
+}
+
+// @func   - getEdgePoolStats
+// @args   - none
+// @return - The allocation statistics of the pool that the edges of this graph are allocated from
+template<class VertexType>
+PoolStats uGraph<VertexType>::getEdgePoolStats() const {
+    return edge_pool.getStats();
+}
+
+// @func   - getVertexPoolStats
+// @args   - none
+// @return - The allocation statistics of the pool that the adjacency lists of this graph are allocated from
+template<class VertexType>
+PoolStats uGraph<VertexType>::getVertexPoolStats() const {
+    return vertex_pool.getStats();
+}
+
 // @func   - processVertex
 // @args   - #1 Data contained in vertex that you wish to process, #2 GraphTraveler object that will process the vertex and it's edges
 // @return - VBool indicating if the vertex could be found or not.
@@ -563,7 +691,7 @@ bool uGraph<VertexType>::processVertex(const VertexType & source, GraphTraveler<
 
     traveler->starting_vertex(source);
 
-    for(auto edge : adj_list->getAllEdges()) {
+    for(auto edge : *adj_list->getEdgeList()) {
         traveler->examine_edge(*edge);
     }
 
@@ -594,7 +722,7 @@ bool uGraph<VertexType>::processVertices(const std::vector<VertexType> & vertice
 
         traveler->discover_vertex(adj_list->getVertex()->getData());
 
-        for(auto edge : adj_list->getAllEdges()) {
+        for(auto edge : *adj_list->getEdgeList()) {
             traveler->examine_edge(*edge);
         }
     }
@@ -615,6 +743,8 @@ bool uGraph<VertexType>::makeGraphDense(double setWeight(VertexType&, VertexType
     for(auto vertex : list)
         vertex->deleteAllEdges();
     num_edges = 0;
+    components.reset(list.size());
+    components_valid = true;
 
     for(int i = 0; i < list.size(); i++) {
         VertexType data1 = list[i]->getVertex()->getData();
@@ -680,9 +810,7 @@ void uGraph<VertexType>::printGraph() const {
     for(auto vertex : list) {
         std::cout << "Vertex : " << vertex->getVertex()->getData() << " -> ";
 
-        std::vector<Edge<VertexType> *> edges = vertex->getAllEdges();
-
-        for(auto edge : edges) {
+        for(auto edge : *vertex->getEdgeList()) {
             std::cout << edge->getVertex()->getData() << ", ";
         }
 
@@ -694,17 +822,67 @@ void uGraph<VertexType>::printGraph() const {
 // @func   - isConnected
 // @args   - None
 // @return - Bool indicating whether or not the graph is connected
-// @info   - This function searches through the given graph to see if any given vertex can be reached from any other given vertex
+// @info   - A connected graph has exactly one component, which the UnionFind kept by insertEdge already knows.
 template<class VertexType>
 bool uGraph<VertexType>::isConnected() {
 
-    uTraveler<VertexType> trav; 
+    if(list.size() <= 1)
+        return true;
+
+    return getNumComponents() == 1;
+}
+
+// @func   - getNumComponents
+// @args   - None
+// @return - The number of connected components in the graph
+template<class VertexType>
+unsigned int uGraph<VertexType>::getNumComponents() const {
+
+    buildComponents();
 
-    depthFirst(list[0]->getVertex()->getData(), &trav);
+    return components.getNumSets();
+}
+
+// @func   - getComponentSize
+// @args   - #1 Data contained in any vertex of the component
+// @return - The number of vertices in the component, 0 if the vertex isn't in the graph
+template<class VertexType>
+unsigned int uGraph<VertexType>::getComponentSize(const VertexType & data) const {
+
+    AdjList<VertexType> * adj = findVertex(data);
 
-    return trav.graph.getNumVertices() == list.size();
+    if(adj == nullptr)
+        return 0;
+
+    buildComponents();
+
+    return components.getSetSize(adj->getVertex()->getIndex());
 }
 
+// @func   - connectedComponents
+// @args   - #1 Output, the component of every vertex indexed by its dense id
+// @return - The number of connected components
+// @info   - Turns the roots of the UnionFind into dense component numbers in order of their lowest vertex id.
+template<class VertexType>
+unsigned int uGraph<VertexType>::connectedComponents(std::vector<unsigned int> & component) const {
+
+    buildComponents();
+
+    const unsigned int unnumbered = std::numeric_limits<unsigned int>::max();
+    std::vector<unsigned int> root_number(list.size(), unnumbered);
+    unsigned int next = 0;
+
+    component.resize(list.size());
+
+    for(unsigned int i = 0; i < list.size(); i++) {
+        unsigned int root = components.find(i);
+        if(root_number[root] == unnumbered)
+            root_number[root] = next++;
+        component[i] = root_number[root];
+    }
+
+    return next;
+}
 
 // @func   - isBipartite
 // @args   - None
@@ -779,79 +957,90 @@ bool uGraph<VertexType>::get_is_multi_graph() {
 //           as they're discovered.
 // @return - Bool indicating if the function could find the starting vertex based on arg#1
 // @info   - Performs a depth first traversal, calling the appropraite function inside of the Traveler class when it
-//           encounters a new vertex or edge. This function assumes that all vertex data is unique, so if this is a
-//           graph of strings, no two strings should be the same. This precondition allows us to use an std::unordered_map
-//           to keep track of the seen and unseen vertices.
+//           encounters a new vertex or edge. All of the bookkeeping is done in flat vectors indexed by the dense
+//           vertex ids, so the vertex data is never hashed or compared while the search is running.
 template<class VertexType>
 bool uGraph<VertexType>::depthFirst(const VertexType & root_data, GraphTraveler<VertexType> * traveler) {
+    SearchWorkspace<VertexType> workspace;
+    return depthFirst(root_data, traveler, workspace);
+}
+
+// @func   - depthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components
+//           as they're discovered, #3 the workspace to keep the bookkeeping of the search in
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - Runs the visitor version below through a TravelerAdapter, or with no callbacks at all for a null traveler.
+template<class VertexType>
+bool uGraph<VertexType>::depthFirst(const VertexType & root_data, GraphTraveler<VertexType> * traveler, SearchWorkspace<VertexType> & workspace) {
 
-    // Our deque object, stores the vertices as they appear to the search
-    // We actually use it as a stack for this problem, by inserting and removing from the
-    // back of the queue
-    std::deque<Vertex<VertexType> *> q;
+    if(traveler == nullptr)
+        return depthFirst(root_data, NullVisitor(), workspace);
 
-    // A map that allows us to 'mark' the vertices when they've been seen.
-    // maps a set of unique vertex data to a bool that is true if that data has been seen before
-    typename std::unordered_map<VertexType, bool> marked;
+    return depthFirst(root_data, TravelerAdapter<VertexType>(*traveler), workspace);
+}
 
-    // Maps a target vertex that is examined to the source vertex that we were at when we examined it
-    typename std::unordered_map<VertexType, VertexType> prev;
+// @func   - depthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 any visitor (see Visitor.h)
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+template<class VertexType>
+template<class Visitor, class>
+bool uGraph<VertexType>::depthFirst(const VertexType & root_data, Visitor && visitor) {
+    SearchWorkspace<VertexType> workspace;
+    return depthFirst(root_data, std::forward<Visitor>(visitor), workspace);
+}
+
+// @func   - depthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 any visitor (see Visitor.h), #3 the workspace to
+//           keep the bookkeeping of the search in
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - The stack and the marks live in the workspace, so a caller that reuses it doesn't allocate anything. The
+//           callbacks the visitor doesn't have are compiled out of the loop.
+template<class VertexType>
+template<class Visitor, class>
+bool uGraph<VertexType>::depthFirst(const VertexType & root_data, Visitor && visitor, SearchWorkspace<VertexType> & workspace) {
 
     AdjList<VertexType> * root_vert = findVertex(root_data);
-    AdjList<VertexType> * current_vertex = nullptr;
 
     if(root_vert == nullptr)
         return false;
 
-    // visit the new vertex
-    if(traveler) traveler->starting_vertex(root_data);
-
-    marked.insert(std::pair<VertexType, bool>(root_data, true));
-    q.push_back(root_vert->getVertex());
+    workspace.begin(list.size());
 
-    while(q.size()) {
+    // Our stack of vertex ids, stores the vertices as they appear to the search
+    std::vector<unsigned int> & stack = workspace.getFrontier();
 
-        Vertex<VertexType> * tempVert = q.back();q.pop_back();
-        current_vertex = findVertex(tempVert->getData());
+    // visit the new vertex
+    visitStartingVertex(visitor, root_data);
 
-        if(current_vertex == nullptr) return false;
+    unsigned int root = root_vert->getVertex()->getIndex();
+    workspace.reach(root);
+    stack.push_back(root);
 
-        // visit the node that we just popped off the stack
-        VertexType tempData = current_vertex->getVertex()->getData();
+    while(stack.size()) {
 
-        if(traveler && prev.size()) {
-            AdjList<VertexType> * last_vertex = findVertex(prev.at(tempData));
-            Edge<VertexType> * new_edge = last_vertex->getEdge(*current_vertex->getVertex());
-            if(new_edge) traveler->traverse_edge(*new_edge);
-        }
+        unsigned int current = stack.back(); stack.pop_back();
 
-        std::vector<Edge<VertexType> *> edges = current_vertex->getAllEdges();
+        // visit the node that we just popped off the stack, the workspace remembers the edge we took to get here
+        if(workspace.getEdge(current)) visitTraverseEdge(visitor, *workspace.getEdge(current));
 
-        for(auto edge : edges) {
+        for(auto edge : *list[current]->getEdgeList()) {
 
-            Vertex<VertexType> * tempVert = edge->getVertex();
-            VertexType tempData = tempVert->getData();
+            unsigned int target = edge->getTarget()->getIndex();
 
-            typename std::unordered_map<VertexType, bool>::const_iterator get = marked.find(tempData);
-
-            if(traveler) traveler->examine_edge(*edge);
+            visitExamineEdge(visitor, *edge);
 
             // if we haven't seen the target vertex for this edge
-            if(get == marked.end()) {
-                // add the source vertex for this target vertex to our map
-                prev.insert(std::pair<VertexType, VertexType>(tempData, edge->getSource()->getData()));
-
-                // mark the target vertex as seen
-                marked.insert(std::pair<VertexType, bool>(tempVert->getData(), true));
-
-                // push it into our queue
-                q.push_back(tempVert);
+            if(!workspace.isReached(target)) {
+                // remember how we got here, mark the target vertex as seen, and push it onto our stack
+                workspace.reach(target, current);
+                workspace.setEdge(target, edge);
+                stack.push_back(target);
             }
         }
 
     }
 
-    if(traveler) traveler->finished_traversal();
+    visitFinishedTraversal(visitor);
 
     return true;
 
@@ -863,207 +1052,297 @@ bool uGraph<VertexType>::depthFirst(const VertexType & root_data, GraphTraveler<
 //           components as they're discovered.
 // @return - Bool indicating if the function could find the starting vertex based on arg#1
 // @info   - Performs a breadth first traversal, calling the appropriate function inside of the Traveler class when
-//           it encounters a new vertex or edge. This function assumes that all vertex data is unique, so if this is
-//           a graph of strings, no two strings should be the same. This precondition allows us to use an
-//           std::unordered_map to keep track of the seen and unseen vertices.
+//           it encounters a new vertex or edge. All of the bookkeeping is done in flat vectors indexed by the
+//           dense vertex ids, so the vertex data is never hashed or compared while the search is running.
 template<class VertexType>
 bool uGraph<VertexType>::breadthFirst(const VertexType & root_data, GraphTraveler<VertexType> * traveler) {
+    SearchWorkspace<VertexType> workspace;
+    return breadthFirst(root_data, traveler, workspace);
+}
 
-    // Our queue object, stores the vertices as they appear to the search
-    std::deque<Vertex<VertexType> *> q;
+// @func   - breadthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components
+//           as they're discovered, #3 the workspace to keep the bookkeeping of the search in
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - Runs the visitor version below through a TravelerAdapter, or with no callbacks at all for a null traveler.
+template<class VertexType>
+bool uGraph<VertexType>::breadthFirst(const VertexType & root_data, GraphTraveler<VertexType> * traveler, SearchWorkspace<VertexType> & workspace) {
 
-    // A map that allows us to mark the vertices when they've been seen.
-    // maps a set of unique vertex data to a bool that is true if that data has been seen before
-    typename std::unordered_map<VertexType, bool> marked;
+    if(traveler == nullptr)
+        return breadthFirst(root_data, NullVisitor(), workspace);
 
-    // Maps a target vertex that is examined to the source vertex that we were at when we examined it
-    typename std::unordered_map<VertexType, VertexType> prev;
+    return breadthFirst(root_data, TravelerAdapter<VertexType>(*traveler), workspace);
+}
 
-    AdjList<VertexType> *  root_vert = findVertex(root_data);
-    AdjList<VertexType> *  current_vertex = nullptr;
+// @func   - breadthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 any visitor (see Visitor.h)
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+template<class VertexType>
+template<class Visitor, class>
+bool uGraph<VertexType>::breadthFirst(const VertexType & root_data, Visitor && visitor) {
+    SearchWorkspace<VertexType> workspace;
+    return breadthFirst(root_data, std::forward<Visitor>(visitor), workspace);
+}
+
+// @func   - breadthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 any visitor (see Visitor.h), #3 the workspace to
+//           keep the bookkeeping of the search in
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - The queue and the marks live in the workspace, so a caller that reuses it doesn't allocate anything. The
+//           callbacks the visitor doesn't have are compiled out of the loop.
+template<class VertexType>
+template<class Visitor, class>
+bool uGraph<VertexType>::breadthFirst(const VertexType & root_data, Visitor && visitor, SearchWorkspace<VertexType> & workspace) {
+
+    AdjList<VertexType> * root_vert = findVertex(root_data);
 
     if(root_vert == nullptr)
         return false;
 
-    // visit the start vertex
-    if(traveler) traveler->starting_vertex(root_data);
+    workspace.begin(list.size());
 
-    marked.insert(std::pair<VertexType, bool>(root_data, true));
-    q.push_back(root_vert->getVertex());
+    // Our queue of vertex ids, a vertex is enqueued at most once so a vector with a read position is all we need
+    std::vector<unsigned int> & queue = workspace.getFrontier();
 
-    while(q.size()) {
-
-        Vertex<VertexType> * tempVert = q.front();q.pop_front();
-        current_vertex = findVertex(tempVert->getData());
+    // visit the start vertex
+    visitStartingVertex(visitor, root_data);
 
-        if(current_vertex == nullptr)
-            return false;
+    unsigned int root = root_vert->getVertex()->getIndex();
+    workspace.reach(root, -1, 0);
+    queue.push_back(root);
 
-        VertexType tempData = current_vertex->getVertex()->getData();
+    for(unsigned int head = 0; head < queue.size(); head++) {
 
-        if(traveler) {
-            AdjList<VertexType> * last_vertex = findVertex(prev.at(tempData));
-            Edge<VertexType> * new_edge = last_vertex->getEdge(*current_vertex->getVertex());
-            if(new_edge) traveler->traverse_edge(*new_edge);
-        }
+        unsigned int current = queue[head];
 
-        std::vector<Edge<VertexType> *> edges = current_vertex->getAllEdges();
+        if(workspace.getEdge(current)) visitTraverseEdge(visitor, *workspace.getEdge(current));
 
         // Go through all of the edges associated with the current vertex
-        for(auto edge : edges) {
+        for(auto edge : *list[current]->getEdgeList()) {
 
-            Vertex<VertexType> * tempVert = edge->getVertex();
-            VertexType tempData = tempVert->getData();
-
-            typename std::unordered_map<VertexType, bool>::const_iterator get = marked.find(tempData);
+            unsigned int target = edge->getTarget()->getIndex();
 
             // examine the new edge
-            if(traveler) traveler->examine_edge(*edge);
-
-            // if the current vertex hasn't been seen
-            if(get == marked.end()) {
-                // add the source vertex for this target vertex to our map
-                prev.insert(std::pair<VertexType, VertexType>(tempData, edge->getSource()->getData()));
-                // mark the vertex
-                marked.insert(std::pair<VertexType, bool>(tempVert->getData(), true));
-                // enqueue the new vertex
-                q.push_back(tempVert);
+            visitExamineEdge(visitor, *edge);
+
+            // if the target vertex hasn't been seen
+            if(!workspace.isReached(target)) {
+                // remember how we got here and how many edges away it is, mark the vertex, and enqueue it
+                workspace.reach(target, current, workspace.getDistance(current) + 1);
+                workspace.setEdge(target, edge);
+                queue.push_back(target);
             }
 
         }
 
     }
 
-    if(traveler) traveler->finished_traversal();
+    visitFinishedTraversal(visitor);
 
     return true;
 }
 
-// @func   - minimumCut
-// @args   - none
-// @return - 2 column vector of vertices, each column representing one half of the cut.
-// @info   - Partitions the current graph into two subsets that have at the minmum number of edges between them.
-// @TODO   - Currently in beta-stage, needs to be tested and debugged. Is semi-working through.
+// @func   - breadthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 Traveler class to process the graph components as
+//           they're discovered, #3 which strategy to search with
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - The search itself runs over flat arrays, see BreadthFirst.h. Packing the adjacency lists costs
+//           O(V+E) per call, so a graph that is searched over and over should be frozen into a csrGraph first.
 template<class VertexType>
-std::vector<std::vector<VertexType> > uGraph<VertexType>::minimumCut() {
+bool uGraph<VertexType>::breadthFirst(const VertexType & root_data, GraphTraveler<VertexType> * traveler, const BreadthFirstOptions & options) {
 
-    srand(time(0));
-    int lowest = std::numeric_limits<int>::max();
-    std::vector<std::vector<VertexType> > ret;
-    std::vector< AdjList<VertexType> * > finalList;
+    if(options.strategy == BreadthFirstStrategy::TopDown)
+        return breadthFirst(root_data, traveler);
 
-    // the following are used to choose an edge to contract randomly
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    AdjList<VertexType> * root_vert = findVertex(root_data);
 
+    if(root_vert == nullptr)
+        return false;
 
-    for(int i = 0; i < 3; i++) {
+    unsigned int root = root_vert->getVertex()->getIndex();
 
-        std::unordered_map<VertexType, std::vector<VertexType> > collapsed;
+    std::vector<unsigned int> out_offsets, out_targets;
+    std::vector<double> out_weights;
+    packArcs(out_offsets, out_targets, out_weights);
 
-        std::vector< AdjList<VertexType> * > newList = list;
+    AdjacencyView out = { out_offsets.data(), out_targets.data(), out_weights.data() };
 
-        for(auto i : list) {
+    // every edge is stored in both directions, so the edges entering a vertex are the ones leaving it
+    AdjacencyView in = out;
 
-            collapsed.insert(std::pair<VertexType, std::vector<VertexType> >(i->getVertex()->getData(), std::vector<VertexType>()));
-            AdjList<VertexType> * newAdj = new AdjList<VertexType>();
-            newAdj->setVertex(i->getVertex()->getData());
-            newAdj->set_is_multi_graph(true);
+    std::vector<int> parent;
+    std::vector<double> parent_weight;
+    std::vector<unsigned int> order;
 
-            newList.push_back(newAdj);
+    directionOptimizingSearch(list.size(), out, in, root, options, parent, parent_weight, order);
 
-            std::vector<Edge<VertexType> *> edges = i->getAllEdges();
+    if(traveler) {
 
-            for(auto j : edges) {
-                newList.back()->addEdge(j->getVertex(), j->getWeight());
-            }
-        }
+        traveler->starting_vertex(root_data);
 
-        // While we haven't reduced the graph to 2 vertices
-        while(newList.size() > 2) {
+        for(unsigned int i = 1; i < order.size(); i++)
+            traveler->traverse_edge(Edge<VertexType>(list[parent[order[i]]]->getVertex(), list[order[i]]->getVertex(), parent_weight[order[i]]));
 
-            std::uniform_int_distribution<> dist_Vert(0, newList.size()-1);
-            int randVertex = dist_Vert(gen);
+        traveler->finished_traversal();
+    }
 
-            auto adj1 = newList[randVertex];
+    return true;
+}
+
+// @func   - parallelBreadthFirst
+// @args   - #1 Data associated with the starting vertex for the search, #2 distance output, #3 parent output, #4 the number
+//           of threads to search with (0 for one per hardware thread)
+// @return - Bool indicating if the function could find the starting vertex based on arg#1
+// @info   - Packs the adjacency lists into flat arrays and runs parallelBreadthFirstSearch over them, see BreadthFirst.h.
+template<class VertexType>
+bool uGraph<VertexType>::parallelBreadthFirst(const VertexType & root_data, std::vector<int> & distance, std::vector<int> & parent, unsigned int threads) const {
 
-            std::vector<Edge<VertexType> *> edges = adj1->getAllEdges();
+    AdjList<VertexType> * root_vert = findVertex(root_data);
 
-            if(!edges.size())
-                continue;
+    if(root_vert == nullptr)
+        return false;
 
-            std::uniform_int_distribution<> dist_Edges(0, edges.size()-1);
-            int randEdge = dist_Edges(gen);
+    std::vector<unsigned int> out_offsets, out_targets;
+    std::vector<double> out_weights;
+    packArcs(out_offsets, out_targets, out_weights);
 
-            AdjList<VertexType> * adj2 = nullptr;
+    AdjacencyView out = { out_offsets.data(), out_targets.data(), out_weights.data() };
+    parallelBreadthFirstSearch(list.size(), out, root_vert->getVertex()->getIndex(), threads, distance, parent);
 
+    return true;
+}
 
-            typename std::vector<AdjList<VertexType> *>::iterator vertToDelete;
-            for(typename std::vector<AdjList<VertexType> *>::iterator it = newList.begin() ; it != newList.end(); ++it) {
+// @func   - deltaStepping
+// @args   - #1 Data contained in the source vertex, #2 dist output, #3 prev output, #4 the bucket width and number of threads
+// @return - Bool indicating if the function could find the source vertex based on arg#1
+// @info   - Packs the adjacency lists into flat arrays and runs deltaSteppingSearch over them, see ShortestPath.h.
+template<class VertexType>
+bool uGraph<VertexType>::deltaStepping(const VertexType & source, std::vector<double> & dist, std::vector<int> & prev, const DeltaSteppingOptions & options) const {
 
-                AdjList<VertexType> * tempAdj = *it;
+    AdjList<VertexType> * src_vert = findVertex(source);
 
-                if(tempAdj->getVertex()->getData() ==  edges[randEdge]->getVertex()->getData()) {
-                    adj2 = tempAdj;
-                    vertToDelete = it;
-                    break;
-                }
-            }
+    if(src_vert == nullptr)
+        return false;
 
-            if(adj2 == nullptr) {
-                adj1->deleteEdge(edges[randEdge]->getVertex());
-                continue;
-            }
-            //
-            // std::cout << "mid";
-            // std::cout << adj1->getVertex()->getData() << " :: " << adj2->getVertex()->getData() << "\n";
-
-            std::vector<Edge<VertexType> *> edges2 = adj2->getAllEdges();
-
-            // std::cout << "mid2";
-            for(auto i : edges2) {
-                AdjList<VertexType> * tempAdj;
-                for(auto j : newList) {
-                    if(j->getVertex()->getData() == i->getVertex()->getData()) {
-                        tempAdj = j;
-                        break;
-                    }
-                }
-                adj1->addEdge(tempAdj->getVertex(), i->getWeight());
-            }
+    std::vector<unsigned int> out_offsets, out_targets;
+    std::vector<double> out_weights;
+    packArcs(out_offsets, out_targets, out_weights);
 
-            // std::cout << "mid3";
-
-            if(collapsed.find(adj1->getVertex()->getData()) != collapsed.end()) {
-                // std::cout << "t1";
-                collapsed.at(adj1->getVertex()->getData()).push_back(adj2->getVertex()->getData());
-                // std::cout << "t2";
-                auto delVert = collapsed.find(adj2->getVertex()->getData());
-                // std::cout << "t3";
-                if(delVert != collapsed.end()) {
-                    collapsed.erase(delVert);
-                    // std::cout << "t4";
-                }
-            }
+    AdjacencyView out = { out_offsets.data(), out_targets.data(), out_weights.data() };
+    deltaSteppingSearch(list.size(), out, src_vert->getVertex()->getIndex(), options, dist, prev);
 
-            newList.erase(vertToDelete);
-            // std::cout << "end\n";
-        }
+    return true;
+}
+
+// @func   - shortestPaths
+// @args   - #1 The (source, destination) pairs, #2 output, the answers, #3 the number of threads
+// @return - Bool, false if any of the vertices isn't in the graph
+// @info   - Looks every vertex up once, then hands the dense ids to batchShortestPaths, see ShortestPath.h.
+template<class VertexType>
+bool uGraph<VertexType>::shortestPaths(const std::vector<std::pair<VertexType, VertexType> > & queries, ShortestPathBatch & result, unsigned int threads) const {
+
+    std::vector<std::pair<unsigned int, unsigned int> > ids;
+    ids.reserve(queries.size());
+
+    for(auto & query : queries) {
+
+        int source = getVertexId(query.first), destination = getVertexId(query.second);
+
+        if(source == -1 || destination == -1)
+            return false;
+
+        ids.push_back(std::make_pair((unsigned int) source, (unsigned int) destination));
+    }
+
+    std::vector<unsigned int> out_offsets, out_targets;
+    std::vector<double> out_weights;
+    packArcs(out_offsets, out_targets, out_weights);
+
+    AdjacencyView out = { out_offsets.data(), out_targets.data(), out_weights.data() };
+    batchShortestPaths(list.size(), out, ids, threads, result);
+
+    return true;
+}
+
+// @func   - shortestPathTrees
+// @args   - #1 The sources, #2 output, the trees, #3 the number of threads
+// @return - Bool, false if any of the sources isn't in the graph
+// @info   - Looks every source up once, then hands the dense ids to batchShortestPathTrees, see ShortestPath.h.
+template<class VertexType>
+bool uGraph<VertexType>::shortestPathTrees(const std::vector<VertexType> & sources, ShortestPathTrees & result, unsigned int threads) const {
+
+    std::vector<unsigned int> ids;
+    ids.reserve(sources.size());
+
+    for(auto & source : sources) {
+
+        int id = getVertexId(source);
+
+        if(id == -1)
+            return false;
+
+        ids.push_back(id);
+    }
+
+    std::vector<unsigned int> out_offsets, out_targets;
+    std::vector<double> out_weights;
+    packArcs(out_offsets, out_targets, out_weights);
+
+    AdjacencyView out = { out_offsets.data(), out_targets.data(), out_weights.data() };
+    batchShortestPathTrees(list.size(), out, ids, threads, result);
+
+    return true;
+}
 
-        if(lowest > newList[0]->getAllEdges().size()) {
-            lowest = newList[0]->getAllEdges().size();
-            finalList = newList;
+// @func   - minimumCut
+// @args   - #1 Optional output, the total weight of the edges that cross the cut
+// @return - 2 column vector of vertices, each column representing one half of the cut.
+// @info   - Runs the Stoer-Wagner algorithm, see the version below that takes a MinimumCutOptions.
+template<class VertexType>
+std::vector<std::vector<VertexType> > uGraph<VertexType>::minimumCut(double * cut_weight) {
+    return minimumCut(cut_weight, MinimumCutOptions());
+}
+
+// @func   - minimumCut
+// @args   - #1 Optional output, the total weight of the edges that cross the cut, #2 which algorithm to use and how to run it
+// @return - 2 column vector of vertices, each column representing one half of the cut. Empty if the graph has fewer than
+//           two vertices.
+// @info   - Hands a flat array of the edges to the algorithm the options pick (see MinimumCut.h) and maps the side of
+//           every dense vertex id back to its data.
+template<class VertexType>
+std::vector<std::vector<VertexType> > uGraph<VertexType>::minimumCut(double * cut_weight, const MinimumCutOptions & options) {
+
+    std::vector<std::vector<VertexType> > ret;
+
+    if(cut_weight) *cut_weight = 0;
+
+    if(list.size() < 2)
+        return ret;
+
+    std::vector<WeightedArc> arcs;
+    arcs.reserve(num_edges);
+
+    // each edge is stored in both of its adjacency lists, only hand it over once
+    for(unsigned int i = 0; i < list.size(); i++) {
+        for(auto edge : *list[i]->getEdgeList()) {
+            unsigned int target = edge->getTarget()->getIndex();
+            if(target > i)
+                arcs.push_back(WeightedArc{i, target, edge->getWeight()});
         }
     }
-    uGraph<VertexType> * retGraph = new uGraph<VertexType>();
 
-    // retGraph->printGraph();
+    std::vector<bool> side;
+    double weight = 0;
+    if(options.algorithm == MinimumCutAlgorithm::KargerStein)
+        weight = kargerSteinCut(list.size(), arcs, side, options.trials, options.threads, options.seed);
+    else
+        weight = stoerWagnerCut(list.size(), arcs, side);
 
-    std::cout << "Vertex 1 " << finalList[0]->getVertex()->getData() << "\n\n\n";
-    std::cout << "Vertex 2 " << finalList[1]->getVertex()->getData() << "\n";
-    std::cout << "Edges " <<finalList[0]->getAllEdges().size() << "\n";
+    ret.resize(2);
+    for(unsigned int i = 0; i < list.size(); i++)
+        ret[side[i]].push_back(list[i]->getVertex()->getData());
 
-    delete(retGraph);
+    if(cut_weight) *cut_weight = weight;
 
     return ret;
 }
@@ -1071,79 +1350,136 @@ std::vector<std::vector<VertexType> > uGraph<VertexType>::minimumCut() {
 
 // @func   - minimuminSpanningTree
 // @args   - #1 GraphTraveler object that is used to build the minimum spanning tree
-// @return - Boolean that indicates if the minimum tree could be traversed or not, false if the graph is not strongly-connected
-// @info   - This function will traverse the graph is such an order as to build a minimum spanning tree, As of right now it requires
-//           that the graph be strongly connected, in-order to avoid an infinite loop. It also always starts at the first
-//           vertex inserted into the graph. It really should just take any vertex and create the minimum spanning tree of
-//           parts of the graph that are accessable to that specific vertex. That way we can have an accompanying function
-//           that computes a minimum spanning forest over the graphs vertices.
+// @return - Boolean that indicates if the minimum tree could be traversed or not, false if the graph is not connected
+// @info   - Runs Prim's algorithm, see the version below that takes a SpanningTreeOptions.
 template<class VertexType>
 bool uGraph<VertexType>::minimumSpanningTree(GraphTraveler<VertexType> * traveler) {
+    return minimumSpanningTree(traveler, SpanningTreeOptions());
+}
 
-    // A non strongly-connected graph cannot be spanned, without this we risk an infinite loop
-    if(!isConnected())
+// @func   - minimuminSpanningTree
+// @args   - #1 GraphTraveler object that is used to build the minimum spanning tree, #2 which algorithm to use and whether to
+//           build a spanning forest
+// @return - Boolean that indicates if the minimum tree could be traversed or not
+// @info   - Prim's algorithm keeps the cheapest known edge into every vertex outside of the tree in an IndexedHeap, so each step
+//           pops the next vertex instead of scanning every vertex for it. Kruskal's and Boruvka's algorithms are handed a flat
+//           list of the edges and the tree edges they pick are passed to the traveler afterwards.
+template<class VertexType>
+bool uGraph<VertexType>::minimumSpanningTree(GraphTraveler<VertexType> * traveler, const SpanningTreeOptions & options) {
+
+    // A non connected graph cannot be spanned by a single tree
+    if(!options.forest && !isConnected())
         return false;
 
-    std::unordered_map<VertexType, std::pair<VertexType, double> > set; // Map : Vertex --> (prev_vertex, path_weight)
-    std::unordered_map<VertexType, bool> mst_set;                       // Map : Vertex --> {true, false} : true if vertex is in our min-tree
-    double imax = std::numeric_limits<double>::infinity();
+    if(list.empty())
+        return true;
 
-    // Insert all vertices into the map with a weighting of infinity
-    for(int i = 0; i < list.size(); i++) {
-        VertexType tempData = list[i]->getVertex()->getData();
-        set.insert(std::pair<VertexType, std::pair<VertexType, double> >(tempData, std::pair<VertexType, double>(tempData, imax)));
-    }
+    if(options.algorithm == SpanningTreeAlgorithm::Prim) {
+
+        double imax = std::numeric_limits<double>::infinity();
 
-    // set the starting weight at the source to zero
-    set.at(list[0]->getVertex()->getData()).second = 0;
+        std::vector<double> weight(list.size(), imax);      // weight[i] - cheapest edge found so far that connects vertex i to the tree
+        std::vector<unsigned int> parent(list.size(), 0);   // parent[i] - the tree vertex on the other end of that edge
+        std::vector<bool> mst_set(list.size(), false);      // mst_set[i] - true if vertex i is in our min-tree
+        std::vector<bool> discovered(list.size(), false);   // discovered[i] - true once any edge to vertex i has been seen
+        IndexedHeap<double> queue(list.size());
 
-    Vertex<VertexType> * best_vertex = list[0]->getVertex(); // the new best vertex to add to our map
-    Vertex<VertexType> * last_vertex = best_vertex;          // the source vertex on the edge that will connec the new best_vertex
+        for(unsigned int root = 0; root < list.size(); root++) {
 
-    if(traveler) traveler->starting_vertex(best_vertex->getData());
+            if(mst_set[root])
+                continue;
+
+            // without a forest we only ever grow one tree, the connectivity check above means it reaches every vertex
+            if(root != 0 && !options.forest)
+                break;
+
+            if(traveler) {
+                if(root == 0) traveler->starting_vertex(list[root]->getVertex()->getData());
+                else traveler->discover_vertex(list[root]->getVertex()->getData());
+            }
 
-    while(mst_set.size() != list.size()) {
-        double lowest_weight = imax;        // lowest weight found this iteration
-        int index = 0;                      // index of the vertex with the lowest wieght found in our $list vector
+            weight[root] = 0;
+            parent[root] = root;
+            discovered[root] = true;
+            queue.push(root, 0.0);
 
-        // VERY inneficient! Here we scan linearly through all vertices to find the smallest, we need a priority queue!
-        for(int i = 0; i < list.size(); i++) {
+            while(!queue.empty()) {
 
-            if(mst_set.find(list[i]->getVertex()->getData()) == mst_set.end()) {
+                // Take the vertex with the smallest weight and mark it as connected to our min tree
+                unsigned int index = queue.pop();
+                mst_set[index] = true;
 
-                if(set.at(list[i]->getVertex()->getData()).second <= lowest_weight) {
-                    lowest_weight = set.at(list[i]->getVertex()->getData()).second;
-                    index = i;
+                // examine the new edge inserted into the minimum-tree
+                if(traveler && parent[index] != index) {
+                    Edge<VertexType> new_edge(list[parent[index]]->getVertex(), list[index]->getVertex(), weight[index]);
+                    traveler->traverse_edge(new_edge);
+                }
+
+                // Update the weighting of the vertices that are neighbors of the last vertex
+                for(auto edge : *list[index]->getEdgeList()) {
+                    if(traveler) traveler->examine_edge(*edge);
+
+                    unsigned int target = edge->getTarget()->getIndex();
+
+                    // the first edge to a vertex always counts, even an infinite one, or a vertex whose edges all have
+                    // infinite weight (what makeGraphDense gives without a weight function) would never join the tree
+                    if(!mst_set[target] && (!discovered[target] || edge->getWeight() < weight[target])) {
+                        discovered[target] = true;
+                        weight[target] = edge->getWeight();
+                        parent[target] = index;
+                        queue.pushOrDecrease(target, weight[target]);
+                    }
                 }
             }
         }
+    }
+    else {
 
-        best_vertex = list[index]->getVertex();// best vertex to choose to add to the min tree
-        last_vertex = findVertex(set.at(best_vertex->getData()).first)->getVertex();
-        // Take the vertex with the smallest weight and mark it as connected to our min tree
-        mst_set.insert(std::pair<VertexType, bool>(best_vertex->getData(), true));
+        std::vector<WeightedArc> arcs, tree;
+        UnionFind sets(list.size());
 
-        // examine the new edge inserted into the minimum-tree
-        if(traveler)  {
-            Edge<VertexType> new_edge(last_vertex, best_vertex, lowest_weight);
-            traveler->traverse_edge(new_edge);
-        }
+        arcs.reserve(num_edges);
+        tree.reserve(list.size()-1);
 
-        // Get all of that vertices neighbors
-        std::vector<Edge<VertexType> *> edges = list[index]->getAllEdges();
+        for(unsigned int i = 0; i < list.size(); i++) {
+            for(auto edge : *list[i]->getEdgeList()) {
+                unsigned int target = edge->getTarget()->getIndex();
 
-        // Update the weighting of the vertices that are neighbors of the last vertex
-        for(auto edge : edges) {
-            if(traveler)  {
-                Edge<VertexType> new_edge(edge->getSource(), edge->getTarget(), edge->getWeight());
-                traveler->examine_edge(new_edge);
-            }
+                // every edge is stored once in each direction, we only need one of them
+                if(target < i)
+                    continue;
 
-            if(edge->getWeight() <= set.at(edge->getTarget()->getData()).second) {
-                set.at(edge->getTarget()->getData()) = std::pair<VertexType, double>(list[index]->getVertex()->getData(), edge->getWeight());
+                arcs.push_back(WeightedArc{i, target, edge->getWeight()});
             }
         }
 
+        if(options.algorithm == SpanningTreeAlgorithm::Kruskal)
+            kruskalForest(arcs, sets, tree);
+        else if(options.threads == 1)
+            boruvkaForest(arcs, sets, tree);
+        else {
+            ConcurrentUnionFind shared_sets(list.size());
+            parallelBoruvkaForest(arcs, shared_sets, tree, options.threads);
+
+            // replay the tree edges so that sets knows which tree every vertex ended up in
+            for(auto & arc : tree)
+                sets.unite(arc.source, arc.target);
+        }
+
+        if(traveler) {
+
+            traveler->starting_vertex(list[0]->getVertex()->getData());
+
+            // one discover_vertex for every other tree, named by the root of its set
+            for(unsigned int i = 1; i < list.size(); i++)
+                if(sets.find(i) == i && !sets.connected(i, 0))
+                    traveler->discover_vertex(list[i]->getVertex()->getData());
+
+            for(auto & arc : tree) {
+                Edge<VertexType> new_edge(list[arc.source]->getVertex(), list[arc.target]->getVertex(), arc.weight);
+                traveler->traverse_edge(new_edge);
+            }
+        }
     }
 
     if(traveler) traveler->finished_traversal();
@@ -1159,115 +1495,175 @@ bool uGraph<VertexType>::minimumSpanningTree(GraphTraveler<VertexType> * travele
 //           path there from the source vertex.The second map takes a vertex and gives the total weight that
 //           it takes to get there from the source vertex.
 // @info   - Performs Dijkstra's path-finding algorithm to get from a starting vertex to any goal vertex in the
-//           map, throws an exception if the source vertex is not contained in the map.
+//           map, throws an exception if the source vertex is not contained in the map. The search itself runs over
+//           the dense vertex ids (see dijkstras), the results are only translated back into maps keyed by the vertex
+//           data here. If a destination is given only the vertices that were reached before it was found are in
+//           the maps, otherwise every vertex in the graph has a distance (infinity for unreachable vertices).
 template<class VertexType>
 typename uGraph<VertexType>::dist_prev_pair * uGraph<VertexType>::dijkstrasMinimumTree(const VertexType & source, const VertexType * dest) {
 
-    if(findVertex(source) == nullptr)
+    AdjList<VertexType> * src_vert = findVertex(source);
+
+    if(src_vert == nullptr)
         throw std::logic_error("Source Vertex Not in Graph\n");
 
-    double max_weight = std::numeric_limits<double>::infinity();
+    int dest_id = -1;
+    if(dest != nullptr) {
+        AdjList<VertexType> * dest_vert = findVertex(*dest);
+        if(dest_vert != nullptr) dest_id = dest_vert->getVertex()->getIndex();
+    }
 
-    // Convenient define, this pair will as the type of each entity in our priority queue (a std::set)
-    using vert_dist_pair = std::pair<double, VertexType>;
+    SearchWorkspace<VertexType> workspace;
+    dijkstras(src_vert->getVertex()->getIndex(), dest_id, workspace);
 
-    // Convenient syntax define, this set orders its elements based on our custom lambda function, which gives us a priority queue
-    // over the vertices and their distance from the source node
-    using priority_queue = std::set<vert_dist_pair, bool (*)(const vert_dist_pair & a, const vert_dist_pair & b) >;
+    // a pair of maps, this returns both the path between the nodes and the net weight along each path to the user-accessible interface function
+    typename uGraph<VertexType>::dist_prev_pair * ret = new uGraph<VertexType>::dist_prev_pair();
 
-    // This function takes two pairs<weight, Vertex> and does the comparison only on the weight, not the vertex data. This is passed
-    // into our std::set object to allow it to order the nodes according the lowest weight, which gives us a priority queue.
-    auto f = [](const std::pair<double, VertexType> & a, const std::pair<double, VertexType> & b) -> bool { return  a.first <= b.first; };
-    // auto f = [](const vert_dist_pair & a, const vert_dist_pair & b) -> bool { return  a.first-b.first < 0.000000001; };
+    for(unsigned int i = 0; i < list.size(); i++) {
 
-    // The priority queue object that we use to run the algorithm. This is really a std::set with a specific ordering function. This set consists
-    // of std::pairs, which is a pair of VertexData and a double value, which is the weight along the shortest path to reach that vertex that has
-    // so far been discovered. The ordering function orders the vertices in the set based off of the double value only.
-    priority_queue queue(f);
+        // when searching for a destination, leave out the vertices the search never got to
+        if(dest != nullptr && !workspace.isReached(i))
+            continue;
 
-    // a pair of maps, this returns both the path between the nodes and the net weight along each path to the user-accessible interface function
-    typename uGraph<VertexType>::dist_prev_pair *  ret = new uGraph<VertexType>::dist_prev_pair();
+        const VertexType & data = list[i]->getVertex()->getData();
+        ret->second.emplace(data, workspace.getDistance(i));
 
-    std::unordered_map<VertexType, double> dist;     // Maps a vertex to it's distance from the source vertex
-    std::unordered_map<VertexType, VertexType> prev; // Maps a given vertex to the previous vertex that we took to get there
-    std::unordered_map<VertexType, bool> scanned;    // Maps a given vertex to a bool, letting us know if we have examine all of it's neighbors.
+        if(workspace.getPrevious(i) != -1)
+            ret->first.emplace(data, list[workspace.getPrevious(i)]->getVertex()->getData());
+    }
 
-    // dist.reserve(getNumVertices());
-    // prev.reserve(getNumVertices());
-    // scanned.reserve(getNumVertices());
+    return ret;
+}
 
-    for(auto & vertex : list) { // Initialize the distances to infinity for all vertices
-        dist.insert(std::make_pair(vertex->getVertex()->getData(), max_weight));
-        queue.insert(std::make_pair(dist.at(vertex->getVertex()->getData()), vertex->getVertex()->getData()));
-        scanned.insert(std::pair<VertexType,bool>(vertex->getVertex()->getData(), false));
-    }
+// @func   - dijkstrasMinimumTree
+// @args   - #1 Data contained in starting vertex for search, #2 the workspace to leave the results in, #3 optional
+//           destination vertex, if null we will find the path to every node otherwise we stop when we find it
+// @info   - Runs the same search as the version above but leaves the distances and predecessors in the workspace, where
+//           they are read by dense vertex id (see getVertexId) with getDistance and getPrevious. Nothing is allocated
+//           once the workspace is big enough for the graph. Throws an exception if the source vertex is not in the graph.
+template<class VertexType>
+void uGraph<VertexType>::dijkstrasMinimumTree(const VertexType & source, SearchWorkspace<VertexType> & workspace, const VertexType * dest) {
 
-    queue.erase(std::make_pair(dist.at(source), source));
-    dist.at(source) = 0;
-    queue.insert(std::make_pair(dist.at(source), source));
+    AdjList<VertexType> * src_vert = findVertex(source);
 
-    while(!queue.empty()) {
+    if(src_vert == nullptr)
+        throw std::logic_error("Source Vertex Not in Graph\n");
 
-        double current_dist = queue.begin()->first;
+    int dest_id = dest == nullptr ? -1 : getVertexId(*dest);
 
-        AdjList<VertexType> * current_vert = findVertex(queue.begin()->second);
-        if(dest != nullptr && current_vert->getVertex()->getData() == *dest) {
-            break;
-        }
-        queue.erase(queue.begin());
-        scanned.at(current_vert->getVertex()->getData()) = true;
+    dijkstras(src_vert->getVertex()->getIndex(), dest_id, workspace);
+}
 
-        // get the incident edges for the current vertex
-        auto edges = current_vert->getEdgeList();
+// @func   - dijkstrasShortestPath
+// @args   - #1 Source Vertex, #2 Dest Vertex, #3 the GraphTraveler-derived object that will recieve the vertices and edges in minimum order
+// @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+// @info   - This function is intended for the user to call to compute the shortest path between any two vertices. This function calls
+//           the dijkstras(...) function and decodes the output to give the user the specific path they are looking for, as opposed to a
+//           structure that contains the shortest path from the source vertex to any vertex in the map.
+template<class VertexType>
+bool uGraph<VertexType>::dijkstrasShortestPath(const VertexType & src, const VertexType & dest, GraphTraveler<VertexType> * traveler) {
+    SearchWorkspace<VertexType> workspace;
+    return dijkstrasShortestPath(src, dest, traveler, workspace);
+}
 
-        // cycle through these edges and adjust the path weighting associated with the target vertex
-        // if it is lower than the current shortest path to that vertex
-        for(auto & edge : *edges) {
-            if(scanned.at(edge->getTarget()->getData())) continue;
+// @func   - dijkstrasShortestPath
+// @args   - #1 Source Vertex, #2 Dest Vertex, #3 the GraphTraveler-derived object that will recieve the vertices and edges in
+//           minimum order, #4 the workspace to run the search in
+// @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+// @info   - Runs the visitor version below through a TravelerAdapter, or with no callbacks at all for a null traveler.
+template<class VertexType>
+bool uGraph<VertexType>::dijkstrasShortestPath(const VertexType & src, const VertexType & dest, GraphTraveler<VertexType> * traveler, SearchWorkspace<VertexType> & workspace) {
 
-            VertexType temp_data = edge->getTarget()->getData();
+    if(traveler == nullptr)
+        return dijkstrasShortestPath(src, dest, NullVisitor(), workspace);
 
-            double temp_weight = edge->getWeight() + current_dist;
+    return dijkstrasShortestPath(src, dest, TravelerAdapter<VertexType>(*traveler), workspace);
+}
 
-            if(temp_weight < dist.at(temp_data)) {
-                queue.erase(std::make_pair(dist.at(temp_data), temp_data));
-                dist.at(temp_data) = temp_weight;
-                if(prev.find(temp_data) == prev.end())
-                    prev.emplace(temp_data, current_vert->getVertex()->getData());
-                else
-                    prev.at(temp_data) = current_vert->getVertex()->getData();
-                queue.insert(std::make_pair(dist.at(temp_data), temp_data));
-            }
+// @func   - dijkstrasShortestPath
+// @args   - #1 Source Vertex, #2 Dest Vertex, #3 any visitor (see Visitor.h) to hand the path to
+// @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+template<class VertexType>
+template<class Visitor, class>
+bool uGraph<VertexType>::dijkstrasShortestPath(const VertexType & src, const VertexType & dest, Visitor && visitor) {
+    SearchWorkspace<VertexType> workspace;
+    return dijkstrasShortestPath(src, dest, std::forward<Visitor>(visitor), workspace);
+}
 
-        }
+// @func   - dijkstrasShortestPath
+// @args   - #1 Source Vertex, #2 Dest Vertex, #3 any visitor (see Visitor.h) to hand the path to, #4 the workspace to run the
+//           search in
+// @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
+// @info   - The search and the path it finds are kept in the workspace, so a caller that reuses it doesn't allocate anything.
+template<class VertexType>
+template<class Visitor, class>
+bool uGraph<VertexType>::dijkstrasShortestPath(const VertexType & src, const VertexType & dest, Visitor && visitor, SearchWorkspace<VertexType> & workspace) {
+
+    AdjList<VertexType> * src_vert = findVertex(src);
+    AdjList<VertexType> * dest_vert = findVertex(dest);
+
+    if(src_vert == nullptr || dest_vert == nullptr)
+        throw std::logic_error("SRC or DEST Vertices Do Not Exist in Graph\n");
+
+    unsigned int src_id = src_vert->getVertex()->getIndex();
+    unsigned int dest_id = dest_vert->getVertex()->getIndex();
 
+    if(src_id == dest_id) {
+        visitStartingVertex(visitor, src);
+        visitFinishedTraversal(visitor);
+        return true;
     }
 
-    ret->first = prev;
-    ret->second = dist;
+    dijkstras(src_id, dest_id, workspace);
 
-    return ret;
+    if(workspace.getPrevious(dest_id) == -1)
+        return false;
+
+    visitStartingVertex(visitor, src);
+
+    // the path only has to be walked for a visitor that wants its edges
+    if(HasTraverseEdge<typename std::remove_reference<Visitor>::type, Edge<VertexType> >::value) {
+
+        // walk the predecessors back from the destination to get the path in reverse order, the search is done with the
+        // frontier so it can hold the path
+        std::vector<unsigned int> & path = workspace.getFrontier();
+        path.clear();
+        for(int current = dest_id; current != -1; current = workspace.getPrevious(current))
+            path.push_back(current);
+
+        for(int i = path.size()-1; i > 0; --i) {
+
+            Edge<VertexType> * next_edge = list[path[i]]->getEdge(*list[path[i-1]]->getVertex());
+
+            if(next_edge == nullptr)
+                return false;
+
+            visitTraverseEdge(visitor, *next_edge);
+        }
+    }
+
+    visitFinishedTraversal(visitor);
+
+    return true;
 }
 
-// @func   - dijkstrasShortestPath
+// @func   - bidirectionalShortestPath
 // @args   - #1 Source Vertex, #2 Dest Vertex, #3 the GraphTraveler-derived object that will recieve the vertices and edges in minimum order
 // @return - bool indicating success, will return false for graphs with no connection between src and dest vertices.
-// @info   - This function is intended for the user to call to compute the shortest path between any two vertices. This function calls
-//           the dijkstras(...) function and decodes the output to give the user the specific path they are looking for, as opposed to a
-//           structure that contains the shortest path from the source vertex to any vertex in the map.
+// @info   - Same contract as dijkstrasShortestPath, the search itself is done by bidirectional(...).
 template<class VertexType>
-bool uGraph<VertexType>::dijkstrasShortestPath(const VertexType & src, const VertexType & dest, GraphTraveler<VertexType> * traveler) {
+bool uGraph<VertexType>::bidirectionalShortestPath(const VertexType & src, const VertexType & dest, GraphTraveler<VertexType> * traveler) {
 
-    std::unordered_map<VertexType, VertexType> *  prev; // Maps a vertex to the previous vertex that was taken to get there
-    std::unordered_map<VertexType, double>  * dist;     // Maps a Vertex to the net weight along the path from the src to this vertex
-    std::vector<VertexType> path;
-    std::pair<std::vector<VertexType>, double> ret;
+    AdjList<VertexType> * src_vert = findVertex(src);
+    AdjList<VertexType> * dest_vert = findVertex(dest);
 
-    if(findVertex(src) == nullptr || findVertex(dest) == nullptr)
+    if(src_vert == nullptr || dest_vert == nullptr)
         throw std::logic_error("SRC or DEST Vertices Do Not Exist in Graph\n");
 
-    if(src == dest) {
-        path.push_back(dest);
+    unsigned int src_id = src_vert->getVertex()->getIndex();
+    unsigned int dest_id = dest_vert->getVertex()->getIndex();
+
+    if(src_id == dest_id) {
         if(traveler != nullptr) {
             traveler->starting_vertex(src);
             traveler->finished_traversal();
@@ -1275,64 +1671,136 @@ bool uGraph<VertexType>::dijkstrasShortestPath(const VertexType & src, const Ver
         return true;
     }
 
-    typename uGraph<VertexType>::dist_prev_pair * the_pair = dijkstrasMinimumTree(src, &dest);
-    prev = &the_pair->first;
-    dist = &the_pair->second;
-
-
-    VertexType prev_vert = dest;
-    path.push_back(dest);
-    int count = 0;
-    while(prev_vert != src && count < 2*list.size()) {
-
-        if(prev->find(prev_vert) == prev->end()) {
-            return false;//std::pair<std::vector<VertexType>, double>();
-        }
-        prev_vert = prev->at(prev_vert);
-        path.push_back(prev_vert);
-        count++;
-    }
+    std::vector<unsigned int> path;
 
-    if(!path.size())
+    if(!bidirectional(src_id, dest_id, path))
         return false;
 
     if(traveler != nullptr) {
 
-        VertexType current = *(path.end()-1);
-        VertexType last = current;
-        traveler->starting_vertex(current);
+        traveler->starting_vertex(src);
 
-        for(int i = path.size()-2; i >= 0; --i) {
-            current = path[i];
+        for(unsigned int i = 0; i+1 < path.size(); i++) {
 
-            if(!containsEdge(last, current))
-                return false;
+            Edge<VertexType> * next_edge = list[path[i]]->getEdge(*list[path[i+1]]->getVertex());
 
-            Edge<VertexType> next_edge = *(findVertex(last)->getEdge(current));
+            if(next_edge == nullptr)
+                return false;
 
-            traveler->traverse_edge(next_edge);
-            last = current;
+            traveler->traverse_edge(*next_edge);
         }
 
         traveler->finished_traversal();
     }
 
-    delete(the_pair);
-
     return true;
 }
 
 // @func   - aStar
-// @args   - #1 Data contained in starting vertex for search,  #2 Pointer to a hueristic function on a given node
+// @args   - #1 Data contained in starting vertex for search, #2 Vector of possible goal vertices to reach, #3 Pointer to a
+//           hueristic function on a given node, nullptr turns the search into Dijkstra's algorithm
 // @return - Vector containing, in-order, the vertices to take to reach your goal. Empty if you are there or no path exists.
 // @info   - Performs the A* path-finding algorithm to get from a starting vertex to any goal vertex in a list of vertices.
 template<class VertexType>
-std::vector<VertexType> uGraph<VertexType>::aStar(const VertexType &, std::vector<VertexType>, double hueristic(VertexType&, VertexType&)) {
+std::vector<VertexType> uGraph<VertexType>::aStar(const VertexType & start, std::vector<VertexType> goals, double hueristic(VertexType&, VertexType&)) {
+
+    if(hueristic == nullptr)
+        return aStar(start, goals, [](VertexType &, VertexType &) { return 0.0; });
+
+    return aStar<double (*)(VertexType&, VertexType&)>(start, goals, hueristic);
+}
+
+// @func   - aStar
+// @args   - #1 Data contained in starting vertex for search, #2 Vector of possible goal vertices to reach, #3 Any callable
+//           taking (VertexType&, VertexType&) that estimates the distance from a vertex to a goal, #4 optional pointer
+//           that gets the number of vertices the search expanded
+// @return - Vector containing, in-order, the vertices to take to reach the closest goal (not including the start).
+// @info   - This is Dijkstra's algorithm over the dense vertex ids with every priority raised by the estimate of the vertex,
+//           the estimate is only computed once per vertex, the first time the search reaches it.
+template<class VertexType>
+template<class Heuristic, class>
+std::vector<VertexType> uGraph<VertexType>::aStar(const VertexType & start, const std::vector<VertexType> & goals, Heuristic hueristic, unsigned int * expanded) {
+
+    std::vector<VertexType> path;
+
+    if(expanded != nullptr)
+        *expanded = 0;
+
+    AdjList<VertexType> * source = findVertex(start);
+
+    if(source == nullptr)
+        return path;
+
+    unsigned int src = source->getVertex()->getIndex();
+
+    std::vector<bool> is_goal(list.size(), false);
+    std::vector<VertexType> goal_data;
+
+    for(auto & goal : goals) {
+        AdjList<VertexType> * adj = findVertex(goal);
+        int id = (adj == nullptr) ? -1 : adj->getVertex()->getIndex();
+        if(id != -1 && !is_goal[id]) {
+            is_goal[id] = true;
+            goal_data.push_back(goal);
+        }
+    }
+
+    // we are either already there or there is nowhere to go
+    if(goal_data.empty() || is_goal[src])
+        return path;
+
+    // the heuristic takes non-const references to match the GraphInterface signature, it shouldn't modify the vertex
+    auto estimate = [&](unsigned int id) -> double {
+        VertexType & data = const_cast<VertexType &>(list[id]->getVertex()->getData());
+        double best = std::numeric_limits<double>::infinity();
+        for(auto & goal : goal_data)
+            best = std::min(best, (double) hueristic(data, goal));
+        return best;
+    };
+
+    std::vector<double> dist(list.size(), std::numeric_limits<double>::infinity());
+    std::vector<double> guess(list.size(), 0.0);
+    std::vector<int> prev(list.size(), -1);
+    IndexedHeap<double> queue(list.size());
+
+    dist[src] = 0;
+    guess[src] = estimate(src);
+    queue.push(src, guess[src]);
+
+    while(!queue.empty()) {
+
+        unsigned int current = queue.pop();
+
+        if(expanded != nullptr)
+            (*expanded)++;
+
+        if(is_goal[current]) {
+            for(int at = current; at != (int) src; at = prev[at])
+                path.push_back(list[at]->getVertex()->getData());
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
 
-     // #TODO - Implement A* Path-finding algorithm
+        for(auto edge : *list[current]->getEdgeList()) {
 
-    return std::vector<VertexType>();
+            unsigned int target = edge->getTarget()->getIndex();
+            double temp_weight = dist[current] + edge->getWeight();
 
+            if(temp_weight < dist[target]) {
+
+                // first time we've seen this vertex
+                if(dist[target] == std::numeric_limits<double>::infinity())
+                    guess[target] = estimate(target);
+
+                // an inconsistent heuristic can make us reopen an expanded vertex, pushOrDecrease handles both cases
+                dist[target] = temp_weight;
+                prev[target] = current;
+                queue.pushOrDecrease(target, temp_weight + guess[target]);
+            }
+        }
+    }
+
+    return path;
 }
 
 
@@ -1340,6 +1808,32 @@ std::vector<VertexType> uGraph<VertexType>::aStar(const VertexType &, std::vecto
 /////////////////////////         PRIVATE FUNCTIONS        //////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+// @func   - copyFrom
+// @args   - #1 The graph to copy the vertices and edges of
+// @info   - The other graph is read through its views. Every vertex is inserted in id order, so it gets the same id it has in
+//           the other graph, and the edges are then appended by id in the order the other graph stores them, which skips the
+//           lookups and duplicate checks of insertEdge and leaves the copy comparing equal to the original.
+template<class VertexType>
+void uGraph<VertexType>::copyFrom(const uGraph<VertexType> & toCopy) {
+
+    VertexView<VertexType> their_vertices = toCopy.getVertices();
+
+    for(auto & vertex : their_vertices)
+        insertVertex(vertex);
+
+    for(auto vertex = their_vertices.begin(); vertex != their_vertices.end(); ++vertex) {
+        NeighborView<VertexType> edges = vertex.neighbors();
+        AdjList<VertexType> * adj = list[vertex.id()];
+
+        for(auto edge = edges.begin(); edge != edges.end(); ++edge) {
+            adj->appendEdge(list[edge.targetId()]->getVertex(), edge.weight());
+        }
+    }
+
+    num_edges = toCopy.num_edges;
+    components_valid = false;
+}
+
 // @func   - findVertex
 // @args   - #1 Value contained in the vertex to be found
 // @return - Pointer to the AdjList containing the vertex in queston. nullptr if not found (possibly should throw exception?)
@@ -1355,3 +1849,173 @@ AdjList<VertexType> * uGraph<VertexType>::findVertex(const VertexType & data) co
 
     return get->second;
  }
+
+// @func   - packArcs
+// @args   - #1 output offsets, #2 output targets, #3 output weights
+// @info   - Packs the adjacency lists into flat arrays, the edges leaving vertex i are at [offsets[i], offsets[i+1]).
+template<class VertexType>
+void uGraph<VertexType>::packArcs(std::vector<unsigned int> & out_offsets, std::vector<unsigned int> & out_targets, std::vector<double> & out_weights) const {
+
+    out_offsets.assign(list.size()+1, 0);
+    out_targets.clear();
+    out_weights.clear();
+    out_targets.reserve(2*num_edges);
+    out_weights.reserve(2*num_edges);
+
+    for(unsigned int i = 0; i < list.size(); i++) {
+        for(auto edge : *list[i]->getEdgeList()) {
+            out_targets.push_back(edge->getTarget()->getIndex());
+            out_weights.push_back(edge->getWeight());
+        }
+        out_offsets[i+1] = out_targets.size();
+    }
+}
+
+// @func   - buildComponents
+// @info   - Rebuilds the components from scratch if they are out of date, O(V+E).
+template<class VertexType>
+void uGraph<VertexType>::buildComponents() const {
+
+    if(components_valid)
+        return;
+
+    components.reset(list.size());
+
+    // each edge is in both of its adjacency lists, uniting it from one side is enough
+    for(unsigned int i = 0; i < list.size(); i++) {
+        for(auto edge : *list[i]->getEdgeList()) {
+            unsigned int target = edge->getTarget()->getIndex();
+            if(target > i)
+                components.unite(i, target);
+        }
+    }
+
+    components_valid = true;
+}
+
+// @func   - dijkstras
+// @args   - #1 id of the source vertex, #2 id of the destination vertex (-1 for none), #3 the workspace to leave the
+//           distances and predecessors in
+// @info   - Uses an IndexedHeap keyed on the vertex ids, vertices are pushed when they are first discovered and their
+//           entry is decreased in place when a shorter path is found, so the heap never holds more than V entries.
+template<class VertexType>
+void uGraph<VertexType>::dijkstras(unsigned int src, int dest, SearchWorkspace<VertexType> & workspace) const {
+
+    workspace.begin(list.size());
+    IndexedHeap<double> & queue = workspace.getHeap();
+
+    workspace.reach(src, -1, 0);
+    queue.push(src, 0.0);
+
+    while(!queue.empty()) {
+
+        unsigned int current = queue.pop();
+
+        if((int) current == dest)
+            break;
+
+        workspace.scan(current);
+
+        // cycle through the edges and adjust the path weighting associated with the target vertex
+        // if it is lower than the current shortest path to that vertex
+        for(auto edge : *list[current]->getEdgeList()) {
+
+            unsigned int target = edge->getTarget()->getIndex();
+            double temp_weight = workspace.getDistance(current) + edge->getWeight();
+
+            if(!workspace.isScanned(target) && temp_weight < workspace.getDistance(target)) {
+                workspace.reach(target, current, temp_weight);
+                queue.pushOrDecrease(target, temp_weight);
+            }
+        }
+    }
+}
+
+// @func   - bidirectional
+// @args   - #1 id of the source vertex, #2 id of the destination vertex, #3 output, the ids along the path from source to destination
+// @return - False if there is no path
+// @info   - Runs one Dijkstra search forward from the source and one backward from the destination, always advancing the one with
+//           the smaller queue. Every time an edge is relaxed we check whether it joins the two searches into a shorter path than the
+//           best one so far, and we stop as soon as the smallest keys left in the two queues add up to at least that path.
+template<class VertexType>
+bool uGraph<VertexType>::bidirectional(unsigned int src, unsigned int dest, std::vector<unsigned int> & path) const {
+
+    const double infinity = std::numeric_limits<double>::infinity();
+    unsigned int size = list.size();
+
+    // index 0 is the forward search from src, index 1 is the backward search from dest
+    std::vector<double> dist[2] = { std::vector<double>(size, infinity), std::vector<double>(size, infinity) };
+    std::vector<int> prev[2] = { std::vector<int>(size, -1), std::vector<int>(size, -1) };
+    std::vector<bool> scanned[2] = { std::vector<bool>(size, false), std::vector<bool>(size, false) };
+    IndexedHeap<double> queue[2] = { IndexedHeap<double>(size), IndexedHeap<double>(size) };
+
+    dist[0][src] = 0;
+    dist[1][dest] = 0;
+    queue[0].push(src, 0.0);
+    queue[1].push(dest, 0.0);
+
+    double best = infinity;
+    int meet = -1;
+
+    while(!queue[0].empty() && !queue[1].empty()) {
+
+        if(queue[0].topPriority() + queue[1].topPriority() >= best)
+            break;
+
+        int side = (queue[0].size() <= queue[1].size()) ? 0 : 1;
+        unsigned int current = queue[side].pop();
+        scanned[side][current] = true;
+
+        auto relax = [&](unsigned int target, double weight) {
+
+            double temp_weight = dist[side][current] + weight;
+
+            if(!scanned[side][target] && temp_weight < dist[side][target]) {
+                dist[side][target] = temp_weight;
+                prev[side][target] = current;
+                queue[side].pushOrDecrease(target, temp_weight);
+            }
+
+            // the other search has already been here, so this is a complete path
+            if(dist[side][target] + dist[1-side][target] < best) {
+                best = dist[side][target] + dist[1-side][target];
+                meet = target;
+            }
+        };
+
+        // the graph is undirected, so both searches walk the same edges
+        for(auto edge : *list[current]->getEdgeList())
+            relax(edge->getTarget()->getIndex(), edge->getWeight());
+    }
+
+    if(meet == -1)
+        return false;
+
+    path.clear();
+
+    for(int current = meet; current != -1; current = prev[0][current])
+        path.push_back(current);
+
+    std::reverse(path.begin(), path.end());
+
+    for(int current = prev[1][meet]; current != -1; current = prev[1][current])
+        path.push_back(current);
+
+    return true;
+}
+
+// @func   - findOrInsertVertex
+// @args   - #1 Value contained in the vertex to be found
+// @return - pointer to the AdjList of the vertex, which is inserted first if it isn't already in the graph
+template<class VertexType>
+AdjList<VertexType> * uGraph<VertexType>::findOrInsertVertex(const VertexType & data) {
+
+    AdjList<VertexType> * adj = findVertex(data);
+
+    if(adj != nullptr)
+        return adj;
+
+    insertVertex(data);
+
+    return list.back();
+}
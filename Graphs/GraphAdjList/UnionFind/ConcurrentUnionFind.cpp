@@ -0,0 +1,90 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - ConcurrentUnionFind.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the ConcurrentUnionFind class. The class isn't a template, so everything in here
+*               is marked inline to keep the header-only layout the rest of the project uses.
+**/
+
+#include "ConcurrentUnionFind.h"
+
+// @func - Constructor
+// @args - #1 The number of elements, each element starts out in a set by itself
+inline ConcurrentUnionFind::ConcurrentUnionFind(unsigned int n) : num_elements(0) {
+    reset(n);
+}
+
+// @func - reset
+// @args - #1 The new number of elements
+// @info - Puts every element back into a set by itself, this must not run at the same time as anything else
+inline void ConcurrentUnionFind::reset(unsigned int n) {
+
+    if(n != num_elements)
+        parent.reset(new std::atomic<unsigned int>[n]);
+
+    num_elements = n;
+
+    for(unsigned int i = 0; i < n; i++)
+        parent[i].store(i, std::memory_order_relaxed);
+}
+
+// @func   - find
+// @args   - #1 An element in the range [0, size())
+// @return - The root of the set that the element is in at the time of the call
+inline unsigned int ConcurrentUnionFind::find(unsigned int x) {
+
+    while(true) {
+
+        unsigned int up = parent[x].load(std::memory_order_acquire);
+
+        if(up == x)
+            return x;
+
+        // path halving, if another thread changed our parent in the mean time we just skip the shortcut
+        unsigned int grand = parent[up].load(std::memory_order_acquire);
+
+        if(grand != up)
+            parent[x].compare_exchange_weak(up, grand, std::memory_order_release, std::memory_order_relaxed);
+
+        x = grand;
+    }
+}
+
+// @func   - unite
+// @args   - #1 An element, #2 another element
+// @return - Bool, false if the two elements were already in the same set
+inline bool ConcurrentUnionFind::unite(unsigned int a, unsigned int b) {
+
+    while(true) {
+
+        a = find(a);
+        b = find(b);
+
+        if(a == b)
+            return false;
+
+        // always hang the larger root under the smaller one
+        if(a < b)
+            std::swap(a, b);
+
+        unsigned int expected = a;
+
+        // fails if another thread already linked a somewhere, in which case we try again from the new roots
+        if(parent[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel))
+            return true;
+    }
+}
+
+// @func   - connected
+// @args   - #1 An element, #2 another element
+// @return - True if the two elements are in the same set, only reliable once no other thread is uniting
+inline bool ConcurrentUnionFind::connected(unsigned int a, unsigned int b) {
+    return find(a) == find(b);
+}
+
+// @func   - size
+// @return - The number of elements
+inline unsigned int ConcurrentUnionFind::size() const {
+    return num_elements;
+}
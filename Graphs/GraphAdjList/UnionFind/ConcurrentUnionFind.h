@@ -0,0 +1,73 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - ConcurrentUnionFind.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the declaration of the ConcurrentUnionFind class, a disjoint set forest over the integers [0, size)
+*               that any number of threads can find and unite in at the same time without taking a lock. The parallel
+*               spanning forest algorithm uses it to contract the trees that its worker threads have joined.
+*
+*   @Details  - The parent pointers are atomics. Roots are always linked under a root with a SMALLER index, which means a
+*               parent pointer can only ever point down the index range and the forest can never grow a cycle no matter how
+*               the unites interleave. A unite links its two roots with a compare-and-swap on the parent of the larger root,
+*               if another thread got there first the swap fails and the unite simply retries from the new roots. find
+*               halves the path it walks like the sequential UnionFind does, a lost race there only costs a shortcut.
+*               Linking by index instead of by size gives up the size bound on the height of the trees, but path halving
+*               keeps them shallow in practice. Sizes and set counts aren't tracked, they would need a second atomic update
+*               that can't be made atomic with the link.
+**/
+
+#ifndef CONCURRENT_UNION_FIND_H
+#define CONCURRENT_UNION_FIND_H
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+class ConcurrentUnionFind
+{
+public:
+
+    // @func - Constructor
+    // @args - #1 The number of elements, each element starts out in a set by itself
+    ConcurrentUnionFind(unsigned int = 0);
+
+    // @func - reset
+    // @args - #1 The new number of elements
+    // @info - Puts every element back into a set by itself, this must not run at the same time as anything else
+    void reset(unsigned int);
+
+    // @func   - find
+    // @args   - #1 An element in the range [0, size())
+    // @return - The root of the set that the element is in at the time of the call
+    unsigned int find(unsigned int);
+
+    // @func   - unite
+    // @args   - #1 An element, #2 another element
+    // @return - Bool, false if the two elements were already in the same set. When two threads unite the same pair only one
+    //           of them gets true back.
+    bool unite(unsigned int, unsigned int);
+
+    // @func   - connected
+    // @args   - #1 An element, #2 another element
+    // @return - True if the two elements are in the same set, only reliable once no other thread is uniting
+    bool connected(unsigned int, unsigned int);
+
+    // @func   - size
+    // @return - The number of elements
+    unsigned int size() const;
+
+private:
+
+    // @member - parent
+    // @info   - The parent of each element, roots are their own parent and every other element points at a smaller index
+    std::unique_ptr<std::atomic<unsigned int>[]> parent;
+
+    // @member - num_elements
+    // @info   - The length of the parent array
+    unsigned int num_elements;
+
+};
+
+#include "ConcurrentUnionFind.cpp"
+#endif
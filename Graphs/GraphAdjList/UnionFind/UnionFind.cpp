@@ -0,0 +1,102 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - UnionFind.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the UnionFind class. The class isn't a template, so everything in here is marked
+*               inline to keep the header-only layout the rest of the project uses.
+**/
+
+#include "UnionFind.h"
+
+// @func - Constructor
+// @args - #1 The number of elements, each element starts out in a set by itself
+inline UnionFind::UnionFind(unsigned int n) : num_sets(0) {
+    reset(n);
+}
+
+// @func - reset
+// @args - #1 The new number of elements
+// @info - Puts every element back into a set by itself
+inline void UnionFind::reset(unsigned int n) {
+
+    parent.resize(n);
+    set_size.assign(n, 1);
+    num_sets = n;
+
+    for(unsigned int i = 0; i < n; i++)
+        parent[i] = i;
+}
+
+// @func   - add
+// @return - The new element, which starts out in a set by itself
+inline unsigned int UnionFind::add() {
+
+    parent.push_back(parent.size());
+    set_size.push_back(1);
+    num_sets++;
+
+    return parent.size() - 1;
+}
+
+// @func   - find
+// @args   - #1 An element in the range [0, size())
+// @return - The root of the set that the element is in
+inline unsigned int UnionFind::find(unsigned int x) {
+
+    // path halving, every element we pass ends up pointing at its old grandparent
+    while(parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+
+    return x;
+}
+
+// @func   - unite
+// @args   - #1 An element, #2 another element
+// @return - Bool, false if the two elements were already in the same set
+inline bool UnionFind::unite(unsigned int a, unsigned int b) {
+
+    a = find(a);
+    b = find(b);
+
+    if(a == b)
+        return false;
+
+    // hang the smaller tree under the larger one
+    if(set_size[a] < set_size[b])
+        std::swap(a, b);
+
+    parent[b] = a;
+    set_size[a] += set_size[b];
+    num_sets--;
+
+    return true;
+}
+
+// @func   - connected
+// @args   - #1 An element, #2 another element
+// @return - True if the two elements are in the same set
+inline bool UnionFind::connected(unsigned int a, unsigned int b) {
+    return find(a) == find(b);
+}
+
+// @func   - getSetSize
+// @args   - #1 An element
+// @return - The number of elements in the set that the element is in
+inline unsigned int UnionFind::getSetSize(unsigned int x) {
+    return set_size[find(x)];
+}
+
+// @func   - getNumSets
+// @return - The number of disjoint sets
+inline unsigned int UnionFind::getNumSets() const {
+    return num_sets;
+}
+
+// @func   - size
+// @return - The number of elements
+inline unsigned int UnionFind::size() const {
+    return parent.size();
+}
@@ -0,0 +1,84 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - UnionFind.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the declaration of the UnionFind class, a disjoint set forest over the integers [0, size). The graph
+*               classes use it to track which vertices have been joined together by the spanning tree, minimum cut, and
+*               connectivity algorithms.
+*
+*   @Details  - Every element points at a parent element, and the element at the root of each tree names the set. Sets are
+*               joined by hanging the root of the smaller tree under the root of the larger one (union by size), and every
+*               find halves the path it walks by pointing each element it passes at its grandparent. Together these keep
+*               the trees so shallow that both operations are effectively constant time.
+**/
+
+#ifndef UNION_FIND_H
+#define UNION_FIND_H
+
+#include <vector>
+#include <utility>
+
+class UnionFind
+{
+public:
+
+    // @func - Constructor
+    // @args - #1 The number of elements, each element starts out in a set by itself
+    UnionFind(unsigned int = 0);
+
+    // @func - reset
+    // @args - #1 The new number of elements
+    // @info - Puts every element back into a set by itself
+    void reset(unsigned int);
+
+    // @func   - add
+    // @return - The new element, which starts out in a set by itself
+    unsigned int add();
+
+    // @func   - find
+    // @args   - #1 An element in the range [0, size())
+    // @return - The root of the set that the element is in
+    unsigned int find(unsigned int);
+
+    // @func   - unite
+    // @args   - #1 An element, #2 another element
+    // @return - Bool, false if the two elements were already in the same set
+    bool unite(unsigned int, unsigned int);
+
+    // @func   - connected
+    // @args   - #1 An element, #2 another element
+    // @return - True if the two elements are in the same set
+    bool connected(unsigned int, unsigned int);
+
+    // @func   - getSetSize
+    // @args   - #1 An element
+    // @return - The number of elements in the set that the element is in
+    unsigned int getSetSize(unsigned int);
+
+    // @func   - getNumSets
+    // @return - The number of disjoint sets
+    unsigned int getNumSets() const;
+
+    // @func   - size
+    // @return - The number of elements
+    unsigned int size() const;
+
+private:
+
+    // @member - parent
+    // @info   - The parent of each element, roots are their own parent
+    std::vector<unsigned int> parent;
+
+    // @member - set_size
+    // @info   - The number of elements under each root, only meaningful for roots
+    std::vector<unsigned int> set_size;
+
+    // @member - num_sets
+    // @info   - The number of disjoint sets
+    unsigned int num_sets;
+
+};
+
+#include "UnionFind.cpp"
+#endif
@@ -3,19 +3,19 @@
 // @func - Constructor #1
 // @args - none
 template<class VertexType> 
-Vertex<VertexType>::Vertex()  {
+Vertex<VertexType>::Vertex() : index(-1) {
 
 }
 
 // @func - Constructor #2
 // @args - #1 Data associated with the vertex, #2 Index associated with the vertex
 template<class VertexType> 
-Vertex<VertexType>::Vertex(const VertexType & newdata) : data(newdata){ }
+Vertex<VertexType>::Vertex(const VertexType & newdata, int newindex) : data(newdata), index(newindex) { }
 
 
 // Get the data that the vertex contains (templated)
 template<class VertexType> 
-VertexType Vertex<VertexType>::getData() const{
+const VertexType & Vertex<VertexType>::getData() const{
     return this->data;
 }
 
@@ -25,3 +25,16 @@ bool Vertex<VertexType>::setData(const VertexType & newData) {
     this->data = newData;
     return true;
 }
+
+// Get the dense index of the vertex inside of the graph that owns it, -1 if it isn't in a graph
+template<class VertexType>
+int Vertex<VertexType>::getIndex() const {
+    return this->index;
+}
+
+// set the dense index of the vertex, only the graph classes should call this
+template<class VertexType>
+bool Vertex<VertexType>::setIndex(int newIndex) {
+    this->index = newIndex;
+    return true;
+}
@@ -21,19 +21,29 @@ public:
 
     // @func - Constructor #2
     // @args - #1 Data associated with the vertex, #2 Index associated with the vertex
-    Vertex(const VertexType &);
+    Vertex(const VertexType &, int = -1);
 
     // Get the data that the vertex contains (templated)
-    VertexType getData() const;
+    const VertexType & getData() const;
 
     // set the data that the vertex contains
     bool setData(const VertexType &);
 
+    // Get the dense index of the vertex inside of the graph that owns it, -1 if it isn't in a graph
+    int getIndex() const;
+
+    // set the dense index of the vertex, only the graph classes should call this
+    bool setIndex(int);
+
 private:
 
     // Data that the vertex contains
     VertexType data;
 
+    // The position of this vertex in the graph's vector of vertices. The graph algorithms use this to keep their working
+    // state (marked, prev, dist, etc) in flat vectors instead of in maps keyed by the vertex data.
+    int index;
+
 };
 #include "Vertex.cpp"
 #endif
@@ -0,0 +1,95 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - Visitor.cpp
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This is the implementation of the visitor helpers declared in Visitor.h.
+**/
+
+#include "Visitor.h"
+
+// @func - Constructor
+// @args - #1 The traveler to forward the callbacks to
+template <class VertexType>
+TravelerAdapter<VertexType>::TravelerAdapter(GraphTraveler<VertexType> & t) : traveler(t) {}
+
+template <class VertexType>
+void TravelerAdapter<VertexType>::starting_vertex(const VertexType & data) {
+    traveler.starting_vertex(data);
+}
+
+template <class VertexType>
+void TravelerAdapter<VertexType>::discover_vertex(const VertexType & data) {
+    traveler.discover_vertex(data);
+}
+
+template <class VertexType>
+void TravelerAdapter<VertexType>::examine_edge(const Edge<VertexType> & edge) {
+    traveler.examine_edge(edge);
+}
+
+template <class VertexType>
+void TravelerAdapter<VertexType>::traverse_edge(const Edge<VertexType> & edge) {
+    traveler.traverse_edge(edge);
+}
+
+template <class VertexType>
+void TravelerAdapter<VertexType>::finished_traversal() {
+    traveler.finished_traversal();
+}
+
+// @func   - onTreeEdge
+// @args   - #1 Any callable taking a const Edge<VertexType> &
+// @return - A visitor that calls it with the edges of the search tree
+template <class Function>
+TreeEdgeVisitor<Function> onTreeEdge(Function function) {
+    return TreeEdgeVisitor<Function>{function};
+}
+
+// @func   - onExamineEdge
+// @args   - #1 Any callable taking a const Edge<VertexType> &
+// @return - A visitor that calls it with every edge the search looks at
+template <class Function>
+ExamineEdgeVisitor<Function> onExamineEdge(Function function) {
+    return ExamineEdgeVisitor<Function>{function};
+}
+
+template <class Visitor, class VertexType>
+typename std::enable_if<HasStartingVertex<Visitor, VertexType>::value>::type visitStartingVertex(Visitor & visitor, const VertexType & data) {
+    visitor.starting_vertex(data);
+}
+
+template <class Visitor, class VertexType>
+typename std::enable_if<!HasStartingVertex<Visitor, VertexType>::value>::type visitStartingVertex(Visitor &, const VertexType &) {}
+
+template <class Visitor, class VertexType>
+typename std::enable_if<HasDiscoverVertex<Visitor, VertexType>::value>::type visitDiscoverVertex(Visitor & visitor, const VertexType & data) {
+    visitor.discover_vertex(data);
+}
+
+template <class Visitor, class VertexType>
+typename std::enable_if<!HasDiscoverVertex<Visitor, VertexType>::value>::type visitDiscoverVertex(Visitor &, const VertexType &) {}
+
+template <class Visitor, class EdgeType>
+typename std::enable_if<HasExamineEdge<Visitor, EdgeType>::value>::type visitExamineEdge(Visitor & visitor, const EdgeType & edge) {
+    visitor.examine_edge(edge);
+}
+
+template <class Visitor, class EdgeType>
+typename std::enable_if<!HasExamineEdge<Visitor, EdgeType>::value>::type visitExamineEdge(Visitor &, const EdgeType &) {}
+
+template <class Visitor, class EdgeType>
+typename std::enable_if<HasTraverseEdge<Visitor, EdgeType>::value>::type visitTraverseEdge(Visitor & visitor, const EdgeType & edge) {
+    visitor.traverse_edge(edge);
+}
+
+template <class Visitor, class EdgeType>
+typename std::enable_if<!HasTraverseEdge<Visitor, EdgeType>::value>::type visitTraverseEdge(Visitor &, const EdgeType &) {}
+
+template <class Visitor>
+typename std::enable_if<HasFinishedTraversal<Visitor>::value>::type visitFinishedTraversal(Visitor & visitor) {
+    visitor.finished_traversal();
+}
+
+template <class Visitor>
+typename std::enable_if<!HasFinishedTraversal<Visitor>::value>::type visitFinishedTraversal(Visitor &) {}
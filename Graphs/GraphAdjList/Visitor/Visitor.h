@@ -0,0 +1,179 @@
+/**
+*   @Author   - John H Allard Jr.
+*   @File     - Visitor.h
+*   @Date     - 10/18/2026
+*   @Repo     - https://github.com/jhallard/DataStructures/Graphs
+*   @Purpose  - This file declares what the graph classes need to run their searches against any visitor type instead of a
+*               GraphTraveler pointer. A visitor is any object with some or all of the five GraphTraveler callbacks as plain
+*               member functions (starting_vertex, discover_vertex, examine_edge, traverse_edge and finished_traversal), it
+*               doesn't have to derive from anything and the callbacks don't have to be virtual.
+*
+*   @Details  - The searches never call a visitor directly, they call the visitX(...) functions below. Which overload of
+*               those gets picked is decided at compile time by whether the visitor has the callback at all, and the one for
+*               a missing callback is empty, so a search run with a visitor that only wants its tree edges doesn't pay a call
+*               (or, for a compressed graph, building an Edge object) per examined edge. A search run with a NullVisitor
+*               compiles down to the bare loop.
+*
+*               TravelerAdapter makes an existing GraphTraveler look like a visitor, which is how the GraphTraveler pointer
+*               versions of the searches are implemented. onTreeEdge and onExamineEdge turn a lambda into a visitor.
+**/
+
+#ifndef GRAPH_VISITOR_H
+#define GRAPH_VISITOR_H
+
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include "../Edge/Edge.h"
+#include "../../GraphTraveler/GraphTraveler.hpp"
+
+// @struct - NullVisitor
+// @info   - A visitor without any callbacks, the searches run with it when they are given a null GraphTraveler.
+struct NullVisitor {};
+
+// @class - TravelerAdapter
+// @info  - Forwards every callback to a GraphTraveler, so the traveler classes can be used wherever a visitor can.
+template <class VertexType>
+class TravelerAdapter
+{
+public:
+
+    // @func - Constructor
+    // @args - #1 The traveler to forward the callbacks to
+    TravelerAdapter(GraphTraveler<VertexType> &);
+
+    void starting_vertex(const VertexType &);
+    void discover_vertex(const VertexType &);
+    void examine_edge(const Edge<VertexType> &);
+    void traverse_edge(const Edge<VertexType> &);
+    void finished_traversal();
+
+private:
+
+    GraphTraveler<VertexType> & traveler;
+};
+
+// @struct - TreeEdgeVisitor
+// @info   - A visitor that calls a function with every edge the search travels along, see onTreeEdge.
+template <class Function>
+struct TreeEdgeVisitor
+{
+    template <class EdgeType>
+    void traverse_edge(const EdgeType & edge) { function(edge); }
+
+    Function function;
+};
+
+// @struct - ExamineEdgeVisitor
+// @info   - A visitor that calls a function with every edge the search looks at, see onExamineEdge.
+template <class Function>
+struct ExamineEdgeVisitor
+{
+    template <class EdgeType>
+    void examine_edge(const EdgeType & edge) { function(edge); }
+
+    Function function;
+};
+
+// @func   - onTreeEdge
+// @args   - #1 Any callable taking a const Edge<VertexType> &
+// @return - A visitor that calls it with the edges of the search tree (or of the path, for dijkstrasShortestPath)
+template <class Function>
+TreeEdgeVisitor<Function> onTreeEdge(Function);
+
+// @func   - onExamineEdge
+// @args   - #1 Any callable taking a const Edge<VertexType> &
+// @return - A visitor that calls it with every edge the search looks at
+template <class Function>
+ExamineEdgeVisitor<Function> onExamineEdge(Function);
+
+// @struct - IsVisitor
+// @info   - Everything but pointers and numbers can be a visitor, which keeps a GraphTraveler pointer (or a nullptr) from
+//           picking the visitor versions of the searches.
+template <class Visitor>
+struct IsVisitor
+{
+    typedef typename std::decay<Visitor>::type type;
+
+    static const bool value = !std::is_pointer<type>::value && !std::is_arithmetic<type>::value &&
+                              !std::is_same<type, std::nullptr_t>::value;
+};
+
+// @struct - HasStartingVertex, HasDiscoverVertex, HasExamineEdge, HasTraverseEdge, HasFinishedTraversal
+// @info   - value is true if the visitor has the callback and it can be called with the argument type given.
+template <class Visitor, class Arg>
+struct HasStartingVertex
+{
+    template <class V> static auto check(int) -> decltype(std::declval<V &>().starting_vertex(std::declval<const Arg &>()), std::true_type());
+    template <class V> static std::false_type check(...);
+
+    static const bool value = decltype(check<Visitor>(0))::value;
+};
+
+template <class Visitor, class Arg>
+struct HasDiscoverVertex
+{
+    template <class V> static auto check(int) -> decltype(std::declval<V &>().discover_vertex(std::declval<const Arg &>()), std::true_type());
+    template <class V> static std::false_type check(...);
+
+    static const bool value = decltype(check<Visitor>(0))::value;
+};
+
+template <class Visitor, class Arg>
+struct HasExamineEdge
+{
+    template <class V> static auto check(int) -> decltype(std::declval<V &>().examine_edge(std::declval<const Arg &>()), std::true_type());
+    template <class V> static std::false_type check(...);
+
+    static const bool value = decltype(check<Visitor>(0))::value;
+};
+
+template <class Visitor, class Arg>
+struct HasTraverseEdge
+{
+    template <class V> static auto check(int) -> decltype(std::declval<V &>().traverse_edge(std::declval<const Arg &>()), std::true_type());
+    template <class V> static std::false_type check(...);
+
+    static const bool value = decltype(check<Visitor>(0))::value;
+};
+
+template <class Visitor>
+struct HasFinishedTraversal
+{
+    template <class V> static auto check(int) -> decltype(std::declval<V &>().finished_traversal(), std::true_type());
+    template <class V> static std::false_type check(...);
+
+    static const bool value = decltype(check<Visitor>(0))::value;
+};
+
+// @func - visitStartingVertex, visitDiscoverVertex, visitExamineEdge, visitTraverseEdge, visitFinishedTraversal
+// @args - #1 The visitor, #2 the argument to hand to the callback
+// @info - Calls the callback if the visitor has it, the overload for a visitor without it does nothing.
+template <class Visitor, class VertexType>
+typename std::enable_if<HasStartingVertex<Visitor, VertexType>::value>::type visitStartingVertex(Visitor &, const VertexType &);
+template <class Visitor, class VertexType>
+typename std::enable_if<!HasStartingVertex<Visitor, VertexType>::value>::type visitStartingVertex(Visitor &, const VertexType &);
+
+template <class Visitor, class VertexType>
+typename std::enable_if<HasDiscoverVertex<Visitor, VertexType>::value>::type visitDiscoverVertex(Visitor &, const VertexType &);
+template <class Visitor, class VertexType>
+typename std::enable_if<!HasDiscoverVertex<Visitor, VertexType>::value>::type visitDiscoverVertex(Visitor &, const VertexType &);
+
+template <class Visitor, class EdgeType>
+typename std::enable_if<HasExamineEdge<Visitor, EdgeType>::value>::type visitExamineEdge(Visitor &, const EdgeType &);
+template <class Visitor, class EdgeType>
+typename std::enable_if<!HasExamineEdge<Visitor, EdgeType>::value>::type visitExamineEdge(Visitor &, const EdgeType &);
+
+template <class Visitor, class EdgeType>
+typename std::enable_if<HasTraverseEdge<Visitor, EdgeType>::value>::type visitTraverseEdge(Visitor &, const EdgeType &);
+template <class Visitor, class EdgeType>
+typename std::enable_if<!HasTraverseEdge<Visitor, EdgeType>::value>::type visitTraverseEdge(Visitor &, const EdgeType &);
+
+template <class Visitor>
+typename std::enable_if<HasFinishedTraversal<Visitor>::value>::type visitFinishedTraversal(Visitor &);
+template <class Visitor>
+typename std::enable_if<!HasFinishedTraversal<Visitor>::value>::type visitFinishedTraversal(Visitor &);
+
+#include "Visitor.cpp"
+
+#endif
@@ -176,11 +176,10 @@ public:
     virtual bool breadthFirst(const VertexType &, GraphTraveler<VertexType> * = nullptr) = 0;
 
     // @func   - minimuminCut
-    // @args   - none
+    // @args   - #1 Optional output, the total weight of the edges that cross the cut
     // @return - 2 column vector of vertices, each column representing one half of the cut.
-    // @info   - Partitions the current graph into two subsets that have at the minmum number of edges between them.
-    //           Not yet completed, only about half-way done. This function signature probably isn't even final.
-    virtual std::vector<std::vector<VertexType> > minimumCut() = 0;
+    // @info   - Partitions the current graph into two subsets that have the minimum total edge weight between them.
+    virtual std::vector<std::vector<VertexType> > minimumCut(double * = nullptr) = 0;
 
     // @func   - minimumunSpanningTree
     // @args   - none